@@ -73,7 +73,6 @@
 
 #include "Time.h"
 #include "SAPL.h"
-#include "MQTT.h"
 #include "SHNF_Definitions.h"
 
 #include "datalogger.h"
@@ -83,8 +82,6 @@
 
 #include "SAPL.h"
 
-#include "MQTT.h"
-
 #ifndef EPLS_SW_CONFIG_CHECKED
 #error EPLS Software Configuration is not checked!!!
 #endif
@@ -101,8 +98,8 @@ static UINT32 dw_Ct = 0UL;
 static SNMTS_t_SN_STATE_MAIN e_LastSnState;
 
 //for printing the Application Output
-static UINT32 printDelay= 10000000UL;
-static UINT32 printCnt = 0L;
+static UINT32 printDelay= 10000UL; /* in consecutive time ticks */
+static UINT32 printCt = 0UL;
 
 
 /** k_SINGLE_INST_NUM:
@@ -150,7 +147,7 @@ static BOOLEAN InitCt(void);
 static BOOLEAN InitEPLS(void);
 
 static void Build(void);
-static void Process(void);
+static UINT8 Process(void);
 
 static void PrintSnState(SNMTS_t_SN_STATE_MAIN e_snState);
 static void OutputHeader(void);
@@ -184,6 +181,7 @@ int main(void) /*lint !e970 (Note -- Use of modifier or type 'int' outside of a
     BOOLEAN o_break = TRUE; /* to avoid the warning C4127: conditional
                              expression is constant; while(1) */
     SNMTS_t_SN_STATE_MAIN e_actSnState; /* to get the actual SN state */
+    UINT8 b_numRxFrames; /* number of frames processed in the application loop */
 
     /* if the initialization of the target was successful */
     if (SAPL_InitTarget())
@@ -193,14 +191,16 @@ int main(void) /*lint !e970 (Note -- Use of modifier or type 'int' outside of a
 
         /* The consecutive time value must be the same on both safety controller
       for the initialization */
-        dw_Ct = SHNFTime_getTime(SAPL_cfg_CT_BASIS);
-
-        /* initialize unit SHNF */
-        SHNF_Init(k_SINGLE_INST_NUM_ SAPL_k_SCM_SN1_SADR);
+        SHNFTime_StartCycle();
+        dw_Ct = SHNFTime_getCycleTime(SAPL_cfg_CT_BASIS);
 
-        /* if the initialization of the EPLS stack was successful */
-        if (InitEPLS())
+        /* if unit SHNF has started its transport and the initialization
+           of the EPLS stack was successful */
+        if (SHNF_Init(k_SINGLE_INST_NUM_ SAPL_k_SCM_SN1_SADR) && InitEPLS())
         {
+            /* subscribe to the SPDOs of the configured producers */
+            SHNF_SubscribeRxSpdoSources(k_SINGLE_INST_NUM);
+
             /* After the EPLS stack initialization, the application may copy data from
          non volatile memory to the SOD
          E.g.: Consecutive time is initialized */
@@ -224,7 +224,12 @@ int main(void) /*lint !e970 (Note -- Use of modifier or type 'int' outside of a
                     {
                         /* The consecutive time value must be the same on both safety
                controller and the same value during one application loop */
-                        dw_Ct = SHNFTime_getTime(SAPL_cfg_CT_BASIS);
+                        SHNFTime_StartCycle();
+                        dw_Ct = SHNFTime_getCycleTime(SAPL_cfg_CT_BASIS);
+#if (SPDO_cfg_40_BIT_CT_SUPPORT == EPLS_k_ENABLE)
+                        /* inflate the CT to the 40 bit CT of the SPDOs */
+                        SPDO_UpdateExtCtValue(k_SINGLE_INST_NUM_ dw_Ct);
+#endif /* (SPDO_cfg_40_BIT_CT_SUPPORT == EPLS_k_ENABLE) */
 
                         /* calculation of the CRC */
                         SAPL_CalculateCRC(k_SINGLE_INST_NUM);
@@ -234,13 +239,15 @@ int main(void) /*lint !e970 (Note -- Use of modifier or type 'int' outside of a
 
                         Build();
 
-                        Process();
+                        b_numRxFrames = Process();
 
-                        if(printCnt >= printDelay){
+                        /* all frames built and answered in this loop are sent together */
+                        SHNF_FlushTxMemBlocks();
+
+                        if((dw_Ct - printCt) >= printDelay){
                         	PrintApplicationData();
-                        	printCnt = 0;
-                        }else{
-                        	printCnt++;
+                        	SHNF_PrintEventStatistics();
+                        	printCt = dw_Ct;
                         }
 
 
@@ -253,10 +260,22 @@ int main(void) /*lint !e970 (Note -- Use of modifier or type 'int' outside of a
                                 /* print the actual SN state */
                                 PrintSnState(e_actSnState);
                                 //sendState(e_actSnState);
+                                /* the parameter download may have changed the SPDO producers */
+                                if (e_actSnState == SNMTS_k_ST_OPERATIONAL)
+                                {
+                                    SHNF_SubscribeRxSpdoSources(k_SINGLE_INST_NUM);
+                                }
                                 /*store the last SN state */
                                 e_LastSnState = e_actSnState;
                             }
                         }
+
+                        /* if no frame was pending, sleep until a frame is received
+                           or the next consecutive time tick is due */
+                        if (b_numRxFrames == 0U)
+                        {
+                            SHNF_WaitForEvent();
+                        }
                     }
                     /* no else : the error was already printed in the
                       SAPL_SERR_SignalErrorClbk() */
@@ -383,6 +402,22 @@ static void Build(void)
                                    call of the SSC_BuildTxFrames */
     UINT8 b_numFreeMngtFrms = 2U; /* number of free management frames can be sent
                                    per call of the SSC_BuildTxFrames */
+    UINT16 w_numFreeTxFrms; /* number of frames the SHNF can take */
+    SHNF_t_TEL_TYPE e_lostTelType; /* telegram type of a lost request */
+    UINT16 w_lostAdr; /* destination of a lost request */
+
+    /* while the network is congested, the SHNF can take less frames */
+    w_numFreeTxFrms = SHNF_GetNumFreeTxFrames(SHNF_k_SPDO);
+    if (w_numFreeTxFrms < b_numFreeSpdoFrms)
+    {
+        b_numFreeSpdoFrms = w_numFreeTxFrms;
+    }
+    /* SNMT and SSDO frames share the management frames */
+    w_numFreeTxFrms = SHNF_GetNumFreeTxFrames(SHNF_k_SNMT);
+    if (w_numFreeTxFrms < b_numFreeMngtFrms)
+    {
+        b_numFreeMngtFrms = (UINT8)w_numFreeTxFrms;
+    }
 
     /* Guard timeout is checked */
     SNMTS_TimerCheck(k_SINGLE_INST_NUM_ dw_Ct, &b_numFreeMngtFrms);
@@ -390,6 +425,21 @@ static void Build(void)
     /* SPDO frames are built */
     SPDO_BuildTxSpdo(k_SINGLE_INST_NUM_ dw_Ct, &b_numFreeSpdoFrms);
 
+    /* requests the SHNF failed to deliver are repeated without waiting for
+       their response timeout */
+    while (SHNF_GetLostFrame(&e_lostTelType, &w_lostAdr))
+    {
+        if (e_lostTelType == SHNF_k_SNMT)
+        {
+            SNMTM_RequestLost(w_lostAdr);
+        }
+        else if ((e_lostTelType == SHNF_k_SSDO) || (e_lostTelType == SHNF_k_SSDO_SLIM))
+        {
+            SSDOC_RequestLost(w_lostAdr);
+        }
+        /* no else : SPDOs are not reported */
+    }
+
     /* SNMT frame is built */
     SNMTM_BuildRequest(dw_Ct, &b_numFreeMngtFrms);
 
@@ -407,72 +457,84 @@ static void Build(void)
  **
  ** Function    : Process
  **
- ** Description : This function gets a EPLS frame from the SHNF, calls the
- **               SSC_ProcessRxFrame function to process this frame, checks
+ ** Description : This function gets all pending EPLS frames from the SHNF,
+ **               up to SAPL_cfg_RX_FRAMES_PER_CYCLE, calls the
+ **               SSC_ProcessRxFrame function to process each frame, checks
  **               whether the Tx process data equals to the Rx process data and
  **               in this case increases the Tx process data.
  **
  ** Parameters  : -
  **
- ** Returnvalue : -
+ ** Returnvalue : number of processed EPLS frames
  **
  *******************************************************************************/
-static void Process(void)
+static UINT8 Process(void)
 {
+    SHNF_t_RX_FRAME as_rxFrames[SAPL_cfg_RX_FRAMES_PER_CYCLE]; /* references to
+                                                 the received EPLS frames */
+    UINT8   b_numFrames;   /* number of received EPLS frames */
+    UINT8   b_frameIdx;    /* index of the processed EPLS frame */
     UINT16  w_frameLength; /* length of received EPLS frame */
     UINT8  *pb_rxFrame;    /* reference to a received EPLS frame */
-    SHNF_t_TEL_TYPE e_telType;
+#if (SPDO_cfg_MAX_NO_RX_SPDO != 0)
+    UINT32  dw_rxTimeout;  /* earliest SCT deadline of the Rx SPDOs */
+#endif
 
-    /* get reference to received EPLS frame */
-    pb_rxFrame = SHNF_GetEplsFrame(&w_frameLength, &e_telType);
+    /* get references to all received EPLS frames, up to the budget of one
+       application loop. All of them are processed with the same consecutive time */
+    b_numFrames = SHNF_GetEplsFrames(as_rxFrames, SAPL_cfg_RX_FRAMES_PER_CYCLE);
 
-    /* if EPLS frame was received */
-    if(pb_rxFrame != NULL)
+    for (b_frameIdx = 0U; b_frameIdx < b_numFrames; b_frameIdx++)
     {
+        pb_rxFrame = as_rxFrames[b_frameIdx].pb_frame;
+        w_frameLength = as_rxFrames[b_frameIdx].w_frameLength;
+
         /* if the received frame is SPDO frame */
-        if (e_telType == SHNF_k_SPDO)
+        if (as_rxFrames[b_frameIdx].e_telType == SHNF_k_SPDO)
         {
             /* The received SPDO frame is processed */
             SPDO_ProcessRxSpdo(k_SINGLE_INST_NUM_ dw_Ct, pb_rxFrame, w_frameLength);
 
-#if (SPDO_cfg_MAX_NO_RX_SPDO != 0)
-            /* SCT timeout is checked */
-            SPDO_CheckRxTimeout(k_SINGLE_INST_NUM_ dw_Ct);
-#endif
-
             //SpdoLoopbackDataChk();
         }
         /* else other frame was received */
         else
         {
-#if (SPDO_cfg_MAX_NO_RX_SPDO != 0)
-            /* SCT timeout is checked */
-            SPDO_CheckRxTimeout(k_SINGLE_INST_NUM_ dw_Ct);
-#endif
-
-
             /* while the frame processing is busy and no fail safe error happened */
-            while ((SSC_ProcessSNMTSSDOFrame(k_SINGLE_INST_NUM_ dw_Ct, pb_rxFrame,
-                    w_frameLength) == SSC_k_BUSY))
+            while (SSC_ProcessSNMTSSDOFrame(k_SINGLE_INST_NUM_ dw_Ct, pb_rxFrame,
+                    w_frameLength) == SSC_k_BUSY)
             {
                 pb_rxFrame = (UINT8 *)NULL;
                 w_frameLength = 0U;
             }
         }
-
-        /* release frame */
-        SHNF_ReleaseEplsFrame();
     }
-    else /* no EPLS frame was received */
-    {
+
 #if (SPDO_cfg_MAX_NO_RX_SPDO != 0)
-        /* SCT timeout is checked */
+    /* SCT timeout is checked once for the whole batch, after all received
+       SPDOs were processed. Without a received frame, it is only checked if
+       the earliest deadline of the Rx SPDOs elapsed */
+    if ((b_numFrames > 0U) ||
+        (SPDO_GetNextRxTimeout(k_SINGLE_INST_NUM_ &dw_rxTimeout) &&
+         EPLS_TIMEOUT(dw_Ct, dw_rxTimeout)))
+    {
         SPDO_CheckRxTimeout(k_SINGLE_INST_NUM_ dw_Ct);
+    }
+    /* no else : no deadline elapsed */
 #endif
+
+    /* if EPLS frames were received */
+    if (b_numFrames > 0U)
+    {
+        /* release all frames of the batch */
+        SHNF_ReleaseEplsFrames(b_numFrames);
     }
+    /* no else : no EPLS frame was received */
 
     /* call the Control Flow Monitoring */
     SCFM_TACK_PATH();
+
+    return b_numFrames;
 }
 
 /*******************************************************************************
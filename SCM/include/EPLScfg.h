@@ -24,6 +24,12 @@
     value range of all configuration defines. */
 #define EPLS_k_NOT_APPLICABLE  2000
 
+/*  Large network profile, selected with the CMake option CFG_LARGE_NETWORK.
+    The SCM manages a domain of up to 1023 SNs and consumes a Rx SPDO of every
+    SN. The SPDOs are assigned to the SADRs by sorted tables instead of the
+    look-up tables, see SPDO_cfg_SPDO_NUM_LOOK_UP_TABLE. The memory needed by
+    a configuration is listed in <target>_footprint.txt of the build. */
+
 /*******************************************************************************
  **                    General configuration defines
  *******************************************************************************/
@@ -90,7 +96,11 @@
     Allowed values:
      if EPLS_cfg_SCM == EPLS_k_ENABLE then 2..1023
      if EPLS_cfg_SCM == EPLS_k_DISABLE then EPLS_k_NOT_APPLICABLE */
+#ifdef CFG_LARGE_NETWORK
+#define SCM_cfg_MAX_NUM_OF_NODES  1023
+#else
 #define SCM_cfg_MAX_NUM_OF_NODES  3 //original 100
+#endif
 
 
 /*  This define configures the number of processed Safety Nodes per call
@@ -108,7 +118,11 @@
     Allowed values:
      if EPLS_cfg_SCM == EPLS_k_ENABLE then 2..1023
      if EPLS_cfg_SCM == EPLS_k_DISABLE then EPLS_k_NOT_APPLICABLE */
+#ifdef CFG_LARGE_NETWORK
+#define SCM_cfg_MAX_SADR_VALUE  1023
+#else
 #define SCM_cfg_MAX_SADR_VALUE  100
+#endif
 
 
 
@@ -135,19 +149,25 @@
     accomplished in the buffer of the received SPDO frame, the buffer data is
     changed.
 
+    The SHNF hands out the received frames in its own RX slots, which are not
+    reused before SHNF_ReleaseEplsFrame(), so the frame is decoded in place.
+
     Allowed values: EPLS_k_ENABLE, EPLS_k_DISABLE */
-#define SPDO_cfg_FRAME_CPY_INTERN  EPLS_k_ENABLE
+#define SPDO_cfg_FRAME_CPY_INTERN  EPLS_k_DISABLE
 
 
 /*  Define to enable or disable the using of the Lookup table for the SPDO
     number assignment. If the loop-up table is enabled then the SPDO filtering
     works faster but it needs always 2 Byte * 1024 memory. If the loop-up table
-    is disabled then a linear search table is used to filter the SPDO frames and
-    the filtering works slower because of linear searching. This linear search
-    table needs 4 Bytes per SADR configured in the SPDO communication parameters.
+    is disabled then a table sorted by the SADR is used to filter the SPDO frames,
+    it is searched binary. This table needs 4 Bytes per SPDO of the instance.
 
     Allowed values: EPLS_k_ENABLE, EPLS_k_DISABLE*/
+#ifdef CFG_LARGE_NETWORK
+#define SPDO_cfg_SPDO_NUM_LOOK_UP_TABLE  EPLS_k_DISABLE
+#else
 #define SPDO_cfg_SPDO_NUM_LOOK_UP_TABLE  EPLS_k_ENABLE
+#endif
 
 
 /*  Maximum number of RxSPDOs to be synchronized over a TxSPDO
@@ -164,6 +184,18 @@
 #define SPDO_cfg_CONNECTION_VALID_STATISTIC  EPLS_k_DISABLE
 
 
+/*  The data of the SPDOs is published to the application in a double buffered
+    process image, see SHNF_Common/ProcessImage.h
+    Allowed values: EPLS_k_ENABLE, EPLS_k_DISABLE*/
+#define SPDO_cfg_PROCESS_IMAGE               EPLS_k_ENABLE
+
+
+/*  Writes to objects mapped into a Tx SPDO mark the Tx SPDO as changed, it is
+    sent with the next SPDO_BuildTxSpdo() as after SPDO_TxDataChanged()
+    Allowed values: EPLS_k_ENABLE, EPLS_k_DISABLE*/
+#define SPDO_cfg_TX_DATA_CHANGE_TRACKING     EPLS_k_ENABLE
+
+
 /*  Maximum number of the Tx SPDOs.
     Allowed values: 1..1023*/
 #define SPDO_cfg_MAX_NO_TX_SPDO  4
@@ -199,7 +231,11 @@
     in the received SPDOs and Time Response SPDOs will not be processed. Only the
     Time Request SPDOs will be processed.
     Allowed values: 0..1023 */
+#ifdef CFG_LARGE_NETWORK
+#define SPDO_cfg_MAX_NO_RX_SPDO  1023
+#else
 #define SPDO_cfg_MAX_NO_RX_SPDO  4
+#endif
 
 /*  Maximum number of the Rx SPDOs of a SDG instance.
     Allowed values: 0 (for IO's)*/
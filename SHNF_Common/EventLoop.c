@@ -0,0 +1,204 @@
+/*
+ * \file SHNF_Common/EventLoop.c
+ * Event handling for the application loop, see \file EventLoop.h
+ */
+#include "EventLoop.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#include <poll.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/eventfd.h>
+#include <sys/timerfd.h>
+
+#include <pthread.h>
+#include "CrossCompile_Linux.h"
+
+#include "datalogger.h"
+#include "Time.h"
+
+/* Indices of the event handles in the poll set */
+#define k_EVENT_RX      0
+#define k_EVENT_TICK    1
+#define k_EVENT_COUNT   2
+
+/* Poll set of the application loop, fd is -1 as long as it has not been created */
+static struct pollfd as_events[k_EVENT_COUNT] = { { -1, POLLIN, 0 }, { -1, POLLIN, 0 } };
+
+/* Interval of the idle tick and its first expiry, in micro seconds */
+static UINT32 dw_TickUs = 0;
+static UINT64 ddw_FirstTickUs = 0;
+/* Number of tick expiries consumed so far */
+static UINT64 ddw_TickCount = 0;
+
+/* Set by the receiving thread with the first frame after a wake-up, reset by the
+   application loop. Only a transition from 0 writes to the eventfd */
+static volatile UINT32 dw_RxSignalled = 0;
+/* Time of the first frame after the last wake-up, in micro seconds */
+static volatile UINT64 ddw_RxSignalTimeUs = 0;
+
+/* Wake-up latency histograms */
+static UINT32 adw_RxLatency[k_EVENT_LATENCY_BUCKETS];
+static UINT32 adw_TickLatency[k_EVENT_LATENCY_BUCKETS];
+
+/**
+ * \brief Returns the monotonic time in micro seconds
+ */
+static UINT64 GetMonotonicUs ( void )
+{
+    struct timespec s_now;
+
+    clock_gettime ( CLOCK_MONOTONIC, &s_now );
+    return ( (UINT64)s_now.tv_sec * 1000000ULL ) + ( (UINT64)s_now.tv_nsec / 1000ULL );
+}
+
+/**
+ * \brief Adds a latency to the given histogram
+ *
+ * \param adw_histogram the histogram
+ * \param ddw_latencyUs the latency in micro seconds
+ */
+static void RecordLatency ( UINT32 adw_histogram[], UINT64 ddw_latencyUs )
+{
+    UINT8 b_bucket = 0;
+
+    while ( ( b_bucket < ( k_EVENT_LATENCY_BUCKETS - 1 ) ) && ( ddw_latencyUs >= ( 1ULL << b_bucket ) ) )
+        b_bucket++;
+
+    adw_histogram[b_bucket]++;
+}
+
+BOOLEAN SHNF_InitEventLoop ( UINT32 dw_tickUs )
+{
+    struct itimerspec s_tick;
+
+    memset ( adw_RxLatency, 0, sizeof(adw_RxLatency) );
+    memset ( adw_TickLatency, 0, sizeof(adw_TickLatency) );
+
+    as_events[k_EVENT_RX].fd = eventfd ( 0, EFD_NONBLOCK | EFD_CLOEXEC );
+    as_events[k_EVENT_TICK].fd = timerfd_create ( CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC );
+
+    if ( ( as_events[k_EVENT_RX].fd < 0 ) || ( as_events[k_EVENT_TICK].fd < 0 ) )
+    {
+        DATA_LOGGER1 ( "Error creating the event handles: %s, falling back to polling\n", strerror(errno) );
+        SHNF_CleanUpEventLoop();
+        return FALSE;
+    }
+
+    /** The tick is periodic, so missed expiries do not shift the following ones */
+    dw_TickUs = dw_tickUs;
+    s_tick.it_interval.tv_sec = dw_tickUs / 1000000UL;
+    s_tick.it_interval.tv_nsec = ( dw_tickUs % 1000000UL ) * 1000UL;
+    s_tick.it_value = s_tick.it_interval;
+
+    ddw_FirstTickUs = GetMonotonicUs() + dw_tickUs;
+    ddw_TickCount = 0;
+
+    if ( timerfd_settime ( as_events[k_EVENT_TICK].fd, 0, &s_tick, NULL ) != 0 )
+    {
+        DATA_LOGGER1 ( "Error arming the idle tick: %s, falling back to polling\n", strerror(errno) );
+        SHNF_CleanUpEventLoop();
+        return FALSE;
+    }
+
+    return TRUE;
+}
+
+void SHNF_SignalRxEvent ( void )
+{
+    UINT64 ddw_signal = 1;
+
+    if ( as_events[k_EVENT_RX].fd < 0 )
+        return;
+
+    /** The exchange also orders the frame publication before the application loop
+     *  resetting the flag, so a frame is either seen by the reset or signalled anew */
+    if ( ATOMIC_EXCHANGE( dw_RxSignalled, 1 ) == 0 )
+    {
+        ddw_RxSignalTimeUs = GetMonotonicUs();
+        if ( write ( as_events[k_EVENT_RX].fd, &ddw_signal, sizeof(ddw_signal) ) < 0 )
+        {
+            DATA_LOGGER_DEBUG1 ( "Error signalling the application loop: %s\n", strerror(errno) );
+        }
+    }
+}
+
+void SHNF_WaitForEvent ( void )
+{
+    UINT64 ddw_value;
+    UINT64 ddw_now;
+
+    /** Without event handles, the application loop is polling */
+    if ( as_events[k_EVENT_RX].fd < 0 )
+        return;
+
+    /** With the simulated clock, the loop waits for its step in SHNFTime_StartCycle
+     *  (shared memory step barrier), or a single node steps the clock per loop */
+    if ( SHNFTime_IsSimulated() )
+        return;
+
+    if ( poll ( as_events, k_EVENT_COUNT, -1 ) < 0 )
+    {
+        if ( errno != EINTR )
+        {
+            DATA_LOGGER1 ( "Error waiting for an event: %s\n", strerror(errno) );
+        }
+        return;
+    }
+
+    ddw_now = GetMonotonicUs();
+
+    if ( as_events[k_EVENT_RX].revents & POLLIN )
+    {
+        if ( read ( as_events[k_EVENT_RX].fd, &ddw_value, sizeof(ddw_value) ) == sizeof(ddw_value) )
+            RecordLatency ( adw_RxLatency, ddw_now - ddw_RxSignalTimeUs );
+
+        /** Frames arriving from now on signal the eventfd again */
+        (void)ATOMIC_EXCHANGE( dw_RxSignalled, 0 );
+    }
+
+    if ( as_events[k_EVENT_TICK].revents & POLLIN )
+    {
+        /** The value is the number of expiries since the last read, the latency is
+         *  measured against the latest one */
+        if ( read ( as_events[k_EVENT_TICK].fd, &ddw_value, sizeof(ddw_value) ) == sizeof(ddw_value) )
+        {
+            ddw_TickCount += ddw_value;
+            RecordLatency ( adw_TickLatency, ddw_now - ( ddw_FirstTickUs + ( ddw_TickCount - 1 ) * dw_TickUs ) );
+        }
+    }
+}
+
+void SHNF_PrintEventStatistics ( void )
+{
+    UINT8 b_bucket;
+
+    DATA_LOGGER ( "Wake-up latency [us] :      RX frame    idle tick\n" );
+    for ( b_bucket = 0; b_bucket < k_EVENT_LATENCY_BUCKETS; b_bucket++ )
+    {
+        if ( b_bucket < ( k_EVENT_LATENCY_BUCKETS - 1 ) )
+        {
+            DATA_LOGGER3 ( "   < %6lu :           %10u   %10u\n", ( 1UL << b_bucket ),
+                    adw_RxLatency[b_bucket], adw_TickLatency[b_bucket] );
+        }
+        else
+        {
+            DATA_LOGGER3 ( "  >= %6lu :           %10u   %10u\n", ( 1UL << ( b_bucket - 1 ) ),
+                    adw_RxLatency[b_bucket], adw_TickLatency[b_bucket] );
+        }
+    }
+}
+
+void SHNF_CleanUpEventLoop ( void )
+{
+    UINT8 b_event;
+
+    for ( b_event = 0; b_event < k_EVENT_COUNT; b_event++ )
+    {
+        if ( as_events[b_event].fd >= 0 )
+            close ( as_events[b_event].fd );
+        as_events[b_event].fd = -1;
+    }
+}
@@ -0,0 +1,76 @@
+/*
+ * \file SHNF_Common/EventLoop.h
+ * Event handling for the application loop, replacing the busy polling of the SHNF
+ * \addtogroup Demo
+ * \addtogroup SHNF
+ * \{
+ *
+ * The application loop blocks until either a frame has been inserted into the RX
+ * ring (signalled by an eventfd) or the idle tick (a timerfd) expired. The tick
+ * wakes the loop in time for every stack timer, as those are resolved in
+ * consecutive time ticks. The SCT timeouts of the Rx SPDOs are not checked on
+ * every tick, but only once their earliest deadline elapsed, see
+ * SPDO_GetNextRxTimeout.
+ *
+ * For both wake-up sources a histogram of the wake-up latency is kept, which is
+ * the time between the frame being inserted or the timer expiring and the
+ * application loop running again.
+ *
+ *****************************************************************************
+ * This source code is free software; you can redistribute it and/or modify it
+ * under the terms of the BSD license (according to License.txt).
+ *****************************************************************************/
+
+#ifndef SHNF_EVENTLOOP_H_
+#define SHNF_EVENTLOOP_H_
+
+#include "EPLStarget.h"
+#include "EPLScfg.h"
+#include "EPLStypes.h"
+
+/* Number of buckets in the wake-up latency histograms. Bucket n counts the
+   wake-ups with a latency below 2^n micro seconds, the last one all others */
+#define k_EVENT_LATENCY_BUCKETS 16
+
+/**
+ * \brief This function creates the eventfd and timerfd for the application loop
+ * and arms the idle tick.
+ *
+ * If the event handling cannot be created, \see SHNF_WaitForEvent returns
+ * immediately, and the application loop keeps polling.
+ *
+ * \param dw_tickUs the interval of the idle tick in micro seconds
+ *
+ * \return - TRUE on success
+ *         - FALSE on failure
+ */
+BOOLEAN SHNF_InitEventLoop ( UINT32 dw_tickUs );
+
+/**
+ * \brief This function signals the arrival of a frame to the application loop.
+ *
+ * It is called by the receiving thread, after the frame has been published in
+ * the RX ring. Only the first frame after a wake-up of the application loop
+ * triggers a write to the eventfd.
+ */
+void SHNF_SignalRxEvent ( void );
+
+/**
+ * \brief This function blocks the application loop until a frame has been
+ * received or the idle tick expired.
+ */
+void SHNF_WaitForEvent ( void );
+
+/**
+ * \brief This function prints the wake-up latency histograms.
+ */
+void SHNF_PrintEventStatistics ( void );
+
+/**
+ * \brief This function closes the event handles.
+ */
+void SHNF_CleanUpEventLoop ( void );
+
+#endif /* SHNF_EVENTLOOP_H_ */
+
+/* \} */
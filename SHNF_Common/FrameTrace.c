@@ -0,0 +1,519 @@
+/*
+ * \file SHNF_Common/FrameTrace.c
+ * Binary trace of the frames passing the SHNF, see \file FrameTrace.h
+ *
+ * The ring file starts with a header, followed by k_openSAFETY_TRACE_RING_SIZE
+ * records. A writer claims the next position by incrementing the write position
+ * of the header, invalidates the record at that position, fills it and publishes
+ * it by storing the position + 1 as its sequence number. A reader only takes a
+ * record, whose sequence number matches the position before and after the copy.
+ */
+#include "FrameTrace.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "SHNF_Definitions.h"
+#include "SHNFBufferHandling.h"
+
+#ifdef linux
+
+#include <fcntl.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#if ( ( k_openSAFETY_TRACE_RING_SIZE & ( k_openSAFETY_TRACE_RING_SIZE - 1 ) ) != 0 )
+#error k_openSAFETY_TRACE_RING_SIZE has to be a power of two
+#endif
+
+#define k_TRACE_RING_MASK ( k_openSAFETY_TRACE_RING_SIZE - 1 )
+
+/* Identification of the ring file, "OSFT" */
+#define k_TRACE_MAGIC     0x5446534FUL
+#define k_TRACE_VERSION   1
+
+/* Maximum length of the path of the ring file */
+#define k_TRACE_MAX_PATH  256
+
+/* UDP port, which is decoded as openSAFETY by Wireshark */
+#define k_TRACE_UDP_PORT  9877
+
+/* Position of the TADR in sub-frame 2 of SNMT and SSDO frames */
+#define k_SUBFRAME2_TADR  3
+
+/* Address of the SPDOs, which are sent to all nodes */
+#define k_TRACE_BROADCAST 0xFFFFU
+
+/* Headers of the pcap file format (nano second resolution) and the IPv4/UDP
+   header written in front of every frame */
+#define k_PCAP_MAGIC_NS   0xA1B23C4DUL
+#define k_PCAP_LINKTYPE_RAW 101
+#define k_PCAP_IP_HEADER  20
+#define k_PCAP_UDP_HEADER 8
+
+/* Header of the ring file */
+typedef struct
+{
+    UINT32 dw_magic;
+    UINT16 w_version;
+    UINT16 w_ownSadr;
+    UINT32 dw_numRecords;
+    UINT32 dw_recordSize;
+    /* next position to be written, free running */
+    volatile UINT32 dw_writePos;
+} t_TRACE_HEADER;
+
+/* A frame of the ring */
+typedef struct
+{
+    /* position + 1 of the frame held, 0 while the record is written */
+    volatile UINT32 dw_seq;
+    UINT16 w_length;
+    UINT8 b_dir;
+    UINT8 b_telType;
+    UINT32 dw_tsSec;
+    UINT32 dw_tsNsec;
+    UINT8 ab_frame[k_openSAFETY_BUFFER_SIZE];
+} t_TRACE_RECORD;
+
+/* Layout of the ring file */
+typedef struct
+{
+    t_TRACE_HEADER s_header;
+    UINT8 ab_pad[CACHE_LINE_SIZE - sizeof(t_TRACE_HEADER)];
+    t_TRACE_RECORD as_records[k_openSAFETY_TRACE_RING_SIZE];
+} t_TRACE_RING;
+
+/* Header of the pcap file */
+typedef struct
+{
+    UINT32 dw_magic;
+    UINT16 w_versionMajor;
+    UINT16 w_versionMinor;
+    UINT32 dw_timeZone;
+    UINT32 dw_accuracy;
+    UINT32 dw_snapLen;
+    UINT32 dw_linkType;
+} t_PCAP_HEADER;
+
+/* Header of a frame in the pcap file */
+typedef struct
+{
+    UINT32 dw_tsSec;
+    UINT32 dw_tsNsec;
+    UINT32 dw_inclLen;
+    UINT32 dw_origLen;
+} t_PCAP_RECORD;
+
+volatile UINT8 SHNF_b_TraceFilter = 0;
+
+/* The mapped ring, NULL if no trace is running */
+static t_TRACE_RING * ps_ring = (t_TRACE_RING *)NULL;
+/* Path of the ring file */
+static char ac_ringFile[k_TRACE_MAX_PATH];
+
+/* Names of the telegram types in k_openSAFETY_TRACE_FILTER_ENV */
+static const struct
+{
+    const char * pc_name;
+    UINT8 b_filter;
+} as_filterNames[] =
+{
+    { "spdo", SHNF_TRACE_TYPE(SHNF_k_SPDO) },
+    { "ssdo", SHNF_TRACE_TYPE(SHNF_k_SSDO) | SHNF_TRACE_TYPE(SHNF_k_SSDO_SLIM) },
+    { "snmt", SHNF_TRACE_TYPE(SHNF_k_SNMT) }
+};
+
+BOOLEAN SHNF_TraceStart ( const char * pc_file, UINT8 b_filter, UINT16 w_ownSadr )
+{
+    int i_fd;
+    void * pv_map;
+
+    SHNF_TraceStop();
+
+    if ( strlen ( pc_file ) >= sizeof(ac_ringFile) )
+    {
+        DATA_LOGGER1 ( "Trace file name \"%s\" is too long\n", pc_file );
+        return FALSE;
+    }
+
+    i_fd = open ( pc_file, O_RDWR | O_CREAT | O_TRUNC, 0644 );
+    if ( i_fd < 0 )
+    {
+        DATA_LOGGER1 ( "Trace file \"%s\" could not be created\n", pc_file );
+        return FALSE;
+    }
+
+    /** The file is filled with zeros, all records are invalid */
+    pv_map = MAP_FAILED;
+    if ( ftruncate ( i_fd, (off_t)sizeof(t_TRACE_RING) ) == 0 )
+        pv_map = mmap ( NULL, sizeof(t_TRACE_RING), PROT_READ | PROT_WRITE, MAP_SHARED, i_fd, 0 );
+    close ( i_fd );
+
+    if ( pv_map == MAP_FAILED )
+    {
+        DATA_LOGGER1 ( "Trace file \"%s\" could not be mapped\n", pc_file );
+        return FALSE;
+    }
+
+    ps_ring = (t_TRACE_RING *)pv_map;
+    ps_ring->s_header.dw_magic = k_TRACE_MAGIC;
+    ps_ring->s_header.w_version = k_TRACE_VERSION;
+    ps_ring->s_header.w_ownSadr = w_ownSadr;
+    ps_ring->s_header.dw_numRecords = k_openSAFETY_TRACE_RING_SIZE;
+    ps_ring->s_header.dw_recordSize = sizeof(t_TRACE_RECORD);
+    ps_ring->s_header.dw_writePos = 0;
+    strcpy ( ac_ringFile, pc_file );
+
+    ATOMIC_STORE_RELEASE( SHNF_b_TraceFilter, b_filter );
+
+    DATA_LOGGER2 ( "Tracing frames into \"%s\", filter 0x%02X\n", pc_file, b_filter );
+    return TRUE;
+}
+
+void SHNF_TraceStartFromEnv ( UINT16 w_ownSadr )
+{
+    const char * pc_file;
+    const char * pc_types;
+    UINT8 b_filter;
+    UINT32 i;
+
+    pc_file = getenv ( k_openSAFETY_TRACE_ENV );
+    if ( ( pc_file == NULL ) || ( pc_file[0] == '\0' ) )
+        return;
+
+    b_filter = k_TRACE_ALL_TYPES;
+    pc_types = getenv ( k_openSAFETY_TRACE_FILTER_ENV );
+    if ( pc_types != NULL )
+    {
+        b_filter = 0;
+        for ( i = 0; i < ( sizeof(as_filterNames) / sizeof(as_filterNames[0]) ); i++ )
+        {
+            if ( strstr ( pc_types, as_filterNames[i].pc_name ) != NULL )
+                b_filter |= as_filterNames[i].b_filter;
+        }
+    }
+
+    (void)SHNF_TraceStart ( pc_file, b_filter, w_ownSadr );
+}
+
+void SHNF_TraceSetFilter ( UINT8 b_filter )
+{
+    if ( ps_ring != NULL )
+        ATOMIC_STORE_RELEASE( SHNF_b_TraceFilter, b_filter );
+}
+
+void SHNF_TraceFrame ( UINT8 b_dir, SHNF_t_TEL_TYPE e_telType, const UINT8 * pb_frame, UINT16 w_length )
+{
+    t_TRACE_RING * ps_trace;
+    t_TRACE_RECORD * ps_record;
+    struct timespec s_now;
+    UINT32 dw_pos;
+
+    ps_trace = ps_ring;
+    if ( ps_trace == NULL )
+        return;
+
+    if ( w_length > k_openSAFETY_BUFFER_SIZE )
+        w_length = k_openSAFETY_BUFFER_SIZE;
+
+    clock_gettime ( CLOCK_REALTIME, &s_now );
+
+    /** Claiming the position, the record is invalid until it is filled */
+    dw_pos = ATOMIC_FETCH_ADD( ps_trace->s_header.dw_writePos, 1 );
+    ps_record = &ps_trace->as_records[dw_pos & k_TRACE_RING_MASK];
+    (void)ATOMIC_EXCHANGE( ps_record->dw_seq, 0 );
+
+    ps_record->w_length = w_length;
+    ps_record->b_dir = b_dir;
+    ps_record->b_telType = (UINT8)e_telType;
+    ps_record->dw_tsSec = (UINT32)s_now.tv_sec;
+    ps_record->dw_tsNsec = (UINT32)s_now.tv_nsec;
+    memcpy ( ps_record->ab_frame, pb_frame, w_length );
+
+    ATOMIC_STORE_RELEASE( ps_record->dw_seq, dw_pos + 1 );
+}
+
+/**
+ * This function returns the IPv4 address of a node in the pcap file.
+ */
+static UINT32 TraceNodeAddress ( UINT16 w_sadr )
+{
+    return ( 10UL << 24 ) | (UINT32)w_sadr;
+}
+
+/**
+ * This function writes a value in network byte order.
+ */
+static void TracePutBE ( UINT8 * pb_dst, UINT32 dw_value, UINT8 b_bytes )
+{
+    while ( b_bytes > 0 )
+    {
+        b_bytes--;
+        pb_dst[b_bytes] = (UINT8)dw_value;
+        dw_value >>= 8;
+    }
+}
+
+/**
+ * This function writes the IPv4 and UDP header of a traced frame. The addresses are
+ * taken from the SADR of the node and the address fields of the frame.
+ */
+static void TraceBuildHeaders ( UINT8 * pb_hdr, const t_TRACE_RECORD * ps_record, UINT16 w_ownSadr )
+{
+    UINT16 w_frame1Pos;
+    UINT16 w_peer = 0;
+    UINT32 dw_src;
+    UINT32 dw_dst;
+    UINT32 dw_sum = 0;
+    UINT32 i;
+
+    /** The ADR of an SPDO is its producer, the ADR of SNMT and SSDO frames the
+        receiver, with the sender in the TADR of sub-frame 2 */
+    w_frame1Pos = findFrame1Start ( ps_record->w_length, ps_record->ab_frame );
+    if ( w_frame1Pos > 0 )
+    {
+        if ( ( ps_record->b_dir == k_TRACE_DIR_TX ) || ( ps_record->b_telType == SHNF_k_SPDO ) )
+            w_peer = openSAFETY_FRAME_ADDRESS ( ps_record->ab_frame, w_frame1Pos );
+        else if ( ps_record->w_length > ( k_SUBFRAME2_TADR + 1 ) )
+            w_peer = openSAFETY_FRAME_ADDRESS ( ps_record->ab_frame, k_SUBFRAME2_TADR );
+    }
+
+    if ( ps_record->b_dir == k_TRACE_DIR_TX )
+    {
+        dw_src = TraceNodeAddress ( w_ownSadr );
+        dw_dst = TraceNodeAddress ( ( ps_record->b_telType == SHNF_k_SPDO ) ? k_TRACE_BROADCAST : w_peer );
+    }
+    else
+    {
+        dw_src = TraceNodeAddress ( w_peer );
+        dw_dst = TraceNodeAddress ( ( ps_record->b_telType == SHNF_k_SPDO ) ? k_TRACE_BROADCAST : w_ownSadr );
+    }
+
+    memset ( pb_hdr, 0, k_PCAP_IP_HEADER + k_PCAP_UDP_HEADER );
+
+    /** IPv4, without options and fragmentation */
+    pb_hdr[0] = 0x45;
+    TracePutBE ( &pb_hdr[2], k_PCAP_IP_HEADER + k_PCAP_UDP_HEADER + ps_record->w_length, 2 );
+    TracePutBE ( &pb_hdr[4], ps_record->dw_seq, 2 );
+    pb_hdr[6] = 0x40;
+    pb_hdr[8] = 64;
+    pb_hdr[9] = 17;
+    TracePutBE ( &pb_hdr[12], dw_src, 4 );
+    TracePutBE ( &pb_hdr[16], dw_dst, 4 );
+    for ( i = 0; i < k_PCAP_IP_HEADER; i += 2 )
+        dw_sum += ( (UINT32)pb_hdr[i] << 8 ) | pb_hdr[i + 1];
+    while ( dw_sum > 0xFFFFU )
+        dw_sum = ( dw_sum & 0xFFFFU ) + ( dw_sum >> 16 );
+    TracePutBE ( &pb_hdr[10], ~dw_sum & 0xFFFFU, 2 );
+
+    /** UDP, without checksum */
+    TracePutBE ( &pb_hdr[k_PCAP_IP_HEADER + 0], k_TRACE_UDP_PORT, 2 );
+    TracePutBE ( &pb_hdr[k_PCAP_IP_HEADER + 2], k_TRACE_UDP_PORT, 2 );
+    TracePutBE ( &pb_hdr[k_PCAP_IP_HEADER + 4], k_PCAP_UDP_HEADER + ps_record->w_length, 2 );
+}
+
+/**
+ * This function writes the valid records of a ring, oldest first, to a pcap file.
+ */
+static BOOLEAN TraceWritePcap ( const t_TRACE_RING * ps_trace, const char * pc_pcapFile )
+{
+    static t_TRACE_RECORD s_record;
+    UINT8 ab_hdr[k_PCAP_IP_HEADER + k_PCAP_UDP_HEADER];
+    t_PCAP_HEADER s_global;
+    t_PCAP_RECORD s_pcap;
+    const t_TRACE_RECORD * ps_record;
+    UINT32 dw_writePos;
+    UINT32 dw_pos;
+    UINT32 dw_frames = 0;
+    FILE * ps_file;
+    BOOLEAN o_ok;
+
+    ps_file = fopen ( pc_pcapFile, "wb" );
+    if ( ps_file == NULL )
+    {
+        DATA_LOGGER1 ( "Pcap file \"%s\" could not be created\n", pc_pcapFile );
+        return FALSE;
+    }
+
+    /** Global header, in host byte order as indicated by the magic */
+    s_global.dw_magic = k_PCAP_MAGIC_NS;
+    s_global.w_versionMajor = 2;
+    s_global.w_versionMinor = 4;
+    s_global.dw_timeZone = 0;
+    s_global.dw_accuracy = 0;
+    s_global.dw_snapLen = sizeof(ab_hdr) + k_openSAFETY_BUFFER_SIZE;
+    s_global.dw_linkType = k_PCAP_LINKTYPE_RAW;
+    o_ok = ( fwrite ( &s_global, sizeof(s_global), 1, ps_file ) == 1 );
+
+    dw_writePos = ATOMIC_LOAD_ACQUIRE( ps_trace->s_header.dw_writePos );
+    dw_pos = 0;
+    if ( dw_writePos > k_openSAFETY_TRACE_RING_SIZE )
+        dw_pos = dw_writePos - k_openSAFETY_TRACE_RING_SIZE;
+
+    for ( ; o_ok && ( dw_pos != dw_writePos ); dw_pos++ )
+    {
+        ps_record = &ps_trace->as_records[dw_pos & k_TRACE_RING_MASK];
+
+        /** Records being written or overwritten while copied are skipped */
+        if ( ATOMIC_LOAD_ACQUIRE( ps_record->dw_seq ) != ( dw_pos + 1 ) )
+            continue;
+        memcpy ( &s_record, (const void *)ps_record, sizeof(s_record) );
+        if ( ( ATOMIC_LOAD_ACQUIRE( ps_record->dw_seq ) != ( dw_pos + 1 ) ) ||
+             ( s_record.w_length > k_openSAFETY_BUFFER_SIZE ) )
+            continue;
+
+        TraceBuildHeaders ( ab_hdr, &s_record, ps_trace->s_header.w_ownSadr );
+
+        s_pcap.dw_tsSec = s_record.dw_tsSec;
+        s_pcap.dw_tsNsec = s_record.dw_tsNsec;
+        s_pcap.dw_inclLen = sizeof(ab_hdr) + s_record.w_length;
+        s_pcap.dw_origLen = s_pcap.dw_inclLen;
+
+        o_ok = ( fwrite ( &s_pcap, sizeof(s_pcap), 1, ps_file ) == 1 ) &&
+               ( fwrite ( ab_hdr, sizeof(ab_hdr), 1, ps_file ) == 1 ) &&
+               ( fwrite ( s_record.ab_frame, s_record.w_length, 1, ps_file ) == 1 );
+        dw_frames++;
+    }
+
+    if ( fclose ( ps_file ) != 0 )
+        o_ok = FALSE;
+
+    if ( !o_ok )
+    {
+        DATA_LOGGER1 ( "Pcap file \"%s\" could not be written\n", pc_pcapFile );
+        return FALSE;
+    }
+
+    DATA_LOGGER2 ( "Traced frames written to \"%s\" : %u\n", pc_pcapFile, dw_frames );
+    return TRUE;
+}
+
+BOOLEAN SHNF_TraceDumpPcap ( const char * pc_pcapFile )
+{
+    char ac_pcapFile[k_TRACE_MAX_PATH + 8];
+
+    if ( ps_ring == NULL )
+        return FALSE;
+
+    if ( pc_pcapFile == NULL )
+    {
+        snprintf ( ac_pcapFile, sizeof(ac_pcapFile), "%s.pcap", ac_ringFile );
+        pc_pcapFile = ac_pcapFile;
+    }
+
+    return TraceWritePcap ( ps_ring, pc_pcapFile );
+}
+
+BOOLEAN SHNF_TraceFileToPcap ( const char * pc_file, const char * pc_pcapFile )
+{
+    const t_TRACE_RING * ps_trace;
+    struct stat s_stat;
+    void * pv_map;
+    int i_fd;
+    BOOLEAN o_ret = FALSE;
+
+    i_fd = open ( pc_file, O_RDONLY );
+    if ( i_fd < 0 )
+    {
+        DATA_LOGGER1 ( "Trace file \"%s\" could not be opened\n", pc_file );
+        return FALSE;
+    }
+
+    /** Only rings of the same layout can be read */
+    pv_map = MAP_FAILED;
+    if ( ( fstat ( i_fd, &s_stat ) == 0 ) && ( s_stat.st_size == (off_t)sizeof(t_TRACE_RING) ) )
+        pv_map = mmap ( NULL, sizeof(t_TRACE_RING), PROT_READ, MAP_SHARED, i_fd, 0 );
+    close ( i_fd );
+
+    if ( pv_map == MAP_FAILED )
+    {
+        DATA_LOGGER1 ( "Trace file \"%s\" does not match the trace configuration\n", pc_file );
+        return FALSE;
+    }
+
+    ps_trace = (const t_TRACE_RING *)pv_map;
+    if ( ( ps_trace->s_header.dw_magic == k_TRACE_MAGIC ) &&
+         ( ps_trace->s_header.w_version == k_TRACE_VERSION ) &&
+         ( ps_trace->s_header.dw_numRecords == k_openSAFETY_TRACE_RING_SIZE ) &&
+         ( ps_trace->s_header.dw_recordSize == sizeof(t_TRACE_RECORD) ) )
+        o_ret = TraceWritePcap ( ps_trace, pc_pcapFile );
+    else
+        DATA_LOGGER1 ( "Trace file \"%s\" does not match the trace configuration\n", pc_file );
+
+    munmap ( pv_map, sizeof(t_TRACE_RING) );
+    return o_ret;
+}
+
+void SHNF_TraceStop ( void )
+{
+    if ( ps_ring == NULL )
+        return;
+
+    /** Frames may only be recorded by threads which are stopped already */
+    ATOMIC_STORE_RELEASE( SHNF_b_TraceFilter, 0 );
+    munmap ( (void *)ps_ring, sizeof(t_TRACE_RING) );
+    ps_ring = (t_TRACE_RING *)NULL;
+}
+
+#else /* linux */
+
+/**
+ * The trace ring relies on memory mapped files, tracing is not available.
+ */
+volatile UINT8 SHNF_b_TraceFilter = 0;
+
+BOOLEAN SHNF_TraceStart ( const char * pc_file, UINT8 b_filter, UINT16 w_ownSadr )
+{
+    /* Avoid compiler warning */
+    b_filter = b_filter;
+    w_ownSadr = w_ownSadr;
+
+    DATA_LOGGER1 ( "Tracing into \"%s\" is only available on linux\n", pc_file );
+    return FALSE;
+}
+
+void SHNF_TraceStartFromEnv ( UINT16 w_ownSadr )
+{
+    if ( getenv ( k_openSAFETY_TRACE_ENV ) != NULL )
+        (void)SHNF_TraceStart ( getenv ( k_openSAFETY_TRACE_ENV ), k_TRACE_ALL_TYPES, w_ownSadr );
+}
+
+void SHNF_TraceSetFilter ( UINT8 b_filter )
+{
+    /* Avoid compiler warning */
+    b_filter = b_filter;
+}
+
+void SHNF_TraceFrame ( UINT8 b_dir, SHNF_t_TEL_TYPE e_telType, const UINT8 * pb_frame, UINT16 w_length )
+{
+    /* Avoid compiler warning */
+    b_dir = b_dir;
+    e_telType = e_telType;
+    pb_frame = pb_frame;
+    w_length = w_length;
+}
+
+BOOLEAN SHNF_TraceDumpPcap ( const char * pc_pcapFile )
+{
+    /* Avoid compiler warning */
+    pc_pcapFile = pc_pcapFile;
+    return FALSE;
+}
+
+BOOLEAN SHNF_TraceFileToPcap ( const char * pc_file, const char * pc_pcapFile )
+{
+    /* Avoid compiler warning */
+    pc_file = pc_file;
+    pc_pcapFile = pc_pcapFile;
+    return FALSE;
+}
+
+void SHNF_TraceStop ( void )
+{
+}
+
+#endif /* linux */
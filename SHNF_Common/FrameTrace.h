@@ -0,0 +1,138 @@
+/*
+ * \file SHNF_Common/FrameTrace.h
+ * Binary trace of the frames passing the SHNF
+ * \addtogroup Demo
+ * \addtogroup SHNF
+ * \{
+ *
+ * Every frame received into the RX ring and every frame handed to the send queue
+ * is copied, with a time stamp, into a ring of fixed records in a memory mapped
+ * file. Only the last k_openSAFETY_TRACE_RING_SIZE frames are kept. The file
+ * stays readable after a crash of the node, as every record is published on its
+ * own.
+ *
+ * The ring is converted to a pcap file, which can be read by Wireshark. Every
+ * frame is wrapped into an IPv4/UDP header to the port of the openSAFETY
+ * dissector, with the SADRs of the sender and the receiver in the addresses
+ * (10.0.<SADR high byte>.<SADR low byte>, 10.0.255.255 for SPDOs).
+ *
+ * The frames are recorded in wire order (sub-frame TWO first), before the switch
+ * on the receiving path. Tracing is off, until it is started by
+ * \see SHNF_TraceStart. If it is off, or the telegram type is filtered, the cost
+ * of a frame is the check of \see SHNF_b_TraceFilter.
+ *
+ *****************************************************************************
+ * This source code is free software; you can redistribute it and/or modify it
+ * under the terms of the BSD license (according to License.txt).
+ *****************************************************************************/
+
+#ifndef SHNF_FRAMETRACE_H_
+#define SHNF_FRAMETRACE_H_
+
+#include "EPLStarget.h"
+#include "EPLScfg.h"
+#include "EPLStypes.h"
+
+#include "SHNF.h"
+
+/* Directions of a traced frame */
+#define k_TRACE_DIR_RX 0
+#define k_TRACE_DIR_TX 1
+
+/* Filter bit of a telegram type */
+#define SHNF_TRACE_TYPE( e_telType )  ( (UINT8)( 1U << (e_telType) ) )
+
+/* Filter of all telegram types */
+#define k_TRACE_ALL_TYPES ( SHNF_TRACE_TYPE(SHNF_k_SPDO) | SHNF_TRACE_TYPE(SHNF_k_SSDO) | \
+                            SHNF_TRACE_TYPE(SHNF_k_SSDO_SLIM) | SHNF_TRACE_TYPE(SHNF_k_SNMT) )
+
+/* Telegram types being traced, 0 if tracing is off */
+extern volatile UINT8 SHNF_b_TraceFilter;
+
+/**
+ * \brief This macro records a frame, if its telegram type is traced.
+ *
+ * \param b_dir     the direction, k_TRACE_DIR_RX or k_TRACE_DIR_TX
+ * \param e_telType the telegram type of the frame
+ * \param pb_frame  the frame, sub-frame TWO first
+ * \param w_length  the length of the frame
+ */
+#define SHNF_TRACE_FRAME( b_dir, e_telType, pb_frame, w_length )                  \
+    do {                                                                         \
+        if ( SHNF_b_TraceFilter & SHNF_TRACE_TYPE(e_telType) )                   \
+            SHNF_TraceFrame ( (b_dir), (e_telType), (pb_frame), (w_length) );    \
+    } while ( 0 )
+
+/**
+ * \brief This function creates the ring file, maps it and starts tracing. A running
+ * trace is stopped first.
+ *
+ * \param pc_file   the path of the ring file, it is truncated
+ * \param b_filter  the telegram types to be traced, see \see SHNF_TRACE_TYPE
+ * \param w_ownSadr the SADR of this node, used as address of the node in the pcap file
+ *
+ * \return - TRUE  - tracing is started
+ *         - FALSE - the ring file could not be created
+ */
+BOOLEAN SHNF_TraceStart ( const char * pc_file, UINT8 b_filter, UINT16 w_ownSadr );
+
+/**
+ * \brief This function starts tracing, if the environment variable named by
+ * k_openSAFETY_TRACE_ENV holds the path of the ring file. The telegram types are
+ * taken from the variable named by k_openSAFETY_TRACE_FILTER_ENV ("spdo,ssdo,snmt"),
+ * all types are traced if it is not set.
+ *
+ * \param w_ownSadr the SADR of this node
+ */
+void SHNF_TraceStartFromEnv ( UINT16 w_ownSadr );
+
+/**
+ * \brief This function changes the telegram types being traced, while the ring is
+ * mapped. A filter of 0 pauses tracing.
+ *
+ * \param b_filter the telegram types to be traced, see \see SHNF_TRACE_TYPE
+ */
+void SHNF_TraceSetFilter ( UINT8 b_filter );
+
+/**
+ * \brief This function records a frame into the ring, it is called through
+ * \see SHNF_TRACE_FRAME. It may be called by several threads at the same time.
+ *
+ * \param b_dir     the direction, k_TRACE_DIR_RX or k_TRACE_DIR_TX
+ * \param e_telType the telegram type of the frame
+ * \param pb_frame  the frame, sub-frame TWO first
+ * \param w_length  the length of the frame, longer frames are truncated
+ */
+void SHNF_TraceFrame ( UINT8 b_dir, SHNF_t_TEL_TYPE e_telType, const UINT8 * pb_frame, UINT16 w_length );
+
+/**
+ * \brief This function writes the frames held by the ring of the running trace to
+ * a pcap file.
+ *
+ * \param pc_pcapFile the path of the pcap file, NULL for the ring file with ".pcap" appended
+ *
+ * \return - TRUE  - the pcap file is written
+ *         - FALSE - no trace is running or the file could not be written
+ */
+BOOLEAN SHNF_TraceDumpPcap ( const char * pc_pcapFile );
+
+/**
+ * \brief This function converts a ring file, e.g. left behind by a crashed node,
+ * to a pcap file.
+ *
+ * \param pc_file     the path of the ring file
+ * \param pc_pcapFile the path of the pcap file
+ *
+ * \return - TRUE  - the pcap file is written
+ *         - FALSE - the ring file is not valid or a file could not be accessed
+ */
+BOOLEAN SHNF_TraceFileToPcap ( const char * pc_file, const char * pc_pcapFile );
+
+/**
+ * \brief This function stops tracing and unmaps the ring. The ring file is kept.
+ */
+void SHNF_TraceStop ( void );
+
+#endif /* SHNF_FRAMETRACE_H_ */
+
+/* \} */
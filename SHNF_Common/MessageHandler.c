@@ -0,0 +1,1302 @@
+/*
+ * This File is the handler between the openSafety Stack and a user-specific Protokol
+ *
+ * It is the SHNF core shared by all transports: the TX frame pool with its send
+ * queue, the RX ring and the frame switching. The wire is accessed through the
+ * transport selected at start up, see \file SHNFTransport.h
+ */
+#include "MessageHandler.h"
+
+#include <stdio.h>
+#include <sys/types.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+
+
+#include "EPLScfg.h"
+#include "EPLStypes.h"
+#include "EPLStarget.h"
+
+#include "SHNFBufferHandling.h"
+#include "SHNFTransport.h"
+#include "EventLoop.h"
+#include "FrameTrace.h"
+
+#include <SHNF.h>
+
+#include "Time.h"
+#include "SODapi.h"
+/* Internal storage for the loopback address (the nodes own address) */
+static UINT16 w_LoopBackSadr;
+
+/* Mask for the RX ring counters */
+#define k_RX_RING_MASK ( k_openSAFETY_RX_RING_SIZE - 1 )
+
+#if ( k_openSAFETY_RX_RING_SIZE & k_RX_RING_MASK ) != 0
+#error k_openSAFETY_RX_RING_SIZE has to be a power of two
+#endif
+
+/* RX ring, filled by the receiving thread of the transport and emptied by the stack */
+static t_openSAFETY_RX_RING s_rxRing;
+
+/* openSAFETY buffers in SHNF */
+t_openSAFETY_BUFFER  as_openSAFETYFrames[k_openSAFETY_FRAME_QUEUE_SIZE];
+
+#if (SPDO_cfg_EXTENDED_CT_BIT_FIELD == EPLS_k_ENABLE)
+/* Extended CT bit per RxSPDO, hosted by the SHNF for the stack (see SHNF.h) */
+UINT32 SHNF_aaulExtCtBit[EPLS_cfg_MAX_INSTANCES][(SPDO_cfg_MAX_NO_RX_SPDO + 31) / 32];
+#endif
+
+/* The transports, which can be selected by name */
+static const SHNF_t_TRANSPORT * const aps_transports[] =
+{
+    &SHNF_s_MqttTransport,
+    &SHNF_s_UdpTransport,
+    &SHNF_s_SelfTestTransport,
+    &SHNF_s_ShmTransport
+};
+
+/* The selected transport, NULL until selected */
+static const SHNF_t_TRANSPORT * ps_transport = (const SHNF_t_TRANSPORT *)NULL;
+
+/* Position of the TADR in sub-frame 2, bit 8 and 9 are stored in the TR field behind it */
+#define k_SUBFRAME2_TADR 3
+
+/* UDID of the SCM in the SOD, sub-frame 2 of SPDOs is encoded with it. NULL until
+   read by SHNF_SubscribeRxSpdoSources */
+static const UINT8 * pb_scmUdid = (const UINT8 *)NULL;
+
+/* Creating buffer space for transmitting packets */
+CREATE_BUFFER(mutexTXBuffer);
+
+/* Stack of the free TX pool slots, the top most entry is handed out next */
+static UINT16 aw_txFreeSlots[k_openSAFETY_FRAME_QUEUE_SIZE];
+static UINT16 w_txNumFree;
+
+/* Slots marked as "ready to process", in the order they have been marked */
+static UINT16 aw_txPendingSlots[k_openSAFETY_FRAME_QUEUE_SIZE];
+static UINT16 w_txNumPending;
+
+#if ( k_openSAFETY_TX_QUEUE_DEPTH >= k_openSAFETY_FRAME_QUEUE_SIZE )
+#error k_openSAFETY_TX_QUEUE_DEPTH has to leave slots of the frame pool for building frames
+#endif
+
+/* Send queue, slots of the frames the transport did not accept, oldest first.
+   A queued slot stays allocated until its frame is sent or dropped */
+static UINT16 aw_txQueuedSlots[k_openSAFETY_TX_QUEUE_DEPTH];
+static UINT16 w_txNumQueued;
+
+/* Slots of the frames handed to the transport, released after its flush */
+static UINT16 aw_txSentSlots[k_openSAFETY_FRAME_QUEUE_SIZE];
+static UINT16 w_txNumSent;
+
+/* Number of frames dropped from the send queue, per telegram type */
+static UINT32 adw_txDropped[SHNF_k_SNMT + 1];
+
+/* Number of reports of lost frames kept until the stack collects them */
+#define k_LOST_FRAME_QUEUE_SIZE 16
+
+/* Reports of lost frames, written by the thread of the transport */
+CREATE_BUFFER(mutexLostFrames);
+static struct
+{
+    SHNF_t_TEL_TYPE e_telType;
+    UINT16 w_adr;
+} as_lostFrames[k_LOST_FRAME_QUEUE_SIZE];
+static UINT16 w_lostFramesRead;
+static UINT16 w_lostFramesCount;
+
+static void FlushTxFrames ( void );
+
+/**
+ * This function selects the transport by its name.
+ */
+BOOLEAN SHNF_SelectTransport ( const char * pc_name )
+{
+    UINT32 i;
+
+    for ( i = 0; i < ( sizeof(aps_transports) / sizeof(aps_transports[0]) ); i++ )
+    {
+        if ( strcmp ( aps_transports[i]->pc_name, pc_name ) == 0 )
+        {
+            ps_transport = aps_transports[i];
+            return TRUE;
+        }
+    }
+
+    DATA_LOGGER1 ( "Unknown SHNF transport \"%s\"\n", pc_name );
+    return FALSE;
+}
+
+/**
+ * \brief This function initializes the SHNF interface.
+ *
+ * \param w_loopBackSadr - loop back source address
+ *
+ * \return - TRUE  - the transport is started
+ *         - FALSE - no transport is available or it could not be started
+ */
+BOOLEAN SHNF_Init(BYTE_B_INSTNUM_ UINT16 w_loopBackSadr)
+{
+    UINT32 i = 0; /* loop counter */
+    const char * pc_transport; /* name of the transport from the environment */
+
+    #if (EPLS_cfg_MAX_INSTANCES > 1)
+        b_instNum = b_instNum; // to avoid warnings
+    #endif
+    w_LoopBackSadr = w_loopBackSadr;
+
+    #ifdef SHNF_LOG_ACTIVATE
+        GenerateErrorStr();
+
+        LOG_Init_File(SHNF_LOG_FILE);
+    #endif
+
+
+
+    /** Initialize the transmit buffer, all slots are free and cleared */
+    LOCK_BUFFER( mutexTXBuffer );
+    for(i = 0; i < k_openSAFETY_FRAME_QUEUE_SIZE; i++)
+    {
+        as_openSAFETYFrames[i].o_allocated = FALSE;
+        as_openSAFETYFrames[i].w_FrameSize = 0x00U;
+        as_openSAFETYFrames[i].o_marked = FALSE;
+        memset ( as_openSAFETYFrames[i].ab_FrameBuffer, 0, k_openSAFETY_BUFFER_SIZE );
+        aw_txFreeSlots[i] = (UINT16)( k_openSAFETY_FRAME_QUEUE_SIZE - 1 - i );
+    }
+    w_txNumFree = k_openSAFETY_FRAME_QUEUE_SIZE;
+    w_txNumPending = 0;
+    w_txNumQueued = 0;
+    w_txNumSent = 0;
+    memset ( adw_txDropped, 0, sizeof(adw_txDropped) );
+    UNLOCK_BUFFER( mutexTXBuffer );
+
+    /** Initialize the receiving ring, the receiver thread is not running yet */
+    s_rxRing.dw_head = 0;
+    s_rxRing.dw_tail = 0;
+    s_rxRing.dw_read = 0;
+
+    /** The event handles have to exist before the first frame is received */
+    SHNF_InitEventLoop ( k_openSAFETY_EVENT_TICK_US );
+
+    /** The trace has to be mapped before the first frame is sent or received */
+    SHNF_TraceStartFromEnv ( w_loopBackSadr );
+
+    /** Without explicit selection, the environment decides, then the configuration */
+    if ( ps_transport == NULL )
+    {
+        pc_transport = getenv ( k_openSAFETY_TRANSPORT_ENV );
+        if ( ( pc_transport == NULL ) || !SHNF_SelectTransport ( pc_transport ) )
+            (void)SHNF_SelectTransport ( k_openSAFETY_TRANSPORT );
+    }
+    if ( ps_transport == NULL )
+    {
+        DATA_LOGGER ( "No SHNF transport available!\n" );
+        return FALSE;
+    }
+
+    DATA_LOGGER1 ( "SHNF transport: %s\n", ps_transport->pc_name );
+    if ( !ps_transport->pf_Start ( w_loopBackSadr ) )
+    {
+        DATA_LOGGER1 ( "SHNF transport %s could not be started!\n", ps_transport->pc_name );
+        /** Nothing is sent on it, nor is it stopped on clean up */
+        ps_transport = (const SHNF_t_TRANSPORT *)NULL;
+        return FALSE;
+    }
+    return TRUE;
+}
+
+/**
+ * This function reads a UINT16 SADR from the SOD. 0 is returned for missing objects.
+ */
+static UINT16 ReadSodSadr(BYTE_B_INSTNUM_ UINT16 w_index)
+{
+    PTR_TYPE dw_sodHdl;
+    BOOLEAN o_appObj;
+    SOD_t_ERROR_RESULT s_errRes;
+    UINT16 * pw_sadr;
+
+    if ( SOD_AttrGet(B_INSTNUM_ w_index, 0x01U, &dw_sodHdl, &o_appObj, &s_errRes) == NULL )
+        return 0U;
+
+    pw_sadr = (UINT16 *)SOD_Read(B_INSTNUM_ dw_sodHdl, o_appObj, 0UL, 0UL, &s_errRes);
+    return ( pw_sadr != NULL ) ? *pw_sadr : 0U;
+}
+
+/**
+ * This function reads the producer SADR of every RxSPDO from the SOD (0x1400 + n,
+ * sub-index 0x01) and subscribes to its SPDOs. The SADR of every TxSPDO (0x1C00 + n,
+ * sub-index 0x01) is the TADR of the time requests sent to it by its consumers, these
+ * are subscribed as well. Unused SPDOs (SADR 0) and missing objects are skipped,
+ * SADRs already subscribed are not subscribed again.
+ */
+void SHNF_SubscribeRxSpdoSources(BYTE_B_INSTNUM)
+{
+    UINT16 w_spdo;
+    UINT16 w_sadr;
+    PTR_TYPE dw_sodHdl;
+    BOOLEAN o_appObj;
+    SOD_t_ERROR_RESULT s_errRes;
+
+    /** The TADR of the time requests is routed, it is encoded with the UDID of the SCM */
+    if ( SOD_AttrGet(B_INSTNUM_ EPLS_k_IDX_COMMON_COM_PARAM, EPLS_k_SUBIDX_UDID_SCM, &dw_sodHdl,
+            &o_appObj, &s_errRes) != NULL )
+        pb_scmUdid = (const UINT8 *)SOD_Read(B_INSTNUM_ dw_sodHdl, o_appObj, 0UL, 0UL, &s_errRes);
+
+    /** Transports without subscriptions receive every SPDO */
+    if ( ps_transport == NULL )
+        return;
+
+    if ( ps_transport->pf_SubscribeSpdo != NULL )
+    {
+        for ( w_spdo = 0; w_spdo < SPDO_cfg_MAX_NO_RX_SPDO; w_spdo++ )
+        {
+            w_sadr = ReadSodSadr(B_INSTNUM_ (UINT16)( 0x1400U + w_spdo ));
+            if ( w_sadr != 0U )
+                ps_transport->pf_SubscribeSpdo ( w_sadr );
+        }
+    }
+
+    if ( ps_transport->pf_SubscribeTimeRequests != NULL )
+    {
+        for ( w_spdo = 0; w_spdo < SPDO_cfg_MAX_NO_TX_SPDO; w_spdo++ )
+        {
+            w_sadr = ReadSodSadr(B_INSTNUM_ (UINT16)( 0x1C00U + w_spdo ));
+            if ( w_sadr != 0U )
+                ps_transport->pf_SubscribeTimeRequests ( w_sadr );
+        }
+    }
+}
+
+/*
+ * This function provides a reference to an empty memory block. The memory block is
+ * used to store an openSAFETY frame to be transmitted on the field bus. Frame header
+ * and frame data are stored within this block. The frame data is filled in the specific
+ * unit (SPDO, SNMTM, SNMTS, SSDOC, SSDOS) but the frame header is only build in unit SFS.
+ *
+ * After write access the memory block has to be marked as "ready to process".
+ * To do so the function \see SHNF_MarkTxMemBlock has to be called.
+ *
+ * \see SHNF_MarkTxMemBlock
+ *
+ * \warning The first part of the memory block contains the openSAFETY sub-frame TWO
+ *          and the second part the openSAFETY sub-frame ONE.
+ *
+ * \param B_INSTNUM instance number
+ * \param w_blockSize size of the requested memory block in bytes
+ * \param e_telType telegram type (SPDO / SSDO / SNMT)
+ * \param w_txSpdoNum Number of the Tx SPDO (first SPDO number is 0). It is only
+ *                 relevant, if telegram type is SPDO.
+ *
+ * \return - == NULL  - memory allocation failed, no memory available
+ *         - <> NULL  - memory allocation succeeded, reference to requested memory
+ */
+UINT8 * SHNF_GetTxMemBlock(BYTE_B_INSTNUM_ UINT16 w_blockSize,
+                           SHNF_t_TEL_TYPE e_telType, UINT16 w_txSpdoNum)
+{
+  UINT8 *pb_ret = (UINT8 *)NULL; /* return value */
+  pt_openSAFETY_BUFFER ps_slot;  /* the allocated slot */
+
+  #if (EPLS_cfg_MAX_INSTANCES > 1)
+    b_instNum = b_instNum; /* to avoid compiler warnings */
+  #endif
+  /* switch for the message type */
+  switch (e_telType)
+  {
+    case SHNF_k_SSDO:
+    case SHNF_k_SSDO_SLIM:
+    case SHNF_k_SNMT:
+    case SHNF_k_SPDO:
+    {
+        /* the frame does not fit into a slot */
+        if ( w_blockSize > k_openSAFETY_BUFFER_SIZE )
+        {
+            DATA_LOGGER_DEBUG1("Requested TX block of %u bytes exceeds the slot size\n", w_blockSize);
+            break;
+        }
+
+        LOCK_BUFFER( mutexTXBuffer );
+
+        /* every slot is allocated, but some are only waiting to be sent. While
+           the network is congested, this may not free any slot, and NULL is
+           returned as backpressure */
+        if ( ( w_txNumFree == 0 ) && ( ( w_txNumPending > 0 ) || ( w_txNumQueued > 0 ) ) )
+            FlushTxFrames();
+
+        /* get a free EPLS buffer */
+        if ( w_txNumFree > 0 )
+        {
+            w_txNumFree--;
+            ps_slot = &as_openSAFETYFrames[aw_txFreeSlots[w_txNumFree]];
+            ps_slot->o_allocated = TRUE;
+            ps_slot->o_marked = FALSE;
+            ps_slot->w_FrameSize = w_blockSize;
+            ps_slot->e_telType = e_telType;
+            ps_slot->w_txSpdoNum = w_txSpdoNum;
+            pb_ret = ps_slot->ab_FrameBuffer;
+        }
+        UNLOCK_BUFFER( mutexTXBuffer );
+
+      break;
+    }
+    default:
+    {
+      /* NULL is returned */
+      DATA_LOGGER_DEBUG("e_telType is unknown in the function SHNF_GetTxMemBlock");
+      break;
+    }
+  }
+
+  return pb_ret;
+
+}
+
+/*
+ * This function marks a requested memory block as "ready to process". That means all
+ * necessary data and frame header info for the openSAFETY frame was written into the
+ * memory block by the openSAFETY Stack and the frame can be transmitted on the field bus.
+ * To get a reference to an empty memory block the function \see SHNF_GetTxMemBlock()
+ * has to be called before.
+ *
+ * The frame is transmitted together with all other marked frames, by the next call to
+ * \see SHNF_FlushTxMemBlocks.
+ *
+ * \see SHNF_GetTxMemBlock
+ *
+ * \warning The first part of the memory block contains the openSAFETY sub-frame TWO
+ *          and the second part the openSAFETY sub-frame ONE.
+ *
+ * \param B_INSTNUM instance number
+ * \param pb_memBlock reference to the memory to be marked
+ *
+ * \return - TRUE  - memory block marked successfully
+ *         - FALSE - memory block NOT marked, error returned
+ */
+BOOLEAN SHNF_MarkTxMemBlock(BYTE_B_INSTNUM_ const UINT8 *pb_memBlock)
+{
+    BOOLEAN o_ret = FALSE;    /* return value */
+    UINT32 dw_offset;         /* offset of the block inside the pool */
+    UINT16 w_slot;            /* index of the slot holding the block */
+
+    #if (EPLS_cfg_MAX_INSTANCES > 1)
+        b_instNum = b_instNum; /* to avoid compiler warnings */
+    #endif
+
+    /* the block has to be the frame buffer of one of the pool slots, the slot
+       is found by its offset, without searching the pool */
+    w_slot = k_openSAFETY_FRAME_QUEUE_SIZE;
+    if ( pb_memBlock >= (const UINT8 *)as_openSAFETYFrames )
+    {
+        dw_offset = (UINT32)( pb_memBlock - (const UINT8 *)as_openSAFETYFrames );
+        w_slot = (UINT16)( dw_offset / sizeof(t_openSAFETY_BUFFER) );
+    }
+
+    if ( ( w_slot >= k_openSAFETY_FRAME_QUEUE_SIZE ) ||
+         ( pb_memBlock != as_openSAFETYFrames[w_slot].ab_FrameBuffer ) )
+    {
+        DATA_LOGGER_DEBUG("SHNF_MarkTxMemBlock() called for an unknown memory block\n");
+        return FALSE;
+    }
+
+    /* locking the transmission buffer */
+    LOCK_BUFFER( mutexTXBuffer );
+
+    /* if the buffer was allocated but not marked */
+    if ( as_openSAFETYFrames[w_slot].o_allocated && !as_openSAFETYFrames[w_slot].o_marked )
+    {
+        /* mark the buffer, it is sent with the next flush */
+        as_openSAFETYFrames[w_slot].o_marked = TRUE;
+        aw_txPendingSlots[w_txNumPending] = w_slot;
+        w_txNumPending++;
+
+        o_ret = TRUE;
+    }
+    UNLOCK_BUFFER( mutexTXBuffer );
+
+    /* the frame is complete and in wire order once it is marked */
+    if ( o_ret )
+        SHNF_TRACE_FRAME ( k_TRACE_DIR_TX, as_openSAFETYFrames[w_slot].e_telType,
+                           pb_memBlock, as_openSAFETYFrames[w_slot].w_FrameSize );
+
+    return o_ret;
+}
+
+/**
+ * This function returns the send queue policy for the given telegram type.
+ */
+static UINT8 GetTxPolicy ( SHNF_t_TEL_TYPE e_telType )
+{
+    if ( e_telType == SHNF_k_SPDO )
+        return k_openSAFETY_TX_POLICY_SPDO;
+    if ( e_telType == SHNF_k_SNMT )
+        return k_openSAFETY_TX_POLICY_SNMT;
+    return k_openSAFETY_TX_POLICY_SSDO;
+}
+
+/**
+ * This function clears the written bytes of a slot and hands it back to the pool.
+ *
+ * \note Has to be called with \see mutexTXBuffer locked
+ */
+static void ReleaseTxSlot ( UINT16 w_slot )
+{
+    pt_openSAFETY_BUFFER ps_slot = &as_openSAFETYFrames[w_slot];
+
+    memset ( ps_slot->ab_FrameBuffer, 0, ps_slot->w_FrameSize );
+    ps_slot->w_FrameSize = 0;
+    ps_slot->o_marked = FALSE;
+    ps_slot->o_allocated = FALSE;
+    aw_txFreeSlots[w_txNumFree] = w_slot;
+    w_txNumFree++;
+}
+
+/**
+ * This function returns the TADR of a time request, decoding sub-frame 2 with the
+ * UDID of the SCM.
+ */
+static UINT16 GetTimeRequestTadr ( const UINT8 * pb_frame )
+{
+    UINT8 ab_tadr[2];
+
+    ab_tadr[0] = (UINT8)( pb_frame[k_SUBFRAME2_TADR] ^ pb_scmUdid[k_SUBFRAME2_TADR] );
+    ab_tadr[1] = (UINT8)( pb_frame[k_SUBFRAME2_TADR + 1] ^ pb_scmUdid[k_SUBFRAME2_TADR + 1] );
+
+    return (UINT16)openSAFETY_FRAME_ADDRESS(ab_tadr, 0);
+}
+
+/**
+ * This function hands the frame of a slot to the transport.
+ *
+ * \return - TRUE  - the frame was accepted
+ *         - FALSE - the frame was not accepted and has to be sent again later
+ */
+static BOOLEAN SendTxSlot ( UINT16 w_slot )
+{
+    pt_openSAFETY_BUFFER ps_slot = &as_openSAFETYFrames[w_slot];
+    UINT16 i_frame1Start = 0;
+    UINT16 i_targetAddress = 0;
+
+    /* search for frame 1 start */
+    i_frame1Start = findFrame1Start( ps_slot->w_FrameSize, ps_slot->ab_FrameBuffer );
+
+    /* First octet & lower 2 bits of second octet contain the address, which is the
+     * producer for SPDOs and the addressed SN for SNMT and SSDO frames */
+    i_targetAddress = openSAFETY_FRAME_ADDRESS(ps_slot->ab_FrameBuffer, i_frame1Start);
+
+    /* A time request is sent by the consumer, it is routed to the producer in its TADR */
+    if ( ( ps_slot->e_telType == SHNF_k_SPDO ) && ( pb_scmUdid != NULL ) &&
+         openSAFETY_IS_SPDO_TREQ_FRAME_ID(ps_slot->ab_FrameBuffer[i_frame1Start + 1]) )
+        i_targetAddress = GetTimeRequestTadr ( ps_slot->ab_FrameBuffer );
+
+    /* Let's send the package on the network, routed by its type and address */
+    return ps_transport->pf_Send ( ps_slot->ab_FrameBuffer, ps_slot->w_FrameSize, ps_slot->e_telType, i_targetAddress );
+}
+
+/**
+ * This function drops the queued frame at the given position of the send queue.
+ *
+ * \note Has to be called with \see mutexTXBuffer locked
+ */
+static void DropQueuedFrame ( UINT16 w_pos )
+{
+    UINT16 w_slot = aw_txQueuedSlots[w_pos];
+
+    adw_txDropped[as_openSAFETYFrames[w_slot].e_telType]++;
+    ReleaseTxSlot ( w_slot );
+
+    w_txNumQueued--;
+    memmove ( &aw_txQueuedSlots[w_pos], &aw_txQueuedSlots[w_pos + 1],
+              ( w_txNumQueued - w_pos ) * sizeof(UINT16) );
+}
+
+/**
+ * This function appends a frame, which could not be sent, to the send queue. The
+ * policy of its telegram type decides, which frame is dropped if there is no room:
+ * - k_openSAFETY_TX_POLICY_OVERWRITE   - a queued SPDO of the same TxSPDO is always
+ *                                        replaced, else the oldest queued SPDO is dropped
+ * - k_openSAFETY_TX_POLICY_DROP_OLDEST - the oldest queued frame of the type is dropped
+ * - k_openSAFETY_TX_POLICY_DROP_NEWEST - the frame itself is dropped
+ *
+ * \note Has to be called with \see mutexTXBuffer locked
+ */
+static void QueueTxFrame ( UINT16 w_slot )
+{
+    pt_openSAFETY_BUFFER ps_slot = &as_openSAFETYFrames[w_slot];
+    UINT8 b_policy = GetTxPolicy ( ps_slot->e_telType );
+    UINT16 w_pos;
+    pt_openSAFETY_BUFFER ps_queued;
+
+    /* only the newest value of a TxSPDO is worth sending */
+    if ( b_policy == k_openSAFETY_TX_POLICY_OVERWRITE )
+    {
+        for ( w_pos = 0; w_pos < w_txNumQueued; w_pos++ )
+        {
+            ps_queued = &as_openSAFETYFrames[aw_txQueuedSlots[w_pos]];
+            if ( ( ps_queued->e_telType == ps_slot->e_telType ) &&
+                 ( ps_queued->w_txSpdoNum == ps_slot->w_txSpdoNum ) )
+            {
+                DropQueuedFrame ( w_pos );
+                break;
+            }
+        }
+    }
+
+    if ( ( w_txNumQueued >= k_openSAFETY_TX_QUEUE_DEPTH ) &&
+         ( b_policy != k_openSAFETY_TX_POLICY_DROP_NEWEST ) )
+    {
+        for ( w_pos = 0; w_pos < w_txNumQueued; w_pos++ )
+        {
+            if ( as_openSAFETYFrames[aw_txQueuedSlots[w_pos]].e_telType == ps_slot->e_telType )
+            {
+                DropQueuedFrame ( w_pos );
+                break;
+            }
+        }
+    }
+
+    if ( w_txNumQueued >= k_openSAFETY_TX_QUEUE_DEPTH )
+    {
+        adw_txDropped[ps_slot->e_telType]++;
+        ReleaseTxSlot ( w_slot );
+        return;
+    }
+
+    aw_txQueuedSlots[w_txNumQueued] = w_slot;
+    w_txNumQueued++;
+}
+
+/**
+ * This function sends all queued frames and then all marked frames, in the order
+ * they have been marked, and returns their slots to the pool once the transport
+ * has been flushed. Only the bytes written into a slot are cleared. Frames the
+ * transport does not accept are kept in the send queue, and no frame overtakes a
+ * queued one.
+ *
+ * \note Has to be called with \see mutexTXBuffer locked
+ */
+static void FlushTxFrames ( void )
+{
+    UINT16 w_pending;
+    UINT16 w_sent;
+    UINT16 w_slot;
+
+    /* retry the queued frames, until the transport refuses one again */
+    for ( w_sent = 0; w_sent < w_txNumQueued; w_sent++ )
+    {
+        if ( !SendTxSlot ( aw_txQueuedSlots[w_sent] ) )
+            break;
+        aw_txSentSlots[w_txNumSent] = aw_txQueuedSlots[w_sent];
+        w_txNumSent++;
+    }
+    if ( w_sent > 0 )
+    {
+        w_txNumQueued = (UINT16)( w_txNumQueued - w_sent );
+        memmove ( &aw_txQueuedSlots[0], &aw_txQueuedSlots[w_sent], w_txNumQueued * sizeof(UINT16) );
+    }
+
+    for ( w_pending = 0; w_pending < w_txNumPending; w_pending++ )
+    {
+        w_slot = aw_txPendingSlots[w_pending];
+
+        if ( ( w_txNumQueued == 0 ) && SendTxSlot ( w_slot ) )
+        {
+            aw_txSentSlots[w_txNumSent] = w_slot;
+            w_txNumSent++;
+        }
+        else
+            QueueTxFrame ( w_slot );
+    }
+
+    w_txNumPending = 0;
+
+    /* the transport may refer to the frames until it is flushed */
+    if ( ps_transport->pf_Flush != NULL )
+        ps_transport->pf_Flush();
+
+    for ( w_sent = 0; w_sent < w_txNumSent; w_sent++ )
+        ReleaseTxSlot ( aw_txSentSlots[w_sent] );
+    w_txNumSent = 0;
+}
+
+/**
+ * This function returns the number of frames of the given telegram type, which
+ * can be built in this application loop without running out of slots. Frames of
+ * a type, which is dropped rather than queued on congestion, are limited by the
+ * room left in the send queue as well.
+ */
+UINT16 SHNF_GetNumFreeTxFrames ( SHNF_t_TEL_TYPE e_telType )
+{
+    UINT16 w_ret;
+    UINT16 w_used;
+
+    LOCK_BUFFER( mutexTXBuffer );
+    w_ret = w_txNumFree;
+    if ( GetTxPolicy ( e_telType ) == k_openSAFETY_TX_POLICY_DROP_NEWEST )
+    {
+        w_used = (UINT16)( w_txNumQueued + w_txNumPending );
+        if ( w_used >= k_openSAFETY_TX_QUEUE_DEPTH )
+            w_ret = 0;
+        else if ( w_ret > ( k_openSAFETY_TX_QUEUE_DEPTH - w_used ) )
+            w_ret = (UINT16)( k_openSAFETY_TX_QUEUE_DEPTH - w_used );
+    }
+    UNLOCK_BUFFER( mutexTXBuffer );
+
+    return w_ret;
+}
+
+/**
+ * This function sends all frames, which have been marked with \see SHNF_MarkTxMemBlock
+ * since the last call, in the order they have been marked.
+ */
+void SHNF_FlushTxMemBlocks(void)
+{
+    LOCK_BUFFER( mutexTXBuffer );
+    FlushTxFrames();
+    UNLOCK_BUFFER( mutexTXBuffer );
+}
+
+/**
+ * This function hands out the next filled RX ring slot to the stack. The caller
+ * has to make sure, that a filled slot is available.
+ *
+ * \retval pw_frameLength the number of bytes for the received openSAFETY frame
+ * \retval e_telType the @see SHNF_t_TEL_TYPE type of the received openSAFETY frame
+ *
+ * \return pointer to the received openSAFETY frame, this is the pinned ring slot
+ */
+static UINT8 * CollectRxSlot(UINT16 *pw_frameLength, SHNF_t_TEL_TYPE *e_telType)
+{
+    UINT8 *pb_ret;
+    pt_openSAFETY_BUFFER queue;
+
+    /** Only the stack thread moves the read counter, the slot stays untouched by
+     *  the producer until it is released in SHNF_ReleaseEplsFrame */
+    queue = &s_rxRing.as_slots[s_rxRing.dw_read & k_RX_RING_MASK];
+    s_rxRing.dw_read++;
+
+    /** Setting the element as marked, indicating it was collected */
+    queue->o_marked = TRUE;
+
+    /** Hand out the slot, the frames have already been switched on insertion */
+    *pw_frameLength = queue->w_FrameSize;
+    *e_telType = queue->e_telType;
+    pb_ret = queue->ab_FrameBuffer;
+
+    return pb_ret;
+}
+
+/**
+ * This function returns a reference to a received openSAFETY frame.
+ *
+ * The reference points directly into the RX ring slot, which already holds the
+ * frame with sub-frame ONE first. The slot is not reused until the frame is handed
+ * back with \see SHNF_ReleaseEplsFrame, so the stack may deserialize it in place.
+ *
+ * \retval pw_frameLength the number of bytes for the received openSAFETY frame
+ * \retval e_telType the @see SHNF_t_TEL_TYPE type of the received openSAFETY frame
+ *
+ * \return - == NULL - no openSAFETY frame available
+ *         - != NULL - pointer to the received openSAFETY frame
+ */
+UINT8 * SHNF_GetEplsFrame(UINT16 *pw_frameLength, SHNF_t_TEL_TYPE *e_telType)
+{
+    /** Nothing to collect, if every filled slot has already been handed out */
+    if ( s_rxRing.dw_read == ATOMIC_LOAD_ACQUIRE( s_rxRing.dw_head ) )
+        return (UINT8 *)NULL;
+
+    return CollectRxSlot ( pw_frameLength, e_telType );
+}
+
+/**
+ * This function returns references to all received openSAFETY frames, up to the
+ * given number of frames.
+ *
+ * The available frames are determined once, frames arriving while the batch is
+ * processed are left for the next call. Every returned frame stays pinned in its
+ * RX ring slot until it is handed back with \see SHNF_ReleaseEplsFrames.
+ *
+ * \param b_maxFrames the maximum number of frames to be collected
+ * \retval as_frames array of at least @b b_maxFrames entries, receiving the frames
+ *
+ * \return the number of collected frames, 0 if no openSAFETY frame is available
+ */
+UINT8 SHNF_GetEplsFrames(SHNF_t_RX_FRAME as_frames[], UINT8 b_maxFrames)
+{
+    UINT32 dw_available;
+    UINT8 b_numFrames = 0U;
+
+    /** A single acquire of the producer counter covers the whole batch */
+    dw_available = ATOMIC_LOAD_ACQUIRE( s_rxRing.dw_head ) - s_rxRing.dw_read;
+    if ( dw_available < (UINT32)b_maxFrames )
+        b_maxFrames = (UINT8)dw_available;
+
+    while ( b_numFrames < b_maxFrames )
+    {
+        as_frames[b_numFrames].pb_frame = CollectRxSlot ( &as_frames[b_numFrames].w_frameLength,
+                &as_frames[b_numFrames].e_telType );
+        b_numFrames++;
+    }
+
+    return b_numFrames;
+}
+
+/**
+ * This function releases an EPLS frame which is no longer needed.
+ *
+ * \see SHNF_GetEplsFrame
+ */
+void SHNF_ReleaseEplsFrame(void)
+{
+    SHNF_ReleaseEplsFrames ( 1U );
+}
+
+/**
+ * This function releases the given number of collected EPLS frames, oldest first.
+ *
+ * \param b_numFrames the number of frames to be handed back to the RX ring
+ *
+ * \see SHNF_GetEplsFrames
+ */
+void SHNF_ReleaseEplsFrames(UINT8 b_numFrames)
+{
+    UINT32 dw_tail = s_rxRing.dw_tail;
+    UINT32 dw_collected = s_rxRing.dw_read - dw_tail;
+
+    DATA_LOGGER_DEBUG3 ( "Release :: t:[%u] r:[%u] h:[%u] \n", s_rxRing.dw_tail, s_rxRing.dw_read, s_rxRing.dw_head );
+
+    /** More frames released than collected, we have been called by mistake */
+    if ( (UINT32)b_numFrames > dw_collected )
+    {
+        DATA_LOGGER_DEBUG("Unexpected SHNF_ReleaseEplsFrame() call, all EPLS frame are already released\n");
+        b_numFrames = (UINT8)dw_collected;
+    }
+
+    /** The oldest collected slots are handed back to the producer */
+    while ( b_numFrames > 0U )
+    {
+        s_rxRing.as_slots[dw_tail & k_RX_RING_MASK].o_marked = FALSE;
+        dw_tail++;
+        b_numFrames--;
+    }
+
+    /** Publishing the tail once makes all slots of the batch reusable */
+    ATOMIC_STORE_RELEASE( s_rxRing.dw_tail, dw_tail );
+}
+
+
+/**
+ * @var SHNF_aaulConnValidBit
+ * @brief This variable contains the connection valid bit of the SPDOs.
+ *
+ * It is a bit field which contains one bit each RxSPDO. It is to be hosted by the SHNF.
+ */
+UINT32 SHNF_aaulConnValidBit[EPLS_cfg_MAX_INSTANCES][(SPDO_cfg_MAX_NO_RX_SPDO + 31) / 32];
+
+/**
+ * This function returns a CRC checksum over a sub frame with payload data of
+ * of maximum 8 bytes. The result is a 8 bit CRC.
+ *
+ * \param b_initCrc initial CRC (always called with 0 by the EPLS software)
+ * \param l_subFrameLength subframe length in bytes
+ * \param pv_subFrame reference to subframe
+ *
+ * \return 0 .. 255 - 8 bit CRC check sum
+ */
+UINT8 HNFiff_Crc8CalcSwp(UINT8 b_initCrc, INT32 l_subFrameLength,
+                         const void *pv_subFrame)
+{
+    return crc8Checksum(l_subFrameLength, (UINT8*)pv_subFrame, b_initCrc);
+}
+
+
+/**
+ * This function returns a CRC checksum over a sub frame with payload data of
+ * minimum 9 bytes and maximum 254 bytes. The result is a 16 bit CRC.
+ *
+ * \param w_initCrc initial CRC (always called with 0 by the EPLS software)
+ * \param l_subFrameLength subframe length in bytes
+ * \param pv_subFrame reference to subframe
+ *
+ * \return 0 .. 65535 - 16 bit CRC check sum
+ */
+UINT16 HNFiff_Crc16CalcSwp(UINT16 w_initCrc, INT32 l_subFrameLength,
+                           const void *pv_subFrame)
+{
+    return crc16Checksum(l_subFrameLength, (UINT8*)pv_subFrame, w_initCrc);
+}
+
+/**
+ * This function returns a CRC checksum over a sub frame with payload data of
+ * minimum 9 bytes and maximum 254 bytes. The result is a 16 bit CRC.
+ *
+ * \param w_initCrc initial CRC (always called with 0 by the EPLS software)
+ * \param l_subFrameLength subframe length in bytes
+ * \param pv_subFrame reference to subframe
+ *
+ * \return 0 .. 65535 - 16 bit CRC check sum
+ */
+UINT16 HNFiff_Crc16_755B_CalcSwp(UINT16 w_initCrc, INT32 l_subFrameLength,
+                                 const void *pv_subFrame)
+{
+    return crc16Checksum(l_subFrameLength, (UINT8*)pv_subFrame, w_initCrc);
+}
+
+/**
+ * This function returns the 8 bit CRC checksums over both sub frames of a
+ * frame, which carries its payload data in both sub frames, and compares the
+ * payload data in the same pass.
+ *
+ * \param l_hdrLength1 header length of sub frame ONE in bytes
+ * \param pv_subFrame1 reference to sub frame ONE
+ * \param l_hdrLength2 header length of sub frame TWO in bytes
+ * \param pv_subFrame2 reference to sub frame TWO
+ * \param l_dataLength payload data length of each sub frame in bytes
+ * \param pb_crc1 returns the CRC over sub frame ONE
+ * \param pb_crc2 returns the CRC over sub frame TWO
+ *
+ * \return TRUE if the payload data of both sub frames is identical
+ */
+BOOLEAN HNFiff_Crc8CalcDualSwp(INT32 l_hdrLength1, const void *pv_subFrame1,
+                               INT32 l_hdrLength2, const void *pv_subFrame2,
+                               INT32 l_dataLength, UINT8 *pb_crc1, UINT8 *pb_crc2)
+{
+    *pb_crc1 = 0U;
+    *pb_crc2 = 0U;
+    return crc8ChecksumDual(l_hdrLength1, (UINT8*)pv_subFrame1, l_hdrLength2, (UINT8*)pv_subFrame2,
+                            l_dataLength, pb_crc1, pb_crc2) ? TRUE : FALSE;
+}
+
+/**
+ * This function returns the 16 bit CRC checksums over both sub frames of a
+ * frame, which carries its payload data in both sub frames, and compares the
+ * payload data in the same pass.
+ *
+ * \param l_hdrLength1 header length of sub frame ONE in bytes
+ * \param pv_subFrame1 reference to sub frame ONE
+ * \param l_hdrLength2 header length of sub frame TWO in bytes
+ * \param pv_subFrame2 reference to sub frame TWO
+ * \param l_dataLength payload data length of each sub frame in bytes
+ * \param pw_crc1 returns the CRC over sub frame ONE
+ * \param pw_crc2 returns the CRC over sub frame TWO
+ *
+ * \return TRUE if the payload data of both sub frames is identical
+ */
+BOOLEAN HNFiff_Crc16_755B_CalcDualSwp(INT32 l_hdrLength1, const void *pv_subFrame1,
+                                      INT32 l_hdrLength2, const void *pv_subFrame2,
+                                      INT32 l_dataLength, UINT16 *pw_crc1, UINT16 *pw_crc2)
+{
+    *pw_crc1 = 0U;
+    *pw_crc2 = 0U;
+    return crc16ChecksumDual(l_hdrLength1, (UINT8*)pv_subFrame1, l_hdrLength2, (UINT8*)pv_subFrame2,
+                             l_dataLength, pw_crc1, pw_crc2) ? TRUE : FALSE;
+}
+
+/**
+ * This function checks a received frame, determines its telegram type and the
+ * start of sub-frame ONE. SNMT and SSDO frames addressed to other SNs are discarded.
+ *
+ * \param pb_frame the received data, sub-frame TWO first
+ * \param ui_numberOfBytes the length of the received data
+ * \retval pw_frame1Pos the start of sub-frame ONE
+ * \retval pe_telType the telegram type of the frame
+ *
+ * \return - TRUE  - the frame is to be passed to the stack
+ *         - FALSE - the frame is discarded
+ */
+static BOOLEAN ClassifyRxFrame ( const UINT8 * pb_frame, UINT16 ui_numberOfBytes,
+                                 UINT16 * pw_frame1Pos, SHNF_t_TEL_TYPE * pe_telType )
+{
+    UINT16 b_ADDR, frame1Pos;
+    SHNF_t_TEL_TYPE e_telType;
+
+    /** Empty frames and frames not fitting into a slot can not be valid openSAFETY frames */
+    if ( ( ui_numberOfBytes == 0 ) || ( ui_numberOfBytes > k_openSAFETY_BUFFER_SIZE ) )
+    {
+        DATA_LOGGER_DEBUG1 ( "Discarding frame, size of %d bytes does not fit the RX slot size!\n", ui_numberOfBytes );
+        return FALSE;
+    }
+
+    /** Find position of the first frame */
+    frame1Pos = findFrame1Start ( ui_numberOfBytes, pb_frame );
+    /** Frame 1 Position can never be negative (UINT16), but we check anyway to be on the safe side */
+    if ( frame1Pos <= 0 )
+    {
+        /* No frame position has been found, returning */
+        DATA_LOGGER_DEBUG ( "Discarding frame, as no position for frame 1 has been found!\n" );
+        return FALSE;
+    }
+
+    /** Address field */
+    b_ADDR = openSAFETY_FRAME_ADDRESS (pb_frame, frame1Pos );
+
+    /* Initializing the telType for windows cl compiler only */
+    e_telType = SHNF_k_SNMT;
+    /* Determine telegram type */
+    if ( openSAFETY_IS_SLIM_SSDO_FRAME_ID(pb_frame[ ( frame1Pos + 1 ) ]) )
+        e_telType = SHNF_k_SSDO_SLIM;
+    else if ( openSAFETY_IS_SSDO_FRAME_ID(pb_frame[ ( frame1Pos + 1 ) ]) )
+        e_telType = SHNF_k_SSDO;
+    else if ( openSAFETY_IS_SPDO_FRAME_ID(pb_frame[ ( frame1Pos + 1 ) ]) )
+        e_telType = SHNF_k_SPDO;
+    else if ( openSAFETY_IS_SNMT_FRAME_ID(pb_frame[ ( frame1Pos + 1 ) ]) )
+        e_telType = SHNF_k_SNMT;
+    else
+    {
+        /* Telegram Type can not be resolved, invalid package, break */
+        return FALSE;
+    }
+
+    /* If we are the sender of the SPDO package, discard the package,
+     * can't be moved before above if/else because, otherwise get's
+     * wrongly used for ssdo and ssdo slim */
+    if ( ( e_telType != SHNF_k_SPDO ) && ( b_ADDR != w_LoopBackSadr ) )
+    {
+        return FALSE;
+    }
+
+    *pw_frame1Pos = frame1Pos;
+    *pe_telType = e_telType;
+    return TRUE;
+}
+
+/**
+ * This function writes the received information into the RX buffer from where it
+ * can later be processed by the stack.
+ *
+ * \param c_receivingBuffer the buffer containing the received data
+ * \param ui_numberOfBytes the length of the received data
+ */
+void InsertIntoRXBuffer ( const UINT8 * c_receivingBuffer, UINT16 ui_numberOfBytes )
+{
+    pt_openSAFETY_BUFFER queue;    /* Queue worker variable */
+    UINT16 frame1Pos;
+    UINT32 dw_head;
+    SHNF_t_TEL_TYPE e_telType;
+
+    if ( !ClassifyRxFrame ( c_receivingBuffer, ui_numberOfBytes, &frame1Pos, &e_telType ) )
+        return;
+
+    SHNF_TRACE_FRAME ( k_TRACE_DIR_RX, e_telType, c_receivingBuffer, ui_numberOfBytes );
+
+    /** Only this thread moves the head, the tail is moved by the stack */
+    dw_head = s_rxRing.dw_head;
+
+    /** All slots are either waiting for the stack or have been collected but not
+     *  released yet, we cannot override, so print error and return. */
+    if ( ( dw_head - ATOMIC_LOAD_ACQUIRE( s_rxRing.dw_tail ) ) >= k_openSAFETY_RX_RING_SIZE )
+    {
+        DATA_LOGGER_DEBUG ( "Error inserting into RX buffer, all slots are allocated!\n" );
+        return;
+    }
+
+    /** Filling the queue element */
+    queue = &s_rxRing.as_slots[dw_head & k_RX_RING_MASK];
+    queue->o_allocated = FALSE;
+    queue->o_marked = FALSE;
+    queue->w_FrameSize = ui_numberOfBytes;
+    queue->e_telType = e_telType;
+
+    /** Copying receive buffer into the slot with frame 1 first, afterwards it can be freed.
+     *  This is the only copy on the receive path, the stack works on the slot itself */
+    copySwitchedFrames ( ui_numberOfBytes, frame1Pos, c_receivingBuffer, queue->ab_FrameBuffer );
+
+    /** Publishing the slot to the stack thread */
+    ATOMIC_STORE_RELEASE( s_rxRing.dw_head, dw_head + 1 );
+
+    /** Waking up the application loop */
+    SHNF_SignalRxEvent();
+}
+
+/**
+ * This function returns free RX ring slots, to receive frames directly into.
+ */
+UINT32 SHNF_AcquireRxSlots ( UINT8 * apb_buffers[], UINT32 dw_maxSlots )
+{
+    UINT32 dw_head;
+    UINT32 dw_numFree;
+    UINT32 i;
+
+    /** Only the receiving thread moves the head, the tail is moved by the stack */
+    dw_head = s_rxRing.dw_head;
+    dw_numFree = k_openSAFETY_RX_RING_SIZE - ( dw_head - ATOMIC_LOAD_ACQUIRE( s_rxRing.dw_tail ) );
+    if ( dw_numFree > dw_maxSlots )
+        dw_numFree = dw_maxSlots;
+
+    /** The free slots following the head are the receiving buffers */
+    for ( i = 0; i < dw_numFree; i++ )
+        apb_buffers[i] = s_rxRing.as_slots[( dw_head + i ) & k_RX_RING_MASK].ab_FrameBuffer;
+
+    return dw_numFree;
+}
+
+/**
+ * This function hands frames, received into the acquired RX ring slots, to the stack.
+ */
+UINT32 SHNF_CommitRxSlots ( const UINT16 aw_lengths[], UINT32 dw_numSlots )
+{
+    pt_openSAFETY_BUFFER ps_slot;
+    pt_openSAFETY_BUFFER ps_target;
+    UINT32 dw_head;
+    UINT32 dw_accepted = 0;
+    UINT32 i;
+    UINT16 frame1Pos;
+    SHNF_t_TEL_TYPE e_telType;
+
+    dw_head = s_rxRing.dw_head;
+
+    /** Accepted frames are kept in reception order. A frame following a discarded
+     *  one is moved down to close the gap, all others stay in their slot */
+    for ( i = 0; i < dw_numSlots; i++ )
+    {
+        ps_slot = &s_rxRing.as_slots[( dw_head + i ) & k_RX_RING_MASK];
+
+        if ( !ClassifyRxFrame ( ps_slot->ab_FrameBuffer, aw_lengths[i], &frame1Pos, &e_telType ) )
+            continue;
+
+        SHNF_TRACE_FRAME ( k_TRACE_DIR_RX, e_telType, ps_slot->ab_FrameBuffer, aw_lengths[i] );
+
+        /** The stack works on the slot itself, with frame 1 first */
+        switchFramesInPlace ( aw_lengths[i], frame1Pos, ps_slot->ab_FrameBuffer );
+
+        ps_target = &s_rxRing.as_slots[( dw_head + dw_accepted ) & k_RX_RING_MASK];
+        if ( ps_target != ps_slot )
+            memcpy ( ps_target->ab_FrameBuffer, ps_slot->ab_FrameBuffer, aw_lengths[i] );
+
+        ps_target->o_allocated = FALSE;
+        ps_target->o_marked = FALSE;
+        ps_target->w_FrameSize = aw_lengths[i];
+        ps_target->e_telType = e_telType;
+        dw_accepted++;
+    }
+
+    if ( dw_accepted > 0 )
+    {
+        /** Publishing the slots of the batch to the stack thread */
+        ATOMIC_STORE_RELEASE( s_rxRing.dw_head, dw_head + dw_accepted );
+
+        /** Waking up the application loop */
+        SHNF_SignalRxEvent();
+    }
+
+    return dw_accepted;
+}
+
+/*
+ * \brief This function determines the position of the start of Frame 1, always assuming,
+ * frame 1 starts AFTER frame 2.
+ *
+ * This function determines the position of the start of Frame 1, always assuming,
+ * frame 1 starts AFTER frame 2. Please note, that the assumed position is always a
+ * guess. To be completely sure, the CRC checksum of frame 1 should be checked,
+ * this would normally result in correct detection.
+ *
+ * However, using EPL as SHNF protocol, SoC packages also get detected sometimes.
+ * This just to remind, that this detection might result in a wrongly detected
+ * byte stream, and the result has to be checked further down the line.
+ *
+ * \warning This function ALWAYS assumes, that Frame 2 is stored before Frame 1, and the
+ * result is ALWAYS a guess, never a proven fact.
+ *
+ * \param i_dataLength   the length of data in the given bytestream
+ * \param pb_byteStream  the bytefield containing the frame data
+ *
+ * \return a value indicating the byte position in the stream where frame 1 starts, or -1 in case of an error
+ */
+UINT16 findFrame1Start ( UINT16 i_dataLength, const UINT8 pb_byteStream[] )
+{
+    UINT16 i_wFrame1Position, i_payloadLength, i_calculatedLength, i_offset = 0;
+    UINT8 b_tempByte = 0;
+
+    /*
+     * First, a normal package is assumed. Calculation of frame 1 position is
+     * pretty easy, because the length of the whole package is 11 + 2*n + 2*o, which
+     * results in frame 1 start at (6 + n + o), which is length / 2 + 1
+     */
+    i_wFrame1Position = i_dataLength / 2 + 1;
+
+    /* Two bytes from starting position will be the payload length */
+    i_payloadLength = pb_byteStream [ i_wFrame1Position + 2 ];
+
+    /* Calculating the assumed frame length, taking CRC8/CRC16 into account */
+    i_calculatedLength = i_payloadLength * 2 + k_openSAFETY_MIN_FRAME_LENGTH + 2 * (i_payloadLength > 8 ? 1 : 0);
+
+    /* If the calculated length differs from the given length, this might be a slim package */
+    if ( i_calculatedLength != i_dataLength )
+    {
+        /*
+         * This is a possible slim package. Resetting the position for frame 1 to zero. If
+         * this is not a slim package, frame 1 position zero indicates that the search for
+         * the frame position was not successful
+         */
+        i_wFrame1Position = 0;
+
+        /*
+         * Slim packages have a fixed sublength of either 6 bytes for frame 2 in
+         * case of crc8 and 7 bytes in case of crc16. In case of CRC8, the maximum
+         * length of frame 2 is therefore 19 (5 + 6 + 8).
+         */
+        i_offset = k_openSAFETY_MIN_FRAME_2_LENGTH + ( i_dataLength < 20 ? 0 : 1 );
+
+        /*
+         *  Last 2 digits belong to addr, therefore have to be cleared, the 3rd last digit indicates request or
+         * response. To ease detection, we clear it as well
+         */
+        b_tempByte = ( pb_byteStream [ i_offset + 1 ] >> 3 ) << 3;
+
+        /* If the tempByte is a correct slim ssdo frame id, we have a slim package */
+        if ( openSAFETY_IS_SLIM_SSDO_FRAME_ID( b_tempByte ) )
+        {
+            /* Slim package found at offset i_offset */
+            i_wFrame1Position = i_offset;
+        }
+    }
+
+#if DATA_LOGGER_PRINT_DEBUG
+    /** Catching the error for debuging purposes */
+    if ( i_wFrame1Position >= i_dataLength )
+    {
+        DATA_LOGGER_DEBUG3("findFrame1Start returned an unusual value: %d\nBytes: %s\n",
+                i_wFrame1Position, format_bytes( (UINT8 *)pb_byteStream, i_dataLength ) );
+    }
+#endif
+
+    /* If either the found position is 0 or bigger than the given length, 0 get's returned */
+    if ( i_wFrame1Position == 0 || i_wFrame1Position >= i_dataLength )
+        return (UINT16) 0;
+
+    return i_wFrame1Position;
+}
+
+/**
+ * \brief This function copies the given bytestream into the target buffer, switching
+ * the second openSAFETY frame with the first
+ *
+ * \warning This function ALWAYS assumes, that Frame 2 is stored before Frame 1
+ *
+ * \param i_dataLength        the length of data in the given bytestream
+ * \param i_wFrame1Position   the start of frame 1, as returned by \see findFrame1Start
+ * \param pb_byteStream       the bytefield containing the frame data
+ * \retval pb_target          a bytefield of at least @b i_dataLength bytes
+ */
+void copySwitchedFrames ( UINT16 i_dataLength, UINT16 i_wFrame1Position,
+                          const UINT8 pb_byteStream[], UINT8 pb_target[] )
+{
+    /** if the frame position is zero (< just to be on safe side, as impossible (UINT)), or
+     *  the frame position is greater than the datalength provided (indicating an error in
+     *  the detection algorithm), we return the provided bytestream as-is. */
+    if ( i_wFrame1Position <= 0 || i_wFrame1Position >= i_dataLength )
+    {
+        /** No valid frame position has been found, the frame will be returned as-is */
+        memcpy ( pb_target, pb_byteStream, i_dataLength);
+    }
+    else
+    {
+        /** a valid frame position has been found, the frames will be switched */
+        memcpy ( pb_target, (pb_byteStream + i_wFrame1Position ), ( i_dataLength - i_wFrame1Position ) );
+        memcpy ( (pb_target + ( i_dataLength - i_wFrame1Position ) ), pb_byteStream, i_wFrame1Position );
+    }
+}
+
+/**
+ * \brief This function switches the second openSAFETY frame with the first, inside
+ * the given bytestream
+ *
+ * The two parts are rotated by reversing each of them and then the whole stream,
+ * so no second buffer is needed.
+ *
+ * \warning This function ALWAYS assumes, that Frame 2 is stored before Frame 1
+ *
+ * \param i_dataLength        the length of data in the given bytestream
+ * \param i_wFrame1Position   the start of frame 1, as returned by \see findFrame1Start
+ * \param pb_byteStream       the bytefield containing the frame data
+ */
+void switchFramesInPlace ( UINT16 i_dataLength, UINT16 i_wFrame1Position, UINT8 pb_byteStream[] )
+{
+    UINT16 i_first, i_last;
+    UINT8 b_tempByte;
+    UINT16 ai_bounds[3][2];
+    UINT8 b_part;
+
+    /** No valid frame position, the frame is left as-is */
+    if ( i_wFrame1Position <= 0 || i_wFrame1Position >= i_dataLength )
+        return;
+
+    ai_bounds[0][0] = 0;
+    ai_bounds[0][1] = i_wFrame1Position - 1;
+    ai_bounds[1][0] = i_wFrame1Position;
+    ai_bounds[1][1] = i_dataLength - 1;
+    ai_bounds[2][0] = 0;
+    ai_bounds[2][1] = i_dataLength - 1;
+
+    for ( b_part = 0; b_part < 3; b_part++ )
+    {
+        i_first = ai_bounds[b_part][0];
+        i_last = ai_bounds[b_part][1];
+        while ( i_first < i_last )
+        {
+            b_tempByte = pb_byteStream[i_first];
+            pb_byteStream[i_first] = pb_byteStream[i_last];
+            pb_byteStream[i_last] = b_tempByte;
+            i_first++;
+            i_last--;
+        }
+    }
+}
+
+void SHNF_SignalLostFrame ( SHNF_t_TEL_TYPE e_telType, UINT16 w_adr )
+{
+    UINT16 w_pos;
+
+    LOCK_BUFFER(mutexLostFrames);
+    if ( w_lostFramesCount < k_LOST_FRAME_QUEUE_SIZE )
+    {
+        w_pos = ( w_lostFramesRead + w_lostFramesCount ) % k_LOST_FRAME_QUEUE_SIZE;
+        as_lostFrames[w_pos].e_telType = e_telType;
+        as_lostFrames[w_pos].w_adr = w_adr;
+        w_lostFramesCount++;
+    }
+    /** Without report the request is repeated after its response timeout */
+    UNLOCK_BUFFER(mutexLostFrames);
+}
+
+BOOLEAN SHNF_GetLostFrame ( SHNF_t_TEL_TYPE * pe_telType, UINT16 * pw_adr )
+{
+    BOOLEAN o_found = FALSE;
+
+    LOCK_BUFFER(mutexLostFrames);
+    if ( w_lostFramesCount > 0 )
+    {
+        *pe_telType = as_lostFrames[w_lostFramesRead].e_telType;
+        *pw_adr = as_lostFrames[w_lostFramesRead].w_adr;
+        w_lostFramesRead = ( w_lostFramesRead + 1 ) % k_LOST_FRAME_QUEUE_SIZE;
+        w_lostFramesCount--;
+        o_found = TRUE;
+    }
+    UNLOCK_BUFFER(mutexLostFrames);
+
+    return o_found;
+}
+
+/**
+ * \brief Closes the connection of the transport and prints the statistics
+ */
+void SHNF_CleanUp()
+{
+   // CleanUpSocket();
+   SHNF_PrintEventStatistics();
+   DATA_LOGGER4("TX frames dropped : SPDO %u SSDO %u SSDO slim %u SNMT %u\n",
+           adw_txDropped[SHNF_k_SPDO], adw_txDropped[SHNF_k_SSDO],
+           adw_txDropped[SHNF_k_SSDO_SLIM], adw_txDropped[SHNF_k_SNMT]);
+   if ( ps_transport != NULL )
+   {
+       if ( ps_transport->pf_PrintStatistics != NULL )
+           ps_transport->pf_PrintStatistics();
+       if ( ps_transport->pf_Stop != NULL )
+           ps_transport->pf_Stop();
+   }
+   /* the transport is stopped, no frame is traced anymore */
+   (void)SHNF_TraceDumpPcap ( NULL );
+   SHNF_TraceStop();
+   SHNF_CleanUpEventLoop();
+}
@@ -0,0 +1,149 @@
+#ifndef SHNFMSG_H
+#define SHNFMSG_H
+
+#include "EPLStarget.h"
+
+#include "EPLScfg.h"
+#include "EPLStypes.h"
+
+#include "SHNF.h"
+#include "SHNF_Definitions.h"
+
+#include "SHNFTransport.h"
+#include "EventLoop.h"
+
+/* Reference to a received openSAFETY frame, as handed out by SHNF_GetEplsFrames */
+typedef struct
+{
+    UINT8            *pb_frame;       /* the received frame, sub-frame ONE first */
+    UINT16            w_frameLength;  /* number of bytes of the received frame */
+    SHNF_t_TEL_TYPE   e_telType;      /* telegram type of the received frame */
+} SHNF_t_RX_FRAME;
+
+void InsertIntoRXBuffer ( const UINT8 * c_receivingBuffer, UINT16 ui_numberOfBytes );
+
+UINT8 * SHNF_GetTxMemBlock(BYTE_B_INSTNUM_ UINT16 w_blockSize, SHNF_t_TEL_TYPE e_telType, UINT16 w_txSpdoNum);
+
+/* Send queue policies, see k_openSAFETY_TX_POLICY_SPDO and friends in SHNF_Definitions.h */
+#define k_openSAFETY_TX_POLICY_DROP_NEWEST  1 /* the frame not fitting into the queue is dropped */
+#define k_openSAFETY_TX_POLICY_DROP_OLDEST  2 /* the oldest queued frame of the same type is dropped */
+#define k_openSAFETY_TX_POLICY_OVERWRITE    3 /* a queued SPDO of the same TxSPDO is replaced */
+
+/**
+ * \brief This function returns the number of frames of the given telegram type,
+ * which can be built in this application loop.
+ *
+ * While the transport does not accept frames, they are kept in a bounded send
+ * queue. The application uses this number to limit the free frames passed to the
+ * stack, so the stack throttles its production instead of \see SHNF_GetTxMemBlock
+ * running out of memory blocks.
+ *
+ * \param e_telType telegram type (SPDO / SSDO / SNMT)
+ *
+ * \return the number of frames, which can be built
+ */
+UINT16 SHNF_GetNumFreeTxFrames ( SHNF_t_TEL_TYPE e_telType );
+
+/**
+ * \brief This function reports a frame the transport failed to deliver.
+ *
+ * It is called by the thread of the transport. The reports are kept in a bounded queue
+ * until \see SHNF_GetLostFrame collects them, further reports are discarded while
+ * it is full.
+ *
+ * \param e_telType telegram type of the frame
+ * \param w_adr     ADR field of sub-frame ONE of the frame
+ */
+void SHNF_SignalLostFrame ( SHNF_t_TEL_TYPE e_telType, UINT16 w_adr );
+
+/**
+ * \brief This function returns the oldest report of a frame the transport failed
+ * to deliver, see \see SHNF_SignalLostFrame.
+ *
+ * \retval pe_telType telegram type of the frame
+ * \retval pw_adr     ADR field of sub-frame ONE of the frame
+ *
+ * \return - TRUE  - a report was returned
+ *         - FALSE - no frame was reported lost
+ */
+BOOLEAN SHNF_GetLostFrame ( SHNF_t_TEL_TYPE * pe_telType, UINT16 * pw_adr );
+
+/**
+ * \brief This function transmits all frames marked by \see SHNF_MarkTxMemBlock since
+ * the last call, in the order they have been marked.
+ *
+ * Has to be called once per application loop, after all frames have been built.
+ */
+void SHNF_FlushTxMemBlocks(void);
+
+/**
+ * \brief This function initializes the SHNF interface and starts the transport,
+ * see \see SHNF_SelectTransport. The stack must not be started, if it fails.
+ *
+ * \param w_loopBackSadr - loop back source address
+ *
+ * \return - TRUE  - the transport is started
+ *         - FALSE - no transport is available or it could not be started
+ */
+BOOLEAN SHNF_Init(BYTE_B_INSTNUM_ UINT16 w_loopBackSadr);
+
+/**
+ * \brief This function subscribes to the SPDOs of all producers configured in the
+ * RxSPDO communication parameters, and to the time requests addressed to the SADRs
+ * configured in the TxSPDO communication parameters.
+ *
+ * Has to be called after the SOD is initialized, and again whenever the parameters
+ * may have changed, e.g. on the transition to OPERATIONAL. Transports without
+ * subscriptions receive all SPDOs anyway.
+ */
+void SHNF_SubscribeRxSpdoSources(BYTE_B_INSTNUM);
+
+/**
+ * This function returns a reference to a received openSAFETY frame.
+ *
+ * The reserved space for each received frame can be freed by calling the
+ * \see SHNF_ReleaseEplsFrame function. Until then the returned reference stays
+ * valid and may be modified by the stack, the frame is stored with sub-frame ONE first.
+ *
+ * \retval pw_frameLength the number of bytes for the received openSAFETY frame
+ * \retval e_telType the @see SHNF_t_TEL_TYPE type of the received openSAFETY frame
+ *
+ * \return - == NULL - no openSAFETY frame available
+ *         - != NULL - pointer to the received openSAFETY frame
+ */
+UINT8 * SHNF_GetEplsFrame(UINT16 *pw_frameLength, SHNF_t_TEL_TYPE *e_telType);
+
+/**
+ * This function returns references to all received openSAFETY frames, up to the
+ * given number of frames.
+ *
+ * The frames are handed out in the order of reception and stay valid until they
+ * are freed by calling the \see SHNF_ReleaseEplsFrames function.
+ *
+ * \param b_maxFrames the maximum number of frames to be collected
+ * \retval as_frames array of at least @b b_maxFrames entries, receiving the frames
+ *
+ * \return the number of collected frames, 0 if no openSAFETY frame is available
+ */
+UINT8 SHNF_GetEplsFrames(SHNF_t_RX_FRAME as_frames[], UINT8 b_maxFrames);
+
+/**
+ * \brief This function releases an EPLS frame which is no longer needed.
+ * \see SHNF_GetEplsFrame
+ */
+void SHNF_ReleaseEplsFrame(void);
+
+/**
+ * \brief This function releases the given number of EPLS frames which are no longer needed.
+ *
+ * \param b_numFrames the number of frames, as returned by \see SHNF_GetEplsFrames
+ */
+void SHNF_ReleaseEplsFrames(UINT8 b_numFrames);
+
+/**
+ * \brief This function provides cleanup functionality for the network interface.
+ */
+void SHNF_CleanUp();
+
+
+#endif
@@ -0,0 +1,235 @@
+/*
+ * \file SHNF_Common/ProcessImage.c
+ * Double buffered process image of the SPDOs, see \file ProcessImage.h
+ *
+ * The sequence counter of an image counts the images published, the front buffer
+ * is the buffer ( dw_seq & 1 ). The writer fills the buffer ( dw_seq + 1 ) & 1,
+ * which is the front buffer of the image before, and stores dw_seq + 1 with
+ * release semantics. A reader loads the counter with acquire semantics, copies the
+ * front buffer and loads the counter again. It retries, if the counter changed,
+ * as the writer may have started to fill the buffer copied.
+ *
+ * The writer issues a release fence before filling the buffer, so a reader, who
+ * copied any byte of the new data, also sees the counter of the image before and
+ * retries.
+ *
+ * The images of all instances are held in two arrays, the main instance has
+ * SPDO_cfg_MAX_NO_xX_SPDO images, every other instance SPDO_cfg_MAX_NO_xX_SPDO_SDG.
+ * The buffers are padded to multiples of CACHE_LINE_SIZE.
+ *
+ * If SPDO_cfg_TX_DATA_CHANGE_TRACKING is enabled, the writer of a Tx image sets the
+ * bit of the Tx SPDO in a change set, if the data differs from the image before.
+ * The stack takes the set word by word with an atomic exchange, so no change gets
+ * lost between the threads.
+ */
+#include "ProcessImage.h"
+
+#include <string.h>
+
+#include "SHNF.h"
+#include "SHNF_Definitions.h"
+#include "SHNFBufferHandling.h"
+
+#if (SPDO_cfg_PROCESS_IMAGE == EPLS_k_ENABLE)
+
+#if (SPDO_cfg_MAX_NO_RX_SPDO != 0)
+#define k_PI_NO_RX       SPDO_cfg_MAX_NO_RX_SPDO
+#define k_PI_NO_RX_SDG   SPDO_cfg_MAX_NO_RX_SPDO_SDG
+#define k_PI_RX_LEN      SPDO_cfg_MAX_LEN_OF_RX_SPDO
+#else
+#define k_PI_NO_RX       1
+#define k_PI_NO_RX_SDG   0
+#define k_PI_RX_LEN      0
+#endif
+
+#if (SPDO_cfg_MAX_NO_TX_SPDO != 0)
+#define k_PI_NO_TX       SPDO_cfg_MAX_NO_TX_SPDO
+#define k_PI_NO_TX_SDG   SPDO_cfg_MAX_NO_TX_SPDO_SDG
+#define k_PI_TX_LEN      SPDO_cfg_MAX_LEN_OF_TX_SPDO
+#else
+#define k_PI_NO_TX       1
+#define k_PI_NO_TX_SDG   0
+#define k_PI_TX_LEN      0
+#endif
+
+/* Number of images of all instances, the main instance has k_PI_NO_xX images, the others k_PI_NO_xX_SDG */
+#define k_PI_ALL_RX      ( k_PI_NO_RX + ( EPLS_cfg_MAX_INSTANCES - 1 ) * k_PI_NO_RX_SDG )
+#define k_PI_ALL_TX      ( k_PI_NO_TX + ( EPLS_cfg_MAX_INSTANCES - 1 ) * k_PI_NO_TX_SDG )
+
+/* Maximum length of an image */
+#define k_PI_MAX_LEN     ( ( k_PI_RX_LEN > k_PI_TX_LEN ) ? k_PI_RX_LEN : k_PI_TX_LEN )
+
+/* Size of a buffer, the length of the image and the data, rounded up to full cache lines */
+#define k_PI_BUFFER_SIZE ( ( ( 1 + k_PI_MAX_LEN ) + CACHE_LINE_SIZE - 1 ) / CACHE_LINE_SIZE * CACHE_LINE_SIZE )
+
+/* A buffer of an image */
+typedef struct
+{
+    UINT8 b_len;
+    UINT8 ab_data[k_PI_BUFFER_SIZE - 1];
+} t_PI_BUFFER;
+
+/* An image */
+typedef struct
+{
+    /* number of images published, the front buffer is dw_seq & 1 */
+    volatile UINT32 dw_seq;
+    /* dw_seq of the image last fetched by the stack, only used for Tx images */
+    UINT32 dw_fetched;
+    UINT8 ab_pad[CACHE_LINE_SIZE - 2 * sizeof(UINT32)];
+    t_PI_BUFFER as_buf[2];
+} t_PI_IMAGE;
+
+static t_PI_IMAGE as_rxImages[k_PI_ALL_RX];
+static t_PI_IMAGE as_txImages[k_PI_ALL_TX];
+
+#if (SPDO_cfg_TX_DATA_CHANGE_TRACKING == EPLS_k_ENABLE)
+/* Number of words of the change set */
+#define k_PI_TX_SET_WORDS ( ( k_PI_NO_TX + 31 ) / 32 )
+
+/* Tx images changed since the stack took the set, bit ( idx % 32 ) of word ( idx / 32 ) */
+static volatile UINT32 aadw_txChanged[EPLS_cfg_MAX_INSTANCES][k_PI_TX_SET_WORDS];
+#endif
+
+/*
+ * This function returns the image of an SPDO, NULL if the instance or the index
+ * is invalid. The images of the instance follow the images of the instances before,
+ * like the SPDO structures of the stack.
+ */
+static t_PI_IMAGE * GetImage ( UINT8 b_instNum, UINT8 b_dir, UINT16 w_spdoIdx )
+{
+    t_PI_IMAGE * ps_image = (t_PI_IMAGE *)NULL;
+    UINT32 dw_noMain = ( b_dir == k_PI_RX ) ? k_PI_NO_RX : k_PI_NO_TX;
+    UINT32 dw_noSdg = ( b_dir == k_PI_RX ) ? k_PI_NO_RX_SDG : k_PI_NO_TX_SDG;
+    UINT32 dw_pos;
+
+    if ( ( b_instNum < EPLS_cfg_MAX_INSTANCES ) &&
+         ( w_spdoIdx < ( ( b_instNum == 0 ) ? dw_noMain : dw_noSdg ) ) )
+    {
+        dw_pos = ( b_instNum == 0 ) ? w_spdoIdx : ( dw_noMain + ( b_instNum - 1U ) * dw_noSdg + w_spdoIdx );
+
+        if ( b_dir == k_PI_RX )
+            ps_image = &as_rxImages[dw_pos];
+        else if ( b_dir == k_PI_TX )
+            ps_image = &as_txImages[dw_pos];
+    }
+
+    return ps_image;
+}
+
+UINT8 SHNF_ReadProcessImage ( UINT8 b_instNum, UINT8 b_dir, UINT16 w_spdoIdx,
+                              void * pv_data, UINT8 b_size, UINT32 * pdw_seq )
+{
+    t_PI_IMAGE * ps_image = GetImage ( b_instNum, b_dir, w_spdoIdx );
+    const t_PI_BUFFER * ps_front;
+    UINT32 dw_seq = 0;
+    UINT8 b_len = 0;
+    UINT8 b_copy;
+
+    if ( ps_image != NULL )
+    {
+        do
+        {
+            dw_seq = ATOMIC_LOAD_ACQUIRE ( ps_image->dw_seq );
+            ps_front = &ps_image->as_buf[dw_seq & 1U];
+
+            b_len = ps_front->b_len;
+            /* the length may be torn, it is limited to the buffer for the copy */
+            if ( b_len > k_PI_MAX_LEN )
+                b_len = k_PI_MAX_LEN;
+            b_copy = ( b_len < b_size ) ? b_len : b_size;
+            memcpy ( pv_data, ps_front->ab_data, b_copy );
+
+            ATOMIC_FENCE_ACQUIRE ();
+        } while ( ps_image->dw_seq != dw_seq );
+    }
+
+    if ( pdw_seq != NULL )
+        *pdw_seq = dw_seq;
+
+    return b_len;
+}
+
+BOOLEAN SHNF_WriteProcessImage ( UINT8 b_instNum, UINT8 b_dir, UINT16 w_spdoIdx,
+                                 const void * pv_data, UINT8 b_len )
+{
+    t_PI_IMAGE * ps_image = GetImage ( b_instNum, b_dir, w_spdoIdx );
+    t_PI_BUFFER * ps_back;
+    UINT32 dw_seq;
+#if (SPDO_cfg_TX_DATA_CHANGE_TRACKING == EPLS_k_ENABLE)
+    BOOLEAN o_changed;
+#endif
+
+    if ( ( ps_image == NULL ) || ( b_len > k_PI_MAX_LEN ) )
+        return FALSE;
+
+    /* the counter is only written by this thread */
+    dw_seq = ps_image->dw_seq + 1U;
+    ps_back = &ps_image->as_buf[dw_seq & 1U];
+
+#if (SPDO_cfg_TX_DATA_CHANGE_TRACKING == EPLS_k_ENABLE)
+    /* the front buffer is only written by this thread, it is compared without retry */
+    o_changed = ( b_dir == k_PI_TX ) &&
+                ( ( ps_image->as_buf[( dw_seq - 1U ) & 1U].b_len != b_len ) ||
+                  ( memcmp ( ps_image->as_buf[( dw_seq - 1U ) & 1U].ab_data, pv_data, b_len ) != 0 ) );
+#endif
+
+    ATOMIC_FENCE_RELEASE ();
+    ps_back->b_len = b_len;
+    memcpy ( ps_back->ab_data, pv_data, b_len );
+
+    ATOMIC_STORE_RELEASE ( ps_image->dw_seq, dw_seq );
+
+#if (SPDO_cfg_TX_DATA_CHANGE_TRACKING == EPLS_k_ENABLE)
+    /* the change is signaled after the image is published, so the stack fetches it */
+    if ( o_changed )
+        (void) ATOMIC_FETCH_OR ( aadw_txChanged[b_instNum][w_spdoIdx / 32U],
+                                 (UINT32)( 1UL << ( w_spdoIdx % 32U ) ) );
+#endif
+
+    return TRUE;
+}
+
+void SHNF_PublishRxImage ( BYTE_B_INSTNUM_ UINT16 w_rxSpdoIdx, const void * pv_data, UINT8 b_len )
+{
+    (void) SHNF_WriteProcessImage ( B_INSTNUMidx, k_PI_RX, w_rxSpdoIdx, pv_data, b_len );
+}
+
+BOOLEAN SHNF_FetchTxImage ( BYTE_B_INSTNUM_ UINT16 w_txSpdoIdx, void * pv_data, UINT8 b_len )
+{
+    t_PI_IMAGE * ps_image = GetImage ( B_INSTNUMidx, k_PI_TX, w_txSpdoIdx );
+    UINT32 dw_seq;
+
+    /* nothing new since the last fetch, the counter is 0 until the first image */
+    if ( ( ps_image == NULL ) || ( ATOMIC_LOAD_ACQUIRE ( ps_image->dw_seq ) == ps_image->dw_fetched ) )
+        return FALSE;
+
+    if ( SHNF_ReadProcessImage ( B_INSTNUMidx, k_PI_TX, w_txSpdoIdx, pv_data, b_len, &dw_seq ) != b_len )
+    {
+        DATA_LOGGER_DEBUG2 ( "Tx image %d does not match the length of the SPDO (%d)\n", w_txSpdoIdx, b_len );
+        ps_image->dw_fetched = dw_seq;
+        return FALSE;
+    }
+
+    ps_image->dw_fetched = dw_seq;
+    return TRUE;
+}
+
+#if (SPDO_cfg_TX_DATA_CHANGE_TRACKING == EPLS_k_ENABLE)
+void SHNF_TakeChangedTxImages ( BYTE_B_INSTNUM_ UINT32 * padw_changed, UINT16 w_noWords )
+{
+    UINT16 w_word;
+
+    for ( w_word = 0; w_word < w_noWords; w_word++ )
+    {
+        padw_changed[w_word] = 0;
+
+        /* the exchange is skipped, if nothing changed */
+        if ( ( B_INSTNUMidx < EPLS_cfg_MAX_INSTANCES ) && ( w_word < k_PI_TX_SET_WORDS ) &&
+             ( aadw_txChanged[B_INSTNUMidx][w_word] != 0 ) )
+            padw_changed[w_word] = ATOMIC_EXCHANGE ( aadw_txChanged[B_INSTNUMidx][w_word], 0 );
+    }
+}
+#endif
+
+#endif
@@ -0,0 +1,78 @@
+/*
+ * \file SHNF_Common/ProcessImage.h
+ * Double buffered process image of the SPDOs
+ * \addtogroup Demo
+ * \addtogroup SHNF
+ * \{
+ *
+ * Every Rx SPDO and every Tx SPDO has an image of its payload data, in the layout
+ * defined by the mapping of the SPDO. An image consists of two buffers, each on
+ * its own cache lines, and a sequence counter. The writer fills the back buffer
+ * and publishes it by incrementing the counter, which makes it the front buffer.
+ * A reader copies the front buffer and retries, if the counter changed during the
+ * copy. So readers of other threads always get a consistent snapshot, without
+ * taking a lock and without blocking the writer.
+ *
+ * The stack thread is the writer of the Rx images, with every received SPDO and
+ * when the SPDO is set to the safe state. The application is the writer of the Tx
+ * images, the stack copies the last image published into the mapped objects
+ * before the Tx SPDO is built. Every image must only have one writer.
+ *
+ * If SPDO_cfg_TX_DATA_CHANGE_TRACKING is enabled, a Tx image differing from the
+ * image before is sent with the next SPDO_BuildTxSpdo(), the application does not
+ * need to call SPDO_TxDataChanged().
+ *
+ * The images are only provided, if SPDO_cfg_PROCESS_IMAGE is enabled.
+ *
+ *****************************************************************************
+ * This source code is free software; you can redistribute it and/or modify it
+ * under the terms of the BSD license (according to License.txt).
+ *****************************************************************************/
+
+#ifndef SHNF_PROCESSIMAGE_H_
+#define SHNF_PROCESSIMAGE_H_
+
+#include "EPLStarget.h"
+#include "EPLScfg.h"
+#include "EPLStypes.h"
+
+/* Directions of an image */
+#define k_PI_RX 0
+#define k_PI_TX 1
+
+/**
+ * \brief This function copies the front buffer of an image. The copy is consistent,
+ * even if the image is published by another thread at the same time.
+ *
+ * \param b_instNum  the instance number
+ * \param b_dir      the direction, k_PI_RX or k_PI_TX
+ * \param w_spdoIdx  the index of the Rx SPDO or Tx SPDO
+ * \param pv_data    the buffer for the payload data
+ * \param b_size     the size of pv_data, longer images are truncated
+ * \param pdw_seq    the number of images published so far, NULL if not needed
+ *
+ * \return the length of the image, 0 if no image is published or the index is invalid
+ */
+UINT8 SHNF_ReadProcessImage ( UINT8 b_instNum, UINT8 b_dir, UINT16 w_spdoIdx,
+                              void * pv_data, UINT8 b_size, UINT32 * pdw_seq );
+
+/**
+ * \brief This function publishes an image. It must only be called by the single
+ * writer of the image, see above.
+ *
+ * \param b_instNum  the instance number
+ * \param b_dir      the direction, k_PI_RX or k_PI_TX
+ * \param w_spdoIdx  the index of the Rx SPDO or Tx SPDO
+ * \param pv_data    the payload data
+ * \param b_len      the length of the payload data, a Tx image is only taken by the
+ *                   stack, if it matches the length of the Tx SPDO
+ *
+ * \return - TRUE  - the image is published
+ *         - FALSE - the index or the length is invalid
+ */
+BOOLEAN SHNF_WriteProcessImage ( UINT8 b_instNum, UINT8 b_dir, UINT16 w_spdoIdx,
+                                 const void * pv_data, UINT8 b_len );
+
+#endif /* SHNF_PROCESSIMAGE_H_ */
+
+/* \} */
@@ -1,8 +1,8 @@
 /*
- * \file SHNF_UDPBufferHandling.h
- * Network specific functionality for handling the receive thread and adding to the buffer queue
+ * \file SHNFBufferHandling.h
+ * Frame buffers of the SHNF core, shared by all transports
  * \addtogroup Demo
- * \addtogroup UDPSHNF
+ * \addtogroup SHNF
  * \{
  * \brief SHNF - Safety "Firmware close to the hardware"
  *
@@ -24,8 +24,8 @@
  *
  */
 
-#ifndef SHNF_UDPBUFFERHANDLING_H_
-#define SHNF_UDPBUFFERHANDLING_H_
+#ifndef SHNF_BUFFERHANDLING_H_
+#define SHNF_BUFFERHANDLING_H_
 
 #include <stdio.h>
 #include <sys/types.h>
@@ -34,7 +34,6 @@
 
 
 #include <SHNF.h>
-#include "MQTT.h"
 #include "SHNF_Definitions.h"
 
 
@@ -61,37 +60,28 @@ struct s_openSAFETY_BUFFER
    UINT16            w_FrameSize;      /* size of the openSAFETY frame */
    UINT8             ab_FrameBuffer[k_openSAFETY_BUFFER_SIZE]; /* buffer for the openSAFETY frame */
    SHNF_t_TEL_TYPE   e_telType;                  /* telegram type for detecting slim SSDOs */
-   struct in_addr    sender;                     /* the IP address of the sender for this package */
-   pt_openSAFETY_BUFFER    ps_next;              /* pointer for the next in line */
+   UINT16            w_txSpdoNum;                /* number of the TxSPDO, only relevant for SPDOs */
 }; /* one buffer for an EPLS frame */
 
 /* openSAFETY buffers in SHNF */
-t_openSAFETY_BUFFER  as_openSAFETYFrames[k_openSAFETY_FRAME_QUEUE_SIZE];
+extern t_openSAFETY_BUFFER  as_openSAFETYFrames[k_openSAFETY_FRAME_QUEUE_SIZE];
 
-/**
- * This function starts the thread, which will receive data from the network.
- * This function relies heavily on cross-compilation macros. The real code is in
- * \file CrossCompile_Linux.h or \file CrossCompile_Win32.h , so go look there for
- * - \see CREATE_THREAD
- * - \see THREAD_FAILURE
- * - \see THREAD_TYPE
- *
- * \return - TRUE on success
- *         - FALSE on failure
- */
-BOOLEAN StartMqttClient();
-
-/**
- * This is the thread runner function for receiving data from the network.
- * The argument is not being parsed
- *
- * \param queueArguments unused
- *
- * \return - TRUE on success
- *         - FALSE on failure
- *
+/*
+ * Single producer / single consumer ring of preallocated frame slots. The receiving
+ * thread of the transport is the only writer of dw_head, the stack thread the only
+ * writer of dw_read and dw_tail. All three are free running counters, the slot index
+ * is obtained by masking with ( k_openSAFETY_RX_RING_SIZE - 1 ). Producer and consumer
+ * indices are kept on separate cache lines, so both threads never share a line.
  */
-THREAD_FUNC thread_MessageReceiver ( THREAD_FUNC_ARGUMENTS queueArguments );
+typedef struct
+{
+   volatile UINT32   dw_head;                    /* next slot to be filled by the producer */
+   UINT8             ab_padHead[CACHE_LINE_SIZE - sizeof(UINT32)];
+   volatile UINT32   dw_tail;                    /* next slot to be released by the consumer */
+   UINT32            dw_read;                    /* next slot to be collected by the consumer */
+   UINT8             ab_padTail[CACHE_LINE_SIZE - 2 * sizeof(UINT32)];
+   t_openSAFETY_BUFFER as_slots[k_openSAFETY_RX_RING_SIZE]; /* the frame slots */
+} t_openSAFETY_RX_RING;
 
 /**
  * This function writes the received information into the RX buffer from where it
@@ -99,7 +89,6 @@ THREAD_FUNC thread_MessageReceiver ( THREAD_FUNC_ARGUMENTS queueArguments );
  *
  * \param c_receivingBuffer the buffer containing the received data
  * \param ui_numberOfBytes the length of the received data
- * \param sender the sender which has sent the data in the containing buffer
  */
 void InsertIntoRXBuffer ( const UINT8 * c_receivingBuffer, UINT16 ui_numberOfBytes);
 
@@ -127,18 +116,32 @@ void InsertIntoRXBuffer ( const UINT8 * c_receivingBuffer, UINT16 ui_numberOfByt
 UINT16 findFrame1Start ( UINT16 i_dataLength, const UINT8 pb_byteStream[] );
 
 /**
- * \brief This function switches the second openSAFETY frame with the first
+ * \brief This function copies the given bytestream into the target buffer, switching
+ * the second openSAFETY frame with the first
  *
  * \warning This function ALWAYS assumes, that Frame 2 is stored before Frame 1
  *
- * \param i_dataLength   the length of data in the given bytestream
- * \param pb_byteStream  the bytefield containing the frame data
+ * \param i_dataLength        the length of data in the given bytestream
+ * \param i_wFrame1Position   the start of frame 1, as returned by \see findFrame1Start
+ * \param pb_byteStream       the bytefield containing the frame data
+ * \retval pb_target          a bytefield of at least @b i_dataLength bytes
+ */
+void copySwitchedFrames ( UINT16 i_dataLength, UINT16 i_wFrame1Position,
+                          const UINT8 pb_byteStream[], UINT8 pb_target[] );
+
+/**
+ * \brief This function switches the second openSAFETY frame with the first, inside
+ * the given bytestream
+ *
+ * \warning This function ALWAYS assumes, that Frame 2 is stored before Frame 1
  *
- * \return a bytefield of the same length as @b i_dataLength containing the frames in changed order
+ * \param i_dataLength        the length of data in the given bytestream
+ * \param i_wFrame1Position   the start of frame 1, as returned by \see findFrame1Start
+ * \param pb_byteStream       the bytefield containing the frame data
  */
-UINT8 * switchFrames ( UINT16 i_dataLength, const UINT8 pb_byteStream[] );
+void switchFramesInPlace ( UINT16 i_dataLength, UINT16 i_wFrame1Position, UINT8 pb_byteStream[] );
 
 
-#endif /* SHNF_UDPBUFFERHANDLING_H_ */
+#endif /* SHNF_BUFFERHANDLING_H_ */
 
 /* \} */
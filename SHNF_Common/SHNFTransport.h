@@ -0,0 +1,116 @@
+/*
+ * \file SHNF_Common/SHNFTransport.h
+ * Interface between the SHNF core and the wire backends
+ * \addtogroup Demo
+ * \addtogroup SHNF
+ * \{
+ *
+ * The SHNF core (\file MessageHandler.c) holds the TX frame pool, the send queue
+ * and the RX ring for the stack. Everything specific to the wire is done by a
+ * transport, which is selected at runtime by its name:
+ * - "mqtt"     - frames are published to and received from an MQTT broker
+ * - "udp"      - frames are sent as UDP datagrams, SPDOs by broadcast
+ * - "selftest" - frames are handed back to the own RX ring, a single node runs
+ *                against itself
+ * - "shm"      - frames are copied through a shared memory segment to the nodes
+ *                running on the same host
+ *
+ * A transport inserts received frames into the RX ring with \see InsertIntoRXBuffer,
+ * or by receiving directly into the slots, see \see SHNF_AcquireRxSlots.
+ *
+ *****************************************************************************
+ * This source code is free software; you can redistribute it and/or modify it
+ * under the terms of the BSD license (according to License.txt).
+ *****************************************************************************/
+
+#ifndef SHNF_TRANSPORT_H_
+#define SHNF_TRANSPORT_H_
+
+#include "EPLStarget.h"
+#include "EPLScfg.h"
+#include "EPLStypes.h"
+
+#include "SHNF.h"
+
+/* Operations of a transport. Optional operations may be NULL */
+typedef struct
+{
+    /* name of the transport, see SHNF_SelectTransport */
+    const char * pc_name;
+
+    /* Connects to the wire and starts receiving. Returns FALSE on failure */
+    BOOLEAN ( *pf_Start ) ( UINT16 w_ownSadr );
+
+    /* Sends a frame, sub-frame TWO first. w_adr is the ADR field of sub-frame ONE,
+       for SPDO time requests the TADR, which is the producer they are addressed to.
+       Returns FALSE, if the frame is not accepted and has to be sent again later.
+       The frame stays valid until pf_Flush returned */
+    BOOLEAN ( *pf_Send ) ( const UINT8 * pb_frame, UINT16 w_frameLength,
+                           SHNF_t_TEL_TYPE e_telType, UINT16 w_adr );
+
+    /* Called after all frames of a flush have been passed to pf_Send (optional) */
+    void ( *pf_Flush ) ( void );
+
+    /* Subscribes to the SPDOs of the given producer (optional) */
+    void ( *pf_SubscribeSpdo ) ( UINT16 w_sadr );
+
+    /* Subscribes to the time requests addressed to the given SADR of a TxSPDO (optional) */
+    void ( *pf_SubscribeTimeRequests ) ( UINT16 w_tadr );
+
+    /* Prints the statistics of the transport (optional) */
+    void ( *pf_PrintStatistics ) ( void );
+
+    /* Disconnects from the wire (optional) */
+    void ( *pf_Stop ) ( void );
+} SHNF_t_TRANSPORT;
+
+/* The available transports */
+extern const SHNF_t_TRANSPORT SHNF_s_MqttTransport;
+extern const SHNF_t_TRANSPORT SHNF_s_UdpTransport;
+extern const SHNF_t_TRANSPORT SHNF_s_SelfTestTransport;
+extern const SHNF_t_TRANSPORT SHNF_s_ShmTransport;
+
+/**
+ * \brief This function selects the transport by its name. It has to be called
+ * before \see SHNF_Init.
+ *
+ * Without a call, the transport named by the environment variable
+ * k_openSAFETY_TRANSPORT_ENV is used, or k_openSAFETY_TRANSPORT if it is not set.
+ *
+ * \param pc_name the name of the transport
+ *
+ * \return - TRUE  - the transport is selected
+ *         - FALSE - no transport of this name exists
+ */
+BOOLEAN SHNF_SelectTransport ( const char * pc_name );
+
+/**
+ * \brief This function returns free RX ring slots, to receive frames directly into.
+ *
+ * It may only be called by the single thread of a transport filling the RX ring.
+ * The slots stay free until they are handed to the stack by \see SHNF_CommitRxSlots.
+ *
+ * \param dw_maxSlots the maximum number of slots
+ * \retval apb_buffers the buffers of the free slots, each k_openSAFETY_BUFFER_SIZE bytes
+ *
+ * \return the number of free slots, 0 if the ring is full
+ */
+UINT32 SHNF_AcquireRxSlots ( UINT8 * apb_buffers[], UINT32 dw_maxSlots );
+
+/**
+ * \brief This function hands frames, received into the slots returned by
+ * \see SHNF_AcquireRxSlots, to the stack.
+ *
+ * The frames are checked like in \see InsertIntoRXBuffer, and switched in place.
+ * Discarded frames leave no gap, all frames are published at once.
+ *
+ * \param aw_lengths the number of bytes received into each slot, 0 for none
+ * \param dw_numSlots the number of slots, from the first acquired one
+ *
+ * \return the number of frames handed to the stack
+ */
+UINT32 SHNF_CommitRxSlots ( const UINT16 aw_lengths[], UINT32 dw_numSlots );
+
+#endif /* SHNF_TRANSPORT_H_ */
+
+/* \} */
@@ -57,13 +57,23 @@
 
 #include "Time.h"
 #include "MessageHandler.h"
-#include "MQTTBufferHandling.h"
+#include "SHNFBufferHandling.h"
+#include "SHNFTransport.h"
+#include "MQTTTopic.h"
 
 #define k_MAX_DATA_LEN 254
 
+BOOLEAN mqttSendMessage(void* context, const UINT8 * c_sendBuffer, UINT32 i_sendBufferLength);
+BOOLEAN mqttSendMessageTopic(void* context, const char * c_topic, const UINT8 * c_sendBuffer, UINT32 i_sendBufferLength);
+void onSubscribe(void* context, MQTTAsync_successData* response);
+void onSubscribeFailure(void* context, MQTTAsync_failureData* response);
+static BOOLEAN mqttPublishFrame(const char * c_topic, const UINT8 * c_sendBuffer, UINT32 i_sendBufferLength,
+		SHNF_t_TEL_TYPE e_telType, UINT16 w_adr);
+void onPublish(void* context, MQTTAsync_successData* response);
+void onPublishFailure(void* context, MQTTAsync_failureData* response);
+
 /*MQTT Stuff*/
 MQTTAsync client;
-volatile MQTTAsync_token deliveredtoken;
 int disc_finished = 0;
 int subscribed = 0;
 int finished = 0;
@@ -72,27 +82,321 @@ int finished = 0;
 UINT8 base64enBuff[k_MAX_DATA_LEN* 2]; //size is big enough. just to be sure. Could use b64e_size function
 UINT8 base64deBuff[k_MAX_DATA_LEN]; //Base64 Decoding buffer
 
-void mqttSend(const UINT8 * c_sendBuffer, UINT32 i_sendBufferLength){
+/* Every coalesced frame is prefixed by its length, as 16 bit big endian value */
+#define k_COALESCE_PREFIX_LEN 2
+
+UINT16 ownSadr = 0; //SADR of this node, frames addressed to it are subscribed
+UINT16 spdoSources[SPDO_cfg_MAX_NO_RX_SPDO + 1]; //producers of the RxSPDOs, each one is subscribed
+UINT16 numSpdoSources = 0; //number of entries in spdoSources
+UINT16 treqTargets[SPDO_cfg_MAX_NO_TX_SPDO + 1]; //SADRs of the TxSPDOs, the time requests addressed to each one are subscribed
+UINT16 numTreqTargets = 0; //number of entries in treqTargets
+int sourcesSubscribed = 0; //the connection has subscribed both lists, new entries are subscribed at once
+CREATE_BUFFER(mutexSpdoSources); //the lists are extended by the stack and subscribed in onConnect
+
+#if ( k_MQTT_COALESCE_FRAMES == EPLS_k_ENABLE )
+#if ( k_MQTT_COALESCE_MAX_BYTES < ( k_MAX_DATA_LEN + k_COALESCE_PREFIX_LEN ) )
+#error k_MQTT_COALESCE_MAX_BYTES has to hold at least one frame of maximum size
+#endif
+#define k_PUBLISH_BUFFER_SIZE k_MQTT_COALESCE_MAX_BYTES
+#else
+#define k_PUBLISH_BUFFER_SIZE k_MAX_DATA_LEN
+#endif
+
+/* Address of a publish buffer holding frames of several addresses or telegram types */
+#define k_MIXED_ADR 0xFFFFU
+
+/* Buffer of one publish. It is owned by the MQTT client from MQTTAsync_sendMessage
+   until its onPublish or onPublishFailure callback, which returns it to the pool */
+typedef struct {
+	UINT32 len; //number of bytes used in data
+	SHNF_t_TEL_TYPE e_telType; //telegram type of the frames
+	UINT16 w_adr; //ADR field of sub-frame ONE of the frames, or k_MIXED_ADR
+	int qos; //QoS the buffer is published with
+	MQTTAsync_token token; //token assigned by the client on publish
+	UINT8 data[k_PUBLISH_BUFFER_SIZE];
+} t_publishBuffer;
+
+/* QoS per telegram type, indexed by SHNF_t_TEL_TYPE, see mqttSetQos */
+int telQos[SHNF_k_SNMT + 1] = { 0, k_MQTT_QOS_SPDO, k_MQTT_QOS_SSDO, k_MQTT_QOS_SSDO, k_MQTT_QOS_SNMT };
+
+/* Publishes confirmed and failed per telegram type, written by the client callbacks */
+volatile UINT32 publishConfirmed[SHNF_k_SNMT + 1];
+volatile UINT32 publishFailed[SHNF_k_SNMT + 1];
+
+t_publishBuffer publishBuffers[k_MQTT_PUBLISH_BUFFERS];
+t_publishBuffer * freePublishBuffers[k_MQTT_PUBLISH_BUFFERS]; //stack of the free buffers
+UINT16 numFreePublishBuffers = 0;
+CREATE_BUFFER(mutexPublishBuffers); //the callbacks run in the thread of the MQTT client
+
+/* Message and response options of every publish, initialized once. Only the
+   payload and the context, which is the publish buffer, change per publish */
+MQTTAsync_message publishMsg = MQTTAsync_message_initializer;
+MQTTAsync_responseOptions publishOpts = MQTTAsync_responseOptions_initializer;
+
+static void mqttInitPublish(void){
+	UINT16 i;
+
+	LOCK_BUFFER(mutexPublishBuffers);
+	for (i = 0; i < k_MQTT_PUBLISH_BUFFERS; i++){
+		publishBuffers[i].len = 0;
+		freePublishBuffers[i] = &publishBuffers[i];
+	}
+	numFreePublishBuffers = k_MQTT_PUBLISH_BUFFERS;
+	UNLOCK_BUFFER(mutexPublishBuffers);
+
+	memset((void *)publishConfirmed, 0, sizeof(publishConfirmed));
+	memset((void *)publishFailed, 0, sizeof(publishFailed));
+
+	publishMsg.retained = 0;
+	publishOpts.onSuccess = onPublish;
+	publishOpts.onFailure = onPublishFailure;
+}
+
+//returns NULL, if all buffers are in flight
+static t_publishBuffer * mqttAcquirePublishBuffer(SHNF_t_TEL_TYPE e_telType, UINT16 w_adr){
+	t_publishBuffer * ps_buffer = NULL;
+
+	LOCK_BUFFER(mutexPublishBuffers);
+	if (numFreePublishBuffers > 0){
+		numFreePublishBuffers--;
+		ps_buffer = freePublishBuffers[numFreePublishBuffers];
+		ps_buffer->len = 0;
+		ps_buffer->e_telType = e_telType;
+		ps_buffer->w_adr = w_adr;
+		ps_buffer->qos = telQos[e_telType];
+	}
+	UNLOCK_BUFFER(mutexPublishBuffers);
+
+	return ps_buffer;
+}
+
+static void mqttReleasePublishBuffer(t_publishBuffer * ps_buffer){
+	LOCK_BUFFER(mutexPublishBuffers);
+	freePublishBuffers[numFreePublishBuffers] = ps_buffer;
+	numFreePublishBuffers++;
+	UNLOCK_BUFFER(mutexPublishBuffers);
+}
+
+//hands the buffer to the client. If the client does not accept it, e.g. its buffer
+//is full or it is reconnecting, FALSE is returned and the caller keeps the buffer
+static BOOLEAN mqttPublishBuffer(const char * c_topic, t_publishBuffer * ps_buffer){
+	int rc;
+
+	publishMsg.payload = ps_buffer->data;
+	publishMsg.payloadlen = (int)ps_buffer->len;
+	publishMsg.qos = ps_buffer->qos;
+	publishOpts.context = ps_buffer;
+
+	if ((rc = MQTTAsync_sendMessage(client, c_topic, &publishMsg, &publishOpts)) != MQTTASYNC_SUCCESS)
+	{
+		DATA_LOGGER_DEBUG1("Failed to start sendMessage, return code %d\n", rc);
+		return FALSE;
+	}
+	//the client has assigned the token of the publish
+	ps_buffer->token = publishOpts.token;
+	return TRUE;
+}
+
+#if ( k_MQTT_COALESCE_FRAMES == EPLS_k_ENABLE )
+t_publishBuffer * coalesceBuff = NULL; //frames waiting to be published together, NULL if none
+UINT32 coalesceStart = 0; //time the oldest frame in coalesceBuff was added, in micro seconds
+char coalesceTopic[k_MAX_TOPIC_LEN]; //topic all frames in coalesceBuff are routed to
+
+//if the client does not accept the message, the frames are kept for the next try
+static BOOLEAN mqttPublishCoalesced(void){
+	char c_topic[k_MAX_TOPIC_LEN + sizeof(k_MQTT_COALESCED_SUFFIX)];
+
+	if (coalesceBuff != NULL){
+		snprintf(c_topic, sizeof(c_topic), "%s%s", coalesceTopic, k_MQTT_COALESCED_SUFFIX);
+		if (!mqttPublishBuffer(c_topic, coalesceBuff)){
+			return FALSE;
+		}
+		coalesceBuff = NULL;
+	}
+	return TRUE;
+}
+#endif
+
+BOOLEAN mqttSend(const UINT8 * c_sendBuffer, UINT16 i_sendBufferLength, SHNF_t_TEL_TYPE e_telType, UINT16 w_adr){
+	char c_topic[k_MAX_TOPIC_LEN];
+	BOOLEAN o_timeRequest = FALSE;
+	UINT16 i_frame1Start;
 
 	//encode message as base64
 	if (i_sendBufferLength > k_MAX_DATA_LEN){
 		DATA_LOGGER("FATAL ERROR MQTT DATA TOO LONG");
+		//the frame can never be sent, so it is not handed back for a retry
+		return TRUE;
+	}
+
+	//the ID of sub-frame ONE is not encoded, the SHNF core has passed the TADR of a time request
+	if (e_telType == SHNF_k_SPDO){
+		i_frame1Start = findFrame1Start(i_sendBufferLength, c_sendBuffer);
+		o_timeRequest = (BOOLEAN)((i_frame1Start > 0) &&
+				openSAFETY_IS_SPDO_TREQ_FRAME_ID(c_sendBuffer[i_frame1Start + 1]));
+	}
+	mqttFrameTopic(c_topic, e_telType, o_timeRequest, w_adr);
+
+#if ( k_MQTT_COALESCE_FRAMES == EPLS_k_ENABLE )
+	//only frames routed to the same topic can share a message
+	if (coalesceBuff != NULL && strcmp(coalesceTopic, c_topic) != 0){
+		if (!mqttPublishCoalesced()){
+			return FALSE;
+		}
+	}
+	//all frames of a message are published with the same QoS
+	if (coalesceBuff != NULL && coalesceBuff->qos != telQos[e_telType]){
+		if (!mqttPublishCoalesced()){
+			return FALSE;
+		}
+	}
+	//the message would exceed the byte threshold
+	if (coalesceBuff != NULL &&
+		coalesceBuff->len + k_COALESCE_PREFIX_LEN + i_sendBufferLength > k_MQTT_COALESCE_MAX_BYTES){
+		if (!mqttPublishCoalesced()){
+			return FALSE;
+		}
+	}
+	if (coalesceBuff == NULL){
+		//all buffers in flight, the SHNF keeps the frame for later
+		if ((coalesceBuff = mqttAcquirePublishBuffer(e_telType, w_adr)) == NULL){
+			return FALSE;
+		}
+		coalesceStart = SHNFTime_getTime(k_openSAFETY_TIMEBASE_1US);
+		strcpy(coalesceTopic, c_topic);
+	}
+	//without topic routing, frames to several addresses share a message
+	if (coalesceBuff->e_telType != e_telType || coalesceBuff->w_adr != w_adr){
+		coalesceBuff->w_adr = k_MIXED_ADR;
+	}
+	coalesceBuff->data[coalesceBuff->len++] = (UINT8)(i_sendBufferLength >> 8);
+	coalesceBuff->data[coalesceBuff->len++] = (UINT8)(i_sendBufferLength);
+	memcpy(&coalesceBuff->data[coalesceBuff->len], c_sendBuffer, i_sendBufferLength);
+	coalesceBuff->len += i_sendBufferLength;
+	return TRUE;
+#else
+	return mqttPublishFrame(c_topic, c_sendBuffer, i_sendBufferLength, e_telType, w_adr); //without base64
+#endif
+}
+
+void mqttFlush(void){
+#if ( k_MQTT_COALESCE_FRAMES == EPLS_k_ENABLE )
+#if ( k_MQTT_COALESCE_FLUSH == k_MQTT_FLUSH_MAX_LATENCY )
+	if ((coalesceBuff == NULL) ||
+		((SHNFTime_getTime(k_openSAFETY_TIMEBASE_1US) - coalesceStart) < k_MQTT_COALESCE_MAX_LATENCY_US)){
+		return;
+	}
+#endif
+	(void)mqttPublishCoalesced();
+#endif
+}
+
+/**
+ * This function subscribes to the given topic with the given maximum QoS, a failure is fatal.
+ */
+static void mqttSubscribe(MQTTAsync client, const char * c_topic, int qos){
+	MQTTAsync_responseOptions opts = MQTTAsync_responseOptions_initializer;
+	int rc;
+
+	opts.onSuccess = onSubscribe;
+	opts.onFailure = onSubscribeFailure;
+	opts.context = client;
+
+	DATA_LOGGER2("Subscribing to topic %s using QoS%d\n", c_topic, qos);
+	if ((rc = MQTTAsync_subscribe(client, c_topic, qos, &opts)) != MQTTASYNC_SUCCESS)
+	{
+		DATA_LOGGER1("Failed to start subscribe, return code %d\n", rc);
+		exit(EXIT_FAILURE);
+	}
+}
+
+#if ( k_MQTT_TOPIC_ROUTING == EPLS_k_ENABLE )
+/**
+ * This function subscribes to the routed topic of the given telegram type and SADR,
+ * including its coalesced sub topic.
+ */
+static void mqttSubscribeRouted(MQTTAsync client, SHNF_t_TEL_TYPE e_telType, BOOLEAN o_timeRequest, UINT16 w_sadr){
+	char c_topic[k_MAX_TOPIC_LEN + sizeof(k_MQTT_SUBSCRIBE_SUFFIX)];
+
+	mqttSubscriptionTopic(c_topic, e_telType, o_timeRequest, w_sadr);
+	mqttSubscribe(client, c_topic, telQos[e_telType]);
+}
+#endif
+
+/**
+ * This function adds the SADR to a list of SPDO subscriptions, if not already in it.
+ * onConnect either subscribes the new entry or has subscribed the list before.
+ */
+static void mqttAddSpdoSubscription(UINT16 * aw_list, UINT16 * pw_num, UINT16 w_max,
+		BOOLEAN o_timeRequest, UINT16 w_sadr){
+	UINT16 i;
+
+	LOCK_BUFFER(mutexSpdoSources);
+	for (i = 0; i < *pw_num; i++){
+		if (aw_list[i] == w_sadr){
+			UNLOCK_BUFFER(mutexSpdoSources);
+			return;
+		}
+	}
+	if (*pw_num >= w_max){
+		UNLOCK_BUFFER(mutexSpdoSources);
+		DATA_LOGGER1("No SPDO subscription left for SADR %u\n", w_sadr);
 		return;
 	}
+	aw_list[*pw_num] = w_sadr;
+	(*pw_num)++;
+
+#if ( k_MQTT_TOPIC_ROUTING == EPLS_k_ENABLE )
+	if (sourcesSubscribed){
+		mqttSubscribeRouted(client, SHNF_k_SPDO, o_timeRequest, w_sadr);
+	}
+#else
+	(void)o_timeRequest;
+#endif
+	UNLOCK_BUFFER(mutexSpdoSources);
+}
 
-	//send switched Frame
-	UINT8 * pb_sendMemBlock = switchFrames( i_sendBufferLength, c_sendBuffer ); //switch frames
-	//UINT32 base64enSize2 = b64_encode(pb_sendMemBlock, i_sendBufferLength, base64enBuff);
-	//mqttSendMessageSw(client, base64enBuff, base64enSize2);
-	//mqttSendMessageSw(client, c_sendBuffer, i_sendBufferLength);
+void mqttSubscribeSpdo(UINT16 w_sadr){
+	mqttAddSpdoSubscription(spdoSources, &numSpdoSources, SPDO_cfg_MAX_NO_RX_SPDO + 1, FALSE, w_sadr);
+}
 
-	//send normal Frame
-	//UINT32 base64enSize = b64_encode(c_sendBuffer, i_sendBufferLength, base64enBuff);
-	//mqttSendMessage(client, base64enBuff, base64enSize);
-	mqttSendMessage(client, c_sendBuffer, i_sendBufferLength); //without base64
+void mqttSubscribeTimeRequests(UINT16 w_tadr){
+	mqttAddSpdoSubscription(treqTargets, &numTreqTargets, SPDO_cfg_MAX_NO_TX_SPDO + 1, TRUE, w_tadr);
 }
 
+/**
+ * This function splits a message of length prefixed frames, as built by \see mqttSend
+ * with coalescing enabled, and inserts every frame into the RX buffer on its own.
+ */
+static void InsertCoalescedIntoRXBuffer(const UINT8 * c_payload, UINT32 i_payloadLength){
+	UINT32 i_offset = 0;
+	UINT16 i_frameLength;
 
+	while (i_offset + k_COALESCE_PREFIX_LEN <= i_payloadLength){
+		i_frameLength = (UINT16)((c_payload[i_offset] << 8) | c_payload[i_offset + 1]);
+		i_offset += k_COALESCE_PREFIX_LEN;
+
+		if (i_frameLength == 0 || i_offset + i_frameLength > i_payloadLength){
+			DATA_LOGGER_DEBUG1("Malformed coalesced message, frame of %u bytes exceeds the payload\n", i_frameLength);
+			return;
+		}
+		InsertIntoRXBuffer(&c_payload[i_offset], i_frameLength);
+		i_offset += i_frameLength;
+	}
+}
+
+
+
+/**
+ * This function returns TRUE, if the topic carries coalesced frames.
+ */
+static BOOLEAN IsCoalescedTopic(const char * c_topic){
+	size_t i_topicLen = strlen(c_topic);
+	size_t i_suffixLen = strlen(k_MQTT_COALESCED_SUFFIX);
+
+	return (BOOLEAN)((i_topicLen >= i_suffixLen) &&
+			(strcmp(&c_topic[i_topicLen - i_suffixLen], k_MQTT_COALESCED_SUFFIX) == 0));
+}
 
 //-------------MQTT-Functions------------------------------------
 int msgarrvd(void *context, char *topicName, int topicLen, MQTTAsync_message *message)
@@ -116,14 +420,16 @@ int msgarrvd(void *context, char *topicName, int topicLen, MQTTAsync_message *me
     /* The received data is written into the buffer */
    if ( message->payloadlen > 0 )
    {
-	   //base64decode
-
-	   //UINT16 base64deSize = b64_decode(message->payload, message->payloadlen, base64deBuff);
-	   //UINT8 * pb_ret = (UINT8 *) switchFrames(base64deBuff, base64deSize);
 	   /** Insert packages into queue */
-	   //InsertIntoRXBuffer ( base64deBuff, (UINT16) base64deSize);
-	   //InsertIntoRXBuffer ( pb_ret, (UINT16) base64deSize); //switch frames back
-	   InsertIntoRXBuffer ( message->payload, (UINT16) message->payloadlen); //without base64
+	   if ( IsCoalescedTopic(topicName) )
+	   {
+		   /** Several frames in one message, every one is queued on its own */
+		   InsertCoalescedIntoRXBuffer ( message->payload, (UINT32) message->payloadlen );
+	   }
+	   else
+	   {
+		   InsertIntoRXBuffer ( message->payload, (UINT16) message->payloadlen); //without base64
+	   }
    }
    MQTTAsync_freeMessage(&message);
    MQTTAsync_free(topicName);
@@ -152,13 +458,73 @@ void connlost(void *context, char *cause)
 
 void onDisconnect(void* context, MQTTAsync_successData* response)
 {
+	//avoid compiler warning
+	context = context;
+	response = response;
+
 	DATA_LOGGER("Successful disconnection\n");
 	disc_finished = 1;
 }
 
 
+//called once the frames are written (QoS 0) or acknowledged by the broker (QoS 1, 2)
+void onPublish(void* context, MQTTAsync_successData* response)
+{
+	t_publishBuffer * ps_buffer = (t_publishBuffer *)context;
+
+	//avoid compiler warning
+	response = response;
+
+	publishConfirmed[ps_buffer->e_telType]++;
+	mqttReleasePublishBuffer(ps_buffer);
+}
+
+//called if the frames were not written or not acknowledged, e.g. the connection was lost
+void onPublishFailure(void* context, MQTTAsync_failureData* response)
+{
+	t_publishBuffer * ps_buffer = (t_publishBuffer *)context;
+
+	//avoid compiler warning, if the debug output is disabled
+	response = response;
+
+	DATA_LOGGER_DEBUG2("Publish of token %d failed, rc %d\n", ps_buffer->token, response ? response->code : 0);
+	publishFailed[ps_buffer->e_telType]++;
+#if ( k_MQTT_LOST_FRAME_REPORTS == EPLS_k_ENABLE )
+	//the stack repeats lost requests without waiting for their timeout, SPDOs are replaced by the next ones
+	if (ps_buffer->e_telType != SHNF_k_SPDO && ps_buffer->w_adr != k_MIXED_ADR){
+		SHNF_SignalLostFrame(ps_buffer->e_telType, ps_buffer->w_adr);
+	}
+#endif
+	mqttReleasePublishBuffer(ps_buffer);
+}
+
+void mqttSetQos(SHNF_t_TEL_TYPE e_telType, int qos){
+	if (e_telType > SHNF_k_SNMT || qos < 0 || qos > 2){
+		DATA_LOGGER2("Invalid QoS %d for telegram type %d\n", qos, e_telType);
+		return;
+	}
+	telQos[e_telType] = qos;
+	//SSDO and slim SSDO frames share their topics
+	if (e_telType == SHNF_k_SSDO){
+		telQos[SHNF_k_SSDO_SLIM] = qos;
+	}
+}
+
+void mqttPrintStatistics(void){
+	DATA_LOGGER4("Publishes confirmed : SPDO %u SSDO %u SSDO slim %u SNMT %u\n",
+			publishConfirmed[SHNF_k_SPDO], publishConfirmed[SHNF_k_SSDO],
+			publishConfirmed[SHNF_k_SSDO_SLIM], publishConfirmed[SHNF_k_SNMT]);
+	DATA_LOGGER4("Publishes failed    : SPDO %u SSDO %u SSDO slim %u SNMT %u\n",
+			publishFailed[SHNF_k_SPDO], publishFailed[SHNF_k_SSDO],
+			publishFailed[SHNF_k_SSDO_SLIM], publishFailed[SHNF_k_SNMT]);
+}
+
 void onSubscribe(void* context, MQTTAsync_successData* response)
 {
+	//avoid compiler warning
+	context = context;
+	response = response;
+
 	DATA_LOGGER("Subscribe succeeded\n");
 	subscribed = 1;
 }
@@ -182,29 +548,40 @@ void onConnect(void* context, MQTTAsync_successData* response)
 	MQTTAsync client = (MQTTAsync)context;
 	MQTTAsync_responseOptions opts = MQTTAsync_responseOptions_initializer;
 	int rc;
+#if ( k_MQTT_TOPIC_ROUTING == EPLS_k_ENABLE )
+	UINT16 i;
+#endif
 
 	MQTTAsync_message pubmsg = MQTTAsync_message_initializer;
 	pubmsg.payload = "SCM is online";
 	pubmsg.payloadlen = (int)strlen("SN is online");
 	pubmsg.qos = QOS;
 	pubmsg.retained = 0;
-	deliveredtoken = 0;
 
 	DATA_LOGGER("Successful connection\n");
 
-	DATA_LOGGER3("Subscribing to topic %s\nfor client %s using QoS%d\n\n"
-           "Press Q<Enter> to quit\n\n", k_MQTT_SUBSCRIBE_TOPIC, CLIENTID, QOS);
+	DATA_LOGGER2("Subscribing for client %s using QoS%d\n\n"
+           "Press Q<Enter> to quit\n\n", CLIENTID, QOS);
 	opts.onSuccess = onSubscribe;
 	opts.onFailure = onSubscribeFailure;
 	opts.context = client;
 
-	deliveredtoken = 0;
-
-	if ((rc = MQTTAsync_subscribe(client, k_MQTT_SUBSCRIBE_TOPIC, QOS, &opts)) != MQTTASYNC_SUCCESS)
-	{
-		DATA_LOGGER1("Failed to start subscribe, return code %d\n", rc);
-		exit(EXIT_FAILURE);
+#if ( k_MQTT_TOPIC_ROUTING == EPLS_k_ENABLE )
+	//frames addressed to this node, the SPDOs it consumes and the time requests to its TxSPDOs
+	mqttSubscribeRouted(client, SHNF_k_SNMT, FALSE, ownSadr);
+	mqttSubscribeRouted(client, SHNF_k_SSDO, FALSE, ownSadr);
+	LOCK_BUFFER(mutexSpdoSources);
+	for (i = 0; i < numSpdoSources; i++){
+		mqttSubscribeRouted(client, SHNF_k_SPDO, FALSE, spdoSources[i]);
+	}
+	for (i = 0; i < numTreqTargets; i++){
+		mqttSubscribeRouted(client, SHNF_k_SPDO, TRUE, treqTargets[i]);
 	}
+	sourcesSubscribed = 1;
+	UNLOCK_BUFFER(mutexSpdoSources);
+#else
+	mqttSubscribe(client, k_MQTT_SUBSCRIBE_TOPIC, QOS);
+#endif
 
 	if ((rc = MQTTAsync_sendMessage(client, k_MQTT_BASE_TOPIC, &pubmsg, &opts)) != MQTTASYNC_SUCCESS)
 		{
@@ -213,68 +590,69 @@ void onConnect(void* context, MQTTAsync_successData* response)
 		}
 }
 
-void mqttSendMessage(void* context, const UINT8 * c_sendBuffer, UINT32 i_sendBufferLength){
-	MQTTAsync client = (MQTTAsync)context;
-	MQTTAsync_responseOptions opts = MQTTAsync_responseOptions_initializer;
-	MQTTAsync_message pubmsg = MQTTAsync_message_initializer;
-	pubmsg.payload = c_sendBuffer;
-	pubmsg.payloadlen = i_sendBufferLength;
-	pubmsg.qos = QOS;
-	pubmsg.retained = 0;
-	deliveredtoken = 0;
-	int rc;
+BOOLEAN mqttSendMessage(void* context, const UINT8 * c_sendBuffer, UINT32 i_sendBufferLength){
+	return mqttSendMessageTopic(context, k_MQTT_BASE_TOPIC, c_sendBuffer, i_sendBufferLength);
+}
 
-	//opts.onSuccess = onSend;
-	opts.context = client;
+//returns FALSE, if all publish buffers are in flight or the client did not accept
+//the message, e.g. its buffer is full or it is reconnecting
+static BOOLEAN mqttPublishFrame(const char * c_topic, const UINT8 * c_sendBuffer, UINT32 i_sendBufferLength,
+		SHNF_t_TEL_TYPE e_telType, UINT16 w_adr){
+	t_publishBuffer * ps_buffer;
 
-	if ((rc = MQTTAsync_sendMessage(client, k_MQTT_BASE_TOPIC, &pubmsg, &opts)) != MQTTASYNC_SUCCESS)
-	{
-		printf("Failed to start sendMessage, return code %d\n", rc);
-		exit(EXIT_FAILURE);
+	if (i_sendBufferLength > k_PUBLISH_BUFFER_SIZE){
+		DATA_LOGGER1("Message of %u bytes exceeds the publish buffer\n", i_sendBufferLength);
+		return FALSE;
 	}
-}
+	if ((ps_buffer = mqttAcquirePublishBuffer(e_telType, w_adr)) == NULL){
+		return FALSE;
+	}
+	memcpy(ps_buffer->data, c_sendBuffer, i_sendBufferLength);
+	ps_buffer->len = i_sendBufferLength;
 
-void mqttSendMessageSw(void* context, const UINT8 * c_sendBuffer, UINT32 i_sendBufferLength){
-	MQTTAsync client = (MQTTAsync)context;
-	MQTTAsync_responseOptions opts = MQTTAsync_responseOptions_initializer;
-	MQTTAsync_message pubmsg = MQTTAsync_message_initializer;
-	pubmsg.payload = c_sendBuffer;
-	pubmsg.payloadlen = i_sendBufferLength;
-	pubmsg.qos = QOS;
-	pubmsg.retained = 0;
-	deliveredtoken = 0;
-	int rc;
+	if (!mqttPublishBuffer(c_topic, ps_buffer)){
+		mqttReleasePublishBuffer(ps_buffer);
+		return FALSE;
+	}
+	return TRUE;
+}
 
-	//opts.onSuccess = onSend;
-	opts.context = client;
+//publishes raw data, with the QoS of SSDO frames and without delivery reports
+BOOLEAN mqttSendMessageTopic(void* context, const char * c_topic, const UINT8 * c_sendBuffer, UINT32 i_sendBufferLength){
+	(void)context;
+	return mqttPublishFrame(c_topic, c_sendBuffer, i_sendBufferLength, SHNF_k_SSDO, k_MIXED_ADR);
+}
 
-	if ((rc = MQTTAsync_sendMessage(client, k_MQTT_BASE_TOPIC_SW, &pubmsg, &opts)) != MQTTASYNC_SUCCESS)
-	{
-		printf("Failed to start sendMessage, return code %d\n", rc);
-		exit(EXIT_FAILURE);
-	}
+BOOLEAN mqttSendMessageSw(void* context, const UINT8 * c_sendBuffer, UINT32 i_sendBufferLength){
+	return mqttSendMessageTopic(context, k_MQTT_BASE_TOPIC_SW, c_sendBuffer, i_sendBufferLength);
 }
 
 /**
- * This function starts the thread, which will receive data from the network.
- * This function relies heavily on cross-compilation macros. The real code is in
- * \file CrossCompile_Linux.h or \file CrossCompile_Win32.h , so go look there for
- * - \see CREATE_THREAD
- * - \see THREAD_FAILURE
- * - \see THREAD_TYPE
+ * This function connects the MQTT client to the broker and waits, until the frames
+ * addressed to this node are subscribed. The frames are received in the thread of
+ * the client, see \see msgarrvd.
+ *
+ * \param w_ownSadr the SADR of this node, SNMT and SSDO frames addressed to it are subscribed
  *
  * \return - TRUE on success
  *         - FALSE on failure
  */
-BOOLEAN StartMqttClient()
+BOOLEAN StartMqttClient(UINT16 w_ownSadr)
 {
 
 	MQTTAsync_connectOptions conn_opts = MQTTAsync_connectOptions_initializer;
-	MQTTAsync_disconnectOptions disc_opts = MQTTAsync_disconnectOptions_initializer;
 	int rc;
-	int ch;
-
 
+	ownSadr = w_ownSadr;
+	subscribed = 0;
+	finished = 0;
+	disc_finished = 0;
+	LOCK_BUFFER(mutexSpdoSources);
+	numSpdoSources = 0;
+	numTreqTargets = 0;
+	sourcesSubscribed = 0;
+	UNLOCK_BUFFER(mutexSpdoSources);
+	mqttInitPublish();
 
 	MQTTAsync_create(&client, k_MQTT_BROKER_ADDRESS, CLIENTID, MQTTCLIENT_PERSISTENCE_NONE, NULL);
 
@@ -293,12 +671,41 @@ BOOLEAN StartMqttClient()
 		DATA_LOGGER1("Failed to start connect, return code %d\n", rc);
 		exit(EXIT_FAILURE);
 	}
-	while(!subscribed){
+	while(!subscribed && !finished){
 		usleep(10000L);
 	}
+	if (finished){
+		return FALSE;
+	}
 	DATA_LOGGER("Subscribing done\n");
 
+	return TRUE;
+}
 
-
-    return finished;
+void mqttStop(void){
+	MQTTAsync_disconnectOptions disc_opts = MQTTAsync_disconnectOptions_initializer;
+	int i;
+
+	disc_opts.timeout = 1000; //in flight publishes are given 1s to complete
+	disc_opts.onSuccess = onDisconnect;
+	disc_opts.context = client;
+	if (MQTTAsync_disconnect(client, &disc_opts) == MQTTASYNC_SUCCESS){
+		for (i = 0; i < 200 && !disc_finished; i++){
+			usleep(10000L);
+		}
+	}
+	MQTTAsync_destroy(&client);
 }
+
+/* The MQTT transport of the SHNF */
+const SHNF_t_TRANSPORT SHNF_s_MqttTransport =
+{
+	"mqtt",
+	StartMqttClient,
+	mqttSend,
+	mqttFlush,
+	mqttSubscribeSpdo,
+	mqttSubscribeTimeRequests,
+	mqttPrintStatistics,
+	mqttStop
+};
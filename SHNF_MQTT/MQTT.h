@@ -31,9 +31,83 @@
 #include "EPLScfg.h"
 #include "EPLStypes.h"
 #include "SNMTSapi.h"
+#include "SHNF.h"
 
-BOOLEAN StartMqttClient();
-void mqttSend(const UINT8 * c_sendBuffer, UINT32 i_sendBufferLength);
+/* Flush triggers for coalesced frames, see k_MQTT_COALESCE_FLUSH */
+#define k_MQTT_FLUSH_END_OF_CYCLE   1 /* published at the end of every application loop */
+#define k_MQTT_FLUSH_MAX_LATENCY    2 /* published once the oldest frame waited k_MQTT_COALESCE_MAX_LATENCY_US */
+
+/**
+ * \brief This function connects to the broker and subscribes to the frames addressed
+ * to this node. It is the start operation of the MQTT transport, see \file SHNFTransport.h
+ *
+ * \param w_ownSadr the SADR of this node
+ *
+ * \return - TRUE  - the client is connected and subscribed
+ *         - FALSE - the connection or a subscription failed
+ */
+BOOLEAN StartMqttClient(UINT16 w_ownSadr);
+
+/**
+ * \brief This function disconnects from the broker and destroys the client.
+ */
+void mqttStop(void);
+
+/**
+ * \brief This function publishes a frame. With k_MQTT_TOPIC_ROUTING the topic is
+ * k_MQTT_TOPIC_PREFIX/<SDN>/<snmt|ssdo|spdo|treq>/<w_adr>, otherwise k_MQTT_BASE_TOPIC,
+ * see \see mqttFrameTopic.
+ *
+ * \param c_sendBuffer       the frame, sub-frame TWO first
+ * \param i_sendBufferLength the length of the frame
+ * \param e_telType          the telegram type of the frame
+ * \param w_adr              the ADR field of sub-frame ONE, the TADR for time requests
+ *
+ * \return - TRUE  - the frame was handed to the MQTT client
+ *         - FALSE - the client did not accept the frame (buffer full, reconnecting),
+ *                   it has to be sent again later
+ */
+BOOLEAN mqttSend(const UINT8 * c_sendBuffer, UINT16 i_sendBufferLength, SHNF_t_TEL_TYPE e_telType, UINT16 w_adr);
+
+/**
+ * \brief This function subscribes to the SPDOs produced by the given SADR, if not
+ * already subscribed. The subscription is restored on every reconnect.
+ *
+ * \param w_sadr the SADR of the SPDO producer
+ */
+void mqttSubscribeSpdo(UINT16 w_sadr);
+
+/**
+ * \brief This function subscribes to the time requests addressed to the given SADR
+ * of a TxSPDO, if not already subscribed. The subscription is restored on every
+ * reconnect.
+ *
+ * \param w_tadr the SADR of the TxSPDO, which is the TADR of its time requests
+ */
+void mqttSubscribeTimeRequests(UINT16 w_tadr);
+
+/**
+ * \brief This function publishes the coalesced frames, if the configured flush trigger
+ * is met. It is called at the end of every application loop, after all frames of the
+ * loop have been handed to \see mqttSend. Without coalescing it does nothing.
+ */
+void mqttFlush(void);
+
+/**
+ * \brief This function sets the QoS of the frames of the given telegram type. It
+ * applies to frames published from now on and to subscriptions made on the next
+ * reconnect. SSDO and slim SSDO frames share their QoS.
+ *
+ * \param e_telType the telegram type
+ * \param qos       the QoS, 0 .. 2
+ */
+void mqttSetQos(SHNF_t_TEL_TYPE e_telType, int qos);
+
+/**
+ * \brief This function prints the number of confirmed and failed publishes per
+ * telegram type.
+ */
+void mqttPrintStatistics(void);
 void sendState(SNMTS_t_SN_STATE_MAIN e_actSnState);
 
 #endif /* #ifndef  SHNFDEMO_H */
@@ -0,0 +1,45 @@
+/**
+ * \file MQTTTopic.c
+ * Topics of the MQTT SHNF
+ * \addtogroup Demo
+ * \{
+ * \brief SHNF - Safety "Firmware close to the hardware"
+ *
+ *****************************************************************************
+ * This source code is free software; you can redistribute it and/or modify it
+ * under the terms of the BSD license (according to License.txt).
+ *****************************************************************************/
+
+#include "MQTTTopic.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#include "MQTT_Configuration.h"
+
+void mqttFrameTopic(char * c_topic, SHNF_t_TEL_TYPE e_telType, BOOLEAN o_timeRequest, UINT16 w_adr){
+#if ( k_MQTT_TOPIC_ROUTING == EPLS_k_ENABLE )
+	const char * c_type = "ssdo";
+
+	if (e_telType == SHNF_k_SPDO){
+		//only the producer in the TADR answers a time request
+		c_type = o_timeRequest ? "treq" : "spdo";
+	}
+	else if (e_telType == SHNF_k_SNMT){
+		c_type = "snmt";
+	}
+	snprintf(c_topic, k_MAX_TOPIC_LEN, "%s/%u/%s/%u", k_MQTT_TOPIC_PREFIX, (UINT16)k_MQTT_SDN, c_type, w_adr);
+#else
+	(void)e_telType;
+	(void)o_timeRequest;
+	(void)w_adr;
+	snprintf(c_topic, k_MAX_TOPIC_LEN, "%s", k_MQTT_BASE_TOPIC);
+#endif
+}
+
+void mqttSubscriptionTopic(char * c_topic, SHNF_t_TEL_TYPE e_telType, BOOLEAN o_timeRequest, UINT16 w_sadr){
+	mqttFrameTopic(c_topic, e_telType, o_timeRequest, w_sadr);
+	strcat(c_topic, k_MQTT_SUBSCRIBE_SUFFIX);
+}
+
+/** @} */
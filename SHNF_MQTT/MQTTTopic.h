@@ -0,0 +1,59 @@
+/**
+ * \file MQTTTopic.h
+ * Topics of the MQTT SHNF
+ * \addtogroup Demo
+ * \{
+ * \brief SHNF - Safety "Firmware close to the hardware"
+ *
+ * The topics the frames are published on and the topics a node subscribes to. They
+ * do not depend on the MQTT client, so the routing can be checked without a broker.
+ *
+ *****************************************************************************
+ * This source code is free software; you can redistribute it and/or modify it
+ * under the terms of the BSD license (according to License.txt).
+ *****************************************************************************/
+
+#ifndef MQTT_TOPIC_H
+#define MQTT_TOPIC_H
+
+#include "EPLStarget.h"
+#include "EPLScfg.h"
+#include "EPLStypes.h"
+#include "SHNF.h"
+
+/* Maximum length of a topic name */
+#define k_MAX_TOPIC_LEN 64
+
+/* Suffix of a subscription, matching the topic and its sub topics */
+#define k_MQTT_SUBSCRIBE_SUFFIX "/#"
+
+/**
+ * \brief This function returns the topic a frame is published on.
+ *
+ * With topic routing, SPDOs are published on the SADR of the producer, SNMT and
+ * SSDO frames on the SADR they are addressed to, which is the ADR field of sub-frame
+ * ONE in both cases. Time requests are published on the TADR, the producer they are
+ * addressed to. Without topic routing, every frame is published on k_MQTT_BASE_TOPIC.
+ *
+ * \param e_telType     the telegram type of the frame
+ * \param o_timeRequest TRUE, if the frame is a SPDO time request
+ * \param w_adr         the ADR field of sub-frame ONE, the TADR for time requests
+ * \retval c_topic      buffer of k_MAX_TOPIC_LEN bytes, receiving the topic
+ */
+void mqttFrameTopic(char * c_topic, SHNF_t_TEL_TYPE e_telType, BOOLEAN o_timeRequest, UINT16 w_adr);
+
+/**
+ * \brief This function returns the topic filter, which subscribes to the routed
+ * topic of the given telegram type and SADR, including its coalesced sub topic.
+ *
+ * \param e_telType     the telegram type
+ * \param o_timeRequest TRUE for the time requests addressed to w_sadr
+ * \param w_sadr        the SADR
+ * \retval c_topic      buffer of k_MAX_TOPIC_LEN + sizeof(k_MQTT_SUBSCRIBE_SUFFIX) bytes,
+ *                      receiving the topic filter
+ */
+void mqttSubscriptionTopic(char * c_topic, SHNF_t_TEL_TYPE e_telType, BOOLEAN o_timeRequest, UINT16 w_sadr);
+
+#endif /* #ifndef MQTT_TOPIC_H */
+
+/** @} */
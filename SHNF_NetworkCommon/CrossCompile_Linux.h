@@ -49,6 +49,23 @@ typedef UINT32 THREAD_ID_TYPE;
 #define LOCK_BUFFER(buffer)                pthread_mutex_lock( &buffer )
 #define UNLOCK_BUFFER(buffer)           pthread_mutex_unlock( &buffer )
 
+/* Lock-free single producer / single consumer queues */
+#define CACHE_LINE_SIZE                 64
+#define ATOMIC_LOAD_ACQUIRE(var)        __atomic_load_n( &(var), __ATOMIC_ACQUIRE )
+#define ATOMIC_STORE_RELEASE(var, val)  __atomic_store_n( &(var), (val), __ATOMIC_RELEASE )
+#define ATOMIC_EXCHANGE(var, val)       __atomic_exchange_n( &(var), (val), __ATOMIC_SEQ_CST )
+
+/* Lock-free multi producer queues, true if var held expected and was set to desired */
+#define ATOMIC_COMPARE_EXCHANGE(var, expected, desired)  __sync_bool_compare_and_swap( &(var), (expected), (desired) )
+#define ATOMIC_FETCH_ADD(var, val)      __atomic_fetch_add( &(var), (val), __ATOMIC_SEQ_CST )
+
+/* Change sets shared between threads, a set bit is only cleared by taking the whole word */
+#define ATOMIC_FETCH_OR(var, val)       __atomic_fetch_or( &(var), (val), __ATOMIC_SEQ_CST )
+
+/* Sequence locks, orders the accesses to the data guarded by a sequence counter */
+#define ATOMIC_FENCE_ACQUIRE()          __atomic_thread_fence( __ATOMIC_ACQUIRE )
+#define ATOMIC_FENCE_RELEASE()          __atomic_thread_fence( __ATOMIC_RELEASE )
+
 
 
 /******************************************************************************/
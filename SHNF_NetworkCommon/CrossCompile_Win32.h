@@ -44,6 +44,24 @@ typedef UINT32 THREAD_ID_TYPE;
 #define LOCK_BUFFER(buffer)                pthread_mutex_lock( &buffer )
 #define UNLOCK_BUFFER(buffer)           pthread_mutex_unlock( &buffer )
 
+/* Lock-free single producer / single consumer queues */
+#define CACHE_LINE_SIZE                 64
+#define ATOMIC_LOAD_ACQUIRE(var)        InterlockedCompareExchange( (LONG volatile *)&(var), 0, 0 )
+#define ATOMIC_STORE_RELEASE(var, val)  InterlockedExchange( (LONG volatile *)&(var), (LONG)(val) )
+#define ATOMIC_EXCHANGE(var, val)       InterlockedExchange( (LONG volatile *)&(var), (LONG)(val) )
+
+/* Lock-free multi producer queues, true if var held expected and was set to desired */
+#define ATOMIC_COMPARE_EXCHANGE(var, expected, desired)  \
+    ( InterlockedCompareExchange( (LONG volatile *)&(var), (LONG)(desired), (LONG)(expected) ) == (LONG)(expected) )
+#define ATOMIC_FETCH_ADD(var, val)      InterlockedExchangeAdd( (LONG volatile *)&(var), (LONG)(val) )
+
+/* Change sets shared between threads, a set bit is only cleared by taking the whole word */
+#define ATOMIC_FETCH_OR(var, val)       InterlockedOr( (LONG volatile *)&(var), (LONG)(val) )
+
+/* Sequence locks, orders the accesses to the data guarded by a sequence counter */
+#define ATOMIC_FENCE_ACQUIRE()          MemoryBarrier()
+#define ATOMIC_FENCE_RELEASE()          MemoryBarrier()
+
 
 
 /******************************************************************************/
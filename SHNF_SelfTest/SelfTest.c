@@ -0,0 +1,83 @@
+/*
+ * \file SHNF_SelfTest/SelfTest.c
+ * Single node self-test transport of the SHNF, see \file SHNFTransport.h
+ * \addtogroup Demo
+ * \addtogroup SHNF
+ * \{
+ *
+ * Every frame sent is inserted into the own RX ring, within the calling thread.
+ * No broker and no network is involved, so the stack of a single node can be run
+ * against itself, to measure its throughput and latency.
+ *
+ * Only one node takes part: the SHNF core drops the SNMT and SSDO frames, which
+ * are not addressed to the node itself, so the node only receives its own SPDOs
+ * and its requests to itself. Several nodes on one host are connected by the
+ * "shm" transport.
+ *
+ *****************************************************************************
+ * This source code is free software; you can redistribute it and/or modify it
+ * under the terms of the BSD license (according to License.txt).
+ *****************************************************************************/
+
+#include "EPLStarget.h"
+#include "EPLScfg.h"
+#include "EPLStypes.h"
+
+#include "SHNF.h"
+#include "SHNFBufferHandling.h"
+#include "SHNFTransport.h"
+
+/* Number of frames handed back */
+static UINT32 dw_selfTestFrames;
+
+/**
+ * This function starts the transport, there is nothing to connect to.
+ */
+static BOOLEAN selfTestStart ( UINT16 w_ownSadr )
+{
+    /* Avoid compiler warning */
+    w_ownSadr = w_ownSadr;
+
+    dw_selfTestFrames = 0;
+    return TRUE;
+}
+
+/**
+ * This function inserts the frame into the own RX ring. Frames not fitting into the
+ * ring are lost, as on a congested network.
+ */
+static BOOLEAN selfTestSend ( const UINT8 * pb_frame, UINT16 w_frameLength,
+                              SHNF_t_TEL_TYPE e_telType, UINT16 w_adr )
+{
+    /* Avoid compiler warning, the SHNF core filters the frames */
+    e_telType = e_telType;
+    w_adr = w_adr;
+
+    InsertIntoRXBuffer ( pb_frame, w_frameLength );
+    dw_selfTestFrames++;
+
+    return TRUE;
+}
+
+/**
+ * This function prints the number of frames handed back.
+ */
+static void selfTestPrintStatistics ( void )
+{
+    DATA_LOGGER1 ( "Self-test frames : %u\n", dw_selfTestFrames );
+}
+
+/* The single node self-test transport of the SHNF */
+const SHNF_t_TRANSPORT SHNF_s_SelfTestTransport =
+{
+    "selftest",
+    selfTestStart,
+    selfTestSend,
+    (void (*)(void))NULL,
+    (void (*)(UINT16))NULL,
+    (void (*)(UINT16))NULL,
+    selfTestPrintStatistics,
+    (void (*)(void))NULL
+};
+
+/* \} */
@@ -0,0 +1,64 @@
+/*
+ * \file SHNF_SharedMemory/SHMStep.h
+ * Step barrier of the simulated clock, in the shared memory segment
+ * \addtogroup Demo
+ * \addtogroup SHNF
+ * \{
+ *
+ * The nodes attached to the segment with the "simulated" clock do not step their
+ * clock on their own. Every node takes an entry of the step barrier and waits in
+ * \see SHNFTime_StartCycle, until the step driver (tools/shmstep) grants it the next
+ * step. The driver grants a step to one node after the other, in the order of their
+ * SADRs, and waits for each node to finish its application loop:
+ * - the driver writes the time of the step into ddw_timeUs of the node and increments
+ *   dw_granted, which wakes the node
+ * - the node moves the frames of its inbox into the RX ring, runs one application
+ *   loop with the time of the step and flushes its frames into the inboxes of the
+ *   receivers
+ * - at the start of its next loop, the node stores dw_granted into dw_done, which
+ *   wakes the driver
+ *
+ * As only one node runs at a time, the frames are enqueued in the same order on
+ * every run, and every node receives the frames sent before its turn. A run of
+ * SCM and SNs is therefore reproducible, whatever the load of the host.
+ *
+ * The barrier is at the start of the segment and does not depend on the
+ * configuration of the inboxes, so the driver only maps the barrier.
+ *
+ *****************************************************************************
+ * This source code is free software; you can redistribute it and/or modify it
+ * under the terms of the BSD license (according to License.txt).
+ *****************************************************************************/
+
+#ifndef SHM_STEP_H_
+#define SHM_STEP_H_
+
+/* Maximum number of nodes stepped together */
+#define k_SHM_STEP_MAX_NODES 32
+
+/* The entry of a node in the step barrier, on its own cache line */
+typedef struct
+{
+    /* SADR of the node owning the entry, 0 if the entry is free */
+    volatile UINT32 dw_sadr;
+    /* TRUE, if the node waits for its steps. Set by the node with its first step */
+    volatile UINT32 dw_ready;
+    /* number of steps granted, futex word the node waits on */
+    volatile UINT32 dw_granted;
+    /* number of steps finished, futex word the driver waits on */
+    volatile UINT32 dw_done;
+    /* simulated time of the step granted, in micro seconds. Written by the driver
+       before dw_granted is incremented */
+    volatile UINT64 ddw_timeUs;
+    UINT8 ab_pad[CACHE_LINE_SIZE - 4 * sizeof(UINT32) - sizeof(UINT64)];
+} t_SHM_STEP_NODE;
+
+/* The step barrier */
+typedef struct
+{
+    t_SHM_STEP_NODE as_nodes[k_SHM_STEP_MAX_NODES];
+} t_SHM_STEP;
+
+#endif /* SHM_STEP_H_ */
+
+/* \} */
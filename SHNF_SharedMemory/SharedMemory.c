@@ -0,0 +1,718 @@
+/*
+ * \file SHNF_SharedMemory/SharedMemory.c
+ * Shared memory transport of the SHNF, see \file SHNFTransport.h
+ * \addtogroup Demo
+ * \addtogroup SHNF
+ * \{
+ *
+ * The nodes of one safety domain running on the same host attach to a POSIX shared
+ * memory segment, named k_SHM_SEGMENT_NAME. The segment holds an inbox for every
+ * node, a bounded ring of frame slots with many producers (the other nodes) and a
+ * single consumer (the receiver thread of the owning node). No broker and no network
+ * stack is involved, a frame is copied into the inbox by the sender and out of it
+ * into the RX ring by the receiver.
+ *
+ * - SPDOs are copied into the inbox of every other node attached
+ * - SNMT and SSDO frames are copied into the inbox of the node with the SADR of the
+ *   ADR field only. Frames to nodes not attached are lost, as on the network
+ *
+ * A receiver without frames sleeps on a futex word of its inbox, which is incremented
+ * and woken by the senders once per flush.
+ *
+ * With the "simulated" clock, the node takes part in the step barrier at the start
+ * of the segment (see \file SHMStep.h) instead. It has no receiver thread then, the
+ * frames of the inbox are moved into the RX ring by the application loop, at the
+ * start of every step.
+ *
+ * The inbox rings keep a sequence number per slot (D. Vyukov, bounded MPMC queue),
+ * stored relative to the index of the slot. A segment filled with zeros, as created
+ * by ftruncate, is therefore a valid segment with free inboxes.
+ *
+ *****************************************************************************
+ * This source code is free software; you can redistribute it and/or modify it
+ * under the terms of the BSD license (according to License.txt).
+ *****************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "EPLStarget.h"
+#include "EPLScfg.h"
+#include "EPLStypes.h"
+
+#include "SHNF.h"
+#include "SHNF_Definitions.h"
+#include "SHNFBufferHandling.h"
+#include "SHNFTransport.h"
+
+#include "SHM_Configuration.h"
+#include "Time.h"
+
+#ifdef linux
+
+#include <fcntl.h>
+#include <limits.h>
+#include <time.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <linux/futex.h>
+
+#include "SHMStep.h"
+
+#if ( k_SHM_MAX_NODES > 32 )
+#error k_SHM_MAX_NODES has to be at most 32, the inboxes to wake are kept in a bit mask
+#endif
+
+#if ( ( k_SHM_RING_SIZE & ( k_SHM_RING_SIZE - 1 ) ) != 0 )
+#error k_SHM_RING_SIZE has to be a power of two
+#endif
+
+#define k_SHM_RING_MASK ( k_SHM_RING_SIZE - 1 )
+
+/* Maximum number of frames moved from the inbox to the RX ring at once */
+#define k_SHM_RX_BATCH  8
+
+/* A frame slot of an inbox */
+typedef struct
+{
+    /* sequence number of the slot, minus the index of the slot. The slot is free
+       for the producer at position dw_seq + index, and holds the frame of position
+       dw_seq + index - 1 for the consumer */
+    volatile UINT32 dw_seq;
+    UINT16 w_length;
+    UINT8 ab_frame[k_openSAFETY_BUFFER_SIZE];
+} t_SHM_SLOT;
+
+/* The inbox of a node. The fields written by the producers, by the consumer and the
+   slots are on separate cache lines */
+typedef struct
+{
+    /* SADR of the node owning the inbox, 0 if the inbox is free */
+    volatile UINT32 dw_sadr;
+    /* futex word, incremented by the producers after frames have been enqueued */
+    volatile UINT32 dw_wakeup;
+    /* TRUE while the consumer is about to sleep on dw_wakeup */
+    volatile UINT32 dw_waiting;
+    UINT8 ab_pad0[CACHE_LINE_SIZE - 3 * sizeof(UINT32)];
+
+    /* next position to be claimed by a producer */
+    volatile UINT32 dw_enqueuePos;
+    UINT8 ab_pad1[CACHE_LINE_SIZE - sizeof(UINT32)];
+
+    /* next position to be read by the consumer */
+    volatile UINT32 dw_dequeuePos;
+    UINT8 ab_pad2[CACHE_LINE_SIZE - sizeof(UINT32)];
+
+    t_SHM_SLOT as_slots[k_SHM_RING_SIZE];
+} t_SHM_INBOX;
+
+/* Layout of the shared memory segment, the step barrier has to be the first member */
+typedef struct
+{
+    t_SHM_STEP s_step;
+    t_SHM_INBOX as_inboxes[k_SHM_MAX_NODES];
+} t_SHM_SEGMENT;
+
+/* The mapped segment, NULL if not attached */
+static t_SHM_SEGMENT * ps_segment = (t_SHM_SEGMENT *)NULL;
+/* The inbox of this node */
+static t_SHM_INBOX * ps_ownInbox = (t_SHM_INBOX *)NULL;
+
+/* Inboxes with frames enqueued since the last flush, one bit per inbox */
+static UINT32 dw_wakeMask;
+
+/* The entry of this node in the step barrier, NULL if the node steps on its own */
+static t_SHM_STEP_NODE * ps_ownStep = (t_SHM_STEP_NODE *)NULL;
+/* The step granted last to this node */
+static UINT32 dw_ownStep;
+
+static THREAD_TYPE s_receiverThread;
+static volatile BOOLEAN o_stopReceiver;
+
+/* Statistics */
+static UINT32 dw_txFrames;
+static UINT32 dw_txDropped;
+static UINT32 dw_txUnroutable;
+static UINT32 dw_txWakeups;
+static UINT32 dw_rxFrames;
+static UINT32 dw_rxSleeps;
+
+static THREAD_FUNC thread_ShmReceiver ( THREAD_FUNC_ARGUMENTS queueArguments );
+
+/**
+ * This function copies a frame into an inbox. It may be called by any number of
+ * producers at once, in any process attached.
+ *
+ * \return - TRUE  - the frame is enqueued
+ *         - FALSE - the inbox is full
+ */
+static BOOLEAN shmEnqueue ( t_SHM_INBOX * ps_inbox, const UINT8 * pb_frame, UINT16 w_frameLength )
+{
+    t_SHM_SLOT * ps_slot;
+    UINT32 dw_pos;
+    UINT32 dw_seq;
+    INT32 l_diff;
+
+    dw_pos = ATOMIC_LOAD_ACQUIRE ( ps_inbox->dw_enqueuePos );
+    for ( ;; )
+    {
+        ps_slot = &ps_inbox->as_slots[dw_pos & k_SHM_RING_MASK];
+        dw_seq = ATOMIC_LOAD_ACQUIRE ( ps_slot->dw_seq ) + ( dw_pos & k_SHM_RING_MASK );
+        l_diff = (INT32)( dw_seq - dw_pos );
+
+        if ( l_diff == 0 )
+        {
+            /* the slot is free, claim the position */
+            if ( ATOMIC_COMPARE_EXCHANGE ( ps_inbox->dw_enqueuePos, dw_pos, dw_pos + 1 ) )
+            {
+                break;
+            }
+        }
+        else if ( l_diff < 0 )
+        {
+            /* the slot still holds the frame of the previous round */
+            return FALSE;
+        }
+        /* no else : another producer claimed the position */
+
+        dw_pos = ATOMIC_LOAD_ACQUIRE ( ps_inbox->dw_enqueuePos );
+    }
+
+    memcpy ( ps_slot->ab_frame, pb_frame, w_frameLength );
+    ps_slot->w_length = w_frameLength;
+    ATOMIC_STORE_RELEASE ( ps_slot->dw_seq, dw_pos + 1 - ( dw_pos & k_SHM_RING_MASK ) );
+
+    return TRUE;
+}
+
+/**
+ * This function copies the oldest frame out of the own inbox. Only the receiver of
+ * the owning node calls it.
+ *
+ * \retval pw_frameLength the length of the frame, 0 if it is not valid
+ *
+ * \return - TRUE  - a frame has been dequeued
+ *         - FALSE - the inbox is empty
+ */
+static BOOLEAN shmDequeue ( t_SHM_INBOX * ps_inbox, UINT8 * pb_frame, UINT16 * pw_frameLength )
+{
+    t_SHM_SLOT * ps_slot;
+    UINT32 dw_pos;
+    UINT32 dw_seq;
+
+    dw_pos = ps_inbox->dw_dequeuePos;
+    ps_slot = &ps_inbox->as_slots[dw_pos & k_SHM_RING_MASK];
+    dw_seq = ATOMIC_LOAD_ACQUIRE ( ps_slot->dw_seq ) + ( dw_pos & k_SHM_RING_MASK );
+
+    /* empty, or the producer of this position has not finished yet */
+    if ( dw_seq != dw_pos + 1 )
+    {
+        return FALSE;
+    }
+
+    *pw_frameLength = ps_slot->w_length;
+    if ( *pw_frameLength > k_openSAFETY_BUFFER_SIZE )
+    {
+        *pw_frameLength = 0;
+    }
+    memcpy ( pb_frame, ps_slot->ab_frame, *pw_frameLength );
+
+    /* free the slot for the next round */
+    ATOMIC_STORE_RELEASE ( ps_slot->dw_seq, dw_pos + k_SHM_RING_SIZE - ( dw_pos & k_SHM_RING_MASK ) );
+    ATOMIC_STORE_RELEASE ( ps_inbox->dw_dequeuePos, dw_pos + 1 );
+
+    return TRUE;
+}
+
+/**
+ * This function checks, if no frame is waiting in the own inbox.
+ */
+static BOOLEAN shmIsEmpty ( t_SHM_INBOX * ps_inbox )
+{
+    UINT32 dw_pos;
+
+    dw_pos = ps_inbox->dw_dequeuePos;
+    return ( ATOMIC_LOAD_ACQUIRE ( ps_inbox->as_slots[dw_pos & k_SHM_RING_MASK].dw_seq ) +
+             ( dw_pos & k_SHM_RING_MASK ) ) != dw_pos + 1;
+}
+
+/**
+ * This function wakes the receiver of an inbox, if it sleeps.
+ */
+static void shmWake ( t_SHM_INBOX * ps_inbox )
+{
+    ATOMIC_FETCH_ADD ( ps_inbox->dw_wakeup, 1 );
+    if ( ATOMIC_LOAD_ACQUIRE ( ps_inbox->dw_waiting ) )
+    {
+        syscall ( SYS_futex, &ps_inbox->dw_wakeup, FUTEX_WAKE, INT_MAX, NULL, NULL, 0 );
+        dw_txWakeups++;
+    }
+}
+
+/**
+ * This function discards all frames left in the own inbox, by a previous owner.
+ */
+static void shmDrain ( t_SHM_INBOX * ps_inbox )
+{
+    static UINT8 ab_discard[k_openSAFETY_BUFFER_SIZE];
+    UINT16 w_frameLength;
+
+    while ( shmDequeue ( ps_inbox, ab_discard, &w_frameLength ) )
+    {
+        ;
+    }
+}
+
+/**
+ * This function claims an entry of the step barrier for this node. The driver does
+ * not grant steps to the entry, until the node waits for its first step.
+ *
+ * \return - TRUE  - the entry is claimed
+ *         - FALSE - all entries are taken
+ */
+static BOOLEAN shmJoinSteps ( UINT16 w_ownSadr )
+{
+    t_SHM_STEP_NODE * ps_step;
+    UINT32 i;
+
+    /* the entry of a previous run of this node, otherwise a free one */
+    ps_ownStep = (t_SHM_STEP_NODE *)NULL;
+    for ( i = 0; i < k_SHM_STEP_MAX_NODES && ps_ownStep == NULL; i++ )
+    {
+        ps_step = &ps_segment->s_step.as_nodes[i];
+        if ( ATOMIC_LOAD_ACQUIRE ( ps_step->dw_sadr ) == w_ownSadr )
+        {
+            ATOMIC_STORE_RELEASE ( ps_step->dw_ready, FALSE );
+            ps_ownStep = ps_step;
+        }
+    }
+    for ( i = 0; i < k_SHM_STEP_MAX_NODES && ps_ownStep == NULL; i++ )
+    {
+        ps_step = &ps_segment->s_step.as_nodes[i];
+        if ( ATOMIC_COMPARE_EXCHANGE ( ps_step->dw_sadr, 0, (UINT32)w_ownSadr ) )
+        {
+            ps_ownStep = ps_step;
+        }
+    }
+
+    return ( ps_ownStep != NULL );
+}
+
+/**
+ * This function leaves the step barrier. A driver waiting for this node goes on
+ * with the next one.
+ */
+static void shmLeaveSteps ( void )
+{
+    ATOMIC_STORE_RELEASE ( ps_ownStep->dw_ready, FALSE );
+    ATOMIC_STORE_RELEASE ( ps_ownStep->dw_done, ATOMIC_LOAD_ACQUIRE ( ps_ownStep->dw_granted ) );
+    ATOMIC_STORE_RELEASE ( ps_ownStep->dw_sadr, 0 );
+    syscall ( SYS_futex, &ps_ownStep->dw_done, FUTEX_WAKE, INT_MAX, NULL, NULL, 0 );
+
+    SHNFTime_SetStepFunction ( (SHNFTime_t_STEP_FUNC)NULL );
+    ps_ownStep = (t_SHM_STEP_NODE *)NULL;
+}
+
+/**
+ * This function moves the frames of the own inbox into the RX ring, until the inbox
+ * is empty or the RX ring is full. Frames left in the inbox are received with the
+ * next step.
+ */
+static void shmReceiveStep ( void )
+{
+    UINT8 * apb_slots[k_SHM_RX_BATCH];
+    UINT16 aw_lengths[k_SHM_RX_BATCH];
+    UINT32 dw_numSlots;
+    UINT32 dw_numFrames;
+
+    do
+    {
+        dw_numSlots = SHNF_AcquireRxSlots ( apb_slots, k_SHM_RX_BATCH );
+
+        dw_numFrames = 0;
+        while ( dw_numFrames < dw_numSlots &&
+                shmDequeue ( ps_ownInbox, apb_slots[dw_numFrames], &aw_lengths[dw_numFrames] ) )
+        {
+            dw_numFrames++;
+        }
+
+        if ( dw_numFrames > 0 )
+        {
+            dw_rxFrames += SHNF_CommitRxSlots ( aw_lengths, dw_numFrames );
+        }
+    } while ( dw_numFrames == k_SHM_RX_BATCH );
+}
+
+/**
+ * This function is the step function of the simulated clock, called at the start of
+ * every application loop. It finishes the step granted before, as the frames of the
+ * loop have been flushed into the inboxes by now, and waits for the next step.
+ *
+ * \return the simulated time of the step in micro seconds
+ */
+static UINT64 shmWaitForStep ( void )
+{
+    struct timespec s_timeout;
+
+    s_timeout.tv_sec = k_SHM_WAIT_TIMEOUT_US / 1000000;
+    s_timeout.tv_nsec = ( k_SHM_WAIT_TIMEOUT_US % 1000000 ) * 1000;
+
+    if ( ! ATOMIC_LOAD_ACQUIRE ( ps_ownStep->dw_ready ) )
+    {
+        /* the first step, the steps granted to a previous run are finished */
+        dw_ownStep = ATOMIC_LOAD_ACQUIRE ( ps_ownStep->dw_granted );
+        ATOMIC_STORE_RELEASE ( ps_ownStep->dw_done, dw_ownStep );
+        ATOMIC_STORE_RELEASE ( ps_ownStep->dw_ready, TRUE );
+    }
+    else
+    {
+        ATOMIC_STORE_RELEASE ( ps_ownStep->dw_done, dw_ownStep );
+        syscall ( SYS_futex, &ps_ownStep->dw_done, FUTEX_WAKE, INT_MAX, NULL, NULL, 0 );
+    }
+
+    while ( ATOMIC_LOAD_ACQUIRE ( ps_ownStep->dw_granted ) == dw_ownStep )
+    {
+        dw_rxSleeps++;
+        syscall ( SYS_futex, &ps_ownStep->dw_granted, FUTEX_WAIT, dw_ownStep, &s_timeout, NULL, 0 );
+    }
+    dw_ownStep++;
+
+    shmReceiveStep();
+
+    return ps_ownStep->ddw_timeUs;
+}
+
+/**
+ * This function maps the segment, creating it if this is the first node, and claims
+ * an inbox for this node. A node started again with the same SADR gets its inbox back.
+ */
+static BOOLEAN shmStart ( UINT16 w_ownSadr )
+{
+    struct stat s_stat;
+    int i_fd;
+    int i_result;
+    UINT32 i;
+
+    dw_txFrames = 0;
+    dw_txDropped = 0;
+    dw_txUnroutable = 0;
+    dw_txWakeups = 0;
+    dw_rxFrames = 0;
+    dw_rxSleeps = 0;
+    dw_wakeMask = 0;
+
+    i_fd = shm_open ( k_SHM_SEGMENT_NAME, O_CREAT | O_RDWR, k_SHM_SEGMENT_MODE );
+    if ( i_fd < 0 )
+    {
+        DATA_LOGGER2 ( "shm_open of %s failed: %s\n", k_SHM_SEGMENT_NAME, strerror ( errno ) );
+        return FALSE;
+    }
+
+    /* only the first node sizes the segment, the others have to agree on its layout */
+    if ( fstat ( i_fd, &s_stat ) != 0 ||
+         ( s_stat.st_size == 0 && ftruncate ( i_fd, sizeof(t_SHM_SEGMENT) ) != 0 ) )
+    {
+        DATA_LOGGER2 ( "Sizing %s failed: %s\n", k_SHM_SEGMENT_NAME, strerror ( errno ) );
+        close ( i_fd );
+        return FALSE;
+    }
+    if ( s_stat.st_size != 0 && s_stat.st_size != (off_t)sizeof(t_SHM_SEGMENT) )
+    {
+        DATA_LOGGER2 ( "Segment %s has %ld bytes, the configuration of this node expects another layout\n",
+                       k_SHM_SEGMENT_NAME, (long)s_stat.st_size );
+        close ( i_fd );
+        return FALSE;
+    }
+
+    ps_segment = (t_SHM_SEGMENT *)mmap ( NULL, sizeof(t_SHM_SEGMENT), PROT_READ | PROT_WRITE,
+                                         MAP_SHARED, i_fd, 0 );
+    close ( i_fd );
+    if ( ps_segment == (t_SHM_SEGMENT *)MAP_FAILED )
+    {
+        DATA_LOGGER1 ( "mmap of %s failed\n", k_SHM_SEGMENT_NAME );
+        ps_segment = (t_SHM_SEGMENT *)NULL;
+        return FALSE;
+    }
+
+    /* the inbox of a previous run of this node, otherwise a free one */
+    ps_ownInbox = (t_SHM_INBOX *)NULL;
+    for ( i = 0; i < k_SHM_MAX_NODES && ps_ownInbox == NULL; i++ )
+    {
+        if ( ATOMIC_LOAD_ACQUIRE ( ps_segment->as_inboxes[i].dw_sadr ) == w_ownSadr )
+        {
+            ps_ownInbox = &ps_segment->as_inboxes[i];
+        }
+    }
+    for ( i = 0; i < k_SHM_MAX_NODES && ps_ownInbox == NULL; i++ )
+    {
+        if ( ATOMIC_COMPARE_EXCHANGE ( ps_segment->as_inboxes[i].dw_sadr, 0, (UINT32)w_ownSadr ) )
+        {
+            ps_ownInbox = &ps_segment->as_inboxes[i];
+        }
+    }
+    if ( ps_ownInbox == NULL )
+    {
+        DATA_LOGGER1 ( "No free inbox in %s\n", k_SHM_SEGMENT_NAME );
+        munmap ( ps_segment, sizeof(t_SHM_SEGMENT) );
+        ps_segment = (t_SHM_SEGMENT *)NULL;
+        return FALSE;
+    }
+
+    shmDrain ( ps_ownInbox );
+
+    if ( SHNFTime_IsSimulated() )
+    {
+        if ( ! shmJoinSteps ( w_ownSadr ) )
+        {
+            DATA_LOGGER1 ( "No free entry in the step barrier of %s\n", k_SHM_SEGMENT_NAME );
+            ATOMIC_STORE_RELEASE ( ps_ownInbox->dw_sadr, 0 );
+            munmap ( ps_segment, sizeof(t_SHM_SEGMENT) );
+            ps_segment = (t_SHM_SEGMENT *)NULL;
+            return FALSE;
+        }
+
+        /* the application loop receives the frames at the start of every step */
+        SHNFTime_SetStepFunction ( shmWaitForStep );
+        DATA_LOGGER1 ( "Waiting for the steps of the step driver on %s\n", k_SHM_SEGMENT_NAME );
+    }
+    else
+    {
+        o_stopReceiver = FALSE;
+        CREATE_THREAD(s_receiverThread, thread_ShmReceiver, i_result);
+        if ( THREAD_FAILURE ( i_result ) )
+        {
+            DATA_LOGGER ( "Creating the shared memory receiver failed\n" );
+            ATOMIC_STORE_RELEASE ( ps_ownInbox->dw_sadr, 0 );
+            munmap ( ps_segment, sizeof(t_SHM_SEGMENT) );
+            ps_segment = (t_SHM_SEGMENT *)NULL;
+            return FALSE;
+        }
+    }
+
+    DATA_LOGGER2 ( "Attached to %s, inbox %u\n", k_SHM_SEGMENT_NAME,
+                   (UINT32)( ps_ownInbox - ps_segment->as_inboxes ) );
+    return TRUE;
+}
+
+/**
+ * This function copies the frame into the inboxes of its receivers. The receivers
+ * are woken by \see shmFlush.
+ */
+static BOOLEAN shmSend ( const UINT8 * pb_frame, UINT16 w_frameLength,
+                         SHNF_t_TEL_TYPE e_telType, UINT16 w_adr )
+{
+    t_SHM_INBOX * ps_inbox;
+    UINT32 dw_sadr;
+    UINT32 i;
+
+    for ( i = 0; i < k_SHM_MAX_NODES; i++ )
+    {
+        ps_inbox = &ps_segment->as_inboxes[i];
+        dw_sadr = ATOMIC_LOAD_ACQUIRE ( ps_inbox->dw_sadr );
+
+        if ( e_telType == SHNF_k_SPDO )
+        {
+            /* SPDOs are received by every other node */
+            if ( dw_sadr == 0 || ps_inbox == ps_ownInbox )
+            {
+                continue;
+            }
+            if ( shmEnqueue ( ps_inbox, pb_frame, w_frameLength ) )
+            {
+                dw_wakeMask |= ( 1UL << i );
+            }
+            else
+            {
+                /* superseded by the next SPDO anyway */
+                dw_txDropped++;
+            }
+        }
+        else if ( dw_sadr == w_adr )
+        {
+            if ( ! shmEnqueue ( ps_inbox, pb_frame, w_frameLength ) )
+            {
+                /* the core keeps the frame and sends it again later */
+                return FALSE;
+            }
+            dw_wakeMask |= ( 1UL << i );
+            dw_txFrames++;
+            return TRUE;
+        }
+        /* no else : not a receiver of this frame */
+    }
+
+    if ( e_telType == SHNF_k_SPDO )
+    {
+        dw_txFrames++;
+    }
+    else
+    {
+        /* no node with this SADR attached, the stack repeats on timeout */
+        dw_txUnroutable++;
+    }
+
+    return TRUE;
+}
+
+/**
+ * This function wakes the receivers of the frames sent since the last flush.
+ */
+static void shmFlush ( void )
+{
+    UINT32 i;
+
+    for ( i = 0; dw_wakeMask != 0; i++ )
+    {
+        if ( dw_wakeMask & ( 1UL << i ) )
+        {
+            shmWake ( &ps_segment->as_inboxes[i] );
+            dw_wakeMask &= ~( 1UL << i );
+        }
+    }
+}
+
+/**
+ * This function prints the statistics of the shared memory transport.
+ */
+static void shmPrintStatistics ( void )
+{
+    DATA_LOGGER3 ( "SHM TX frames : %u, dropped (inbox full) : %u, unroutable : %u\n",
+                   dw_txFrames, dw_txDropped, dw_txUnroutable );
+    DATA_LOGGER3 ( "SHM RX frames : %u, sleeps : %u, wake ups sent : %u\n",
+                   dw_rxFrames, dw_rxSleeps, dw_txWakeups );
+}
+
+/**
+ * This function stops the receiver, frees the inbox and unmaps the segment. The
+ * segment itself stays, for the other nodes.
+ */
+static void shmStop ( void )
+{
+    if ( ps_segment == NULL )
+    {
+        return;
+    }
+
+    if ( ps_ownStep != NULL )
+    {
+        shmLeaveSteps();
+    }
+    else
+    {
+        o_stopReceiver = TRUE;
+        ATOMIC_STORE_RELEASE ( ps_ownInbox->dw_waiting, TRUE );
+        shmWake ( ps_ownInbox );
+        pthread_join ( s_receiverThread, NULL );
+    }
+
+    ATOMIC_STORE_RELEASE ( ps_ownInbox->dw_sadr, 0 );
+    munmap ( ps_segment, sizeof(t_SHM_SEGMENT) );
+    ps_segment = (t_SHM_SEGMENT *)NULL;
+    ps_ownInbox = (t_SHM_INBOX *)NULL;
+}
+
+/**
+ * This thread moves the frames from the own inbox into the RX ring. Without frames
+ * it sleeps on the futex word of the inbox.
+ */
+static THREAD_FUNC thread_ShmReceiver ( THREAD_FUNC_ARGUMENTS queueArguments )
+{
+    UINT8 * apb_slots[k_SHM_RX_BATCH];
+    UINT16 aw_lengths[k_SHM_RX_BATCH];
+    struct timespec s_timeout;
+    UINT32 dw_numSlots;
+    UINT32 dw_numFrames;
+    UINT32 dw_wakeup;
+
+    /* Avoid compiler warning */
+    queueArguments = queueArguments;
+
+    s_timeout.tv_sec = k_SHM_WAIT_TIMEOUT_US / 1000000;
+    s_timeout.tv_nsec = ( k_SHM_WAIT_TIMEOUT_US % 1000000 ) * 1000;
+
+    while ( ! o_stopReceiver )
+    {
+        dw_numSlots = SHNF_AcquireRxSlots ( apb_slots, k_SHM_RX_BATCH );
+        if ( dw_numSlots == 0 )
+        {
+            /* the RX ring is full, the frames wait in the inbox */
+            usleep ( k_openSAFETY_EVENT_TICK_US );
+            continue;
+        }
+
+        dw_numFrames = 0;
+        while ( dw_numFrames < dw_numSlots &&
+                shmDequeue ( ps_ownInbox, apb_slots[dw_numFrames], &aw_lengths[dw_numFrames] ) )
+        {
+            dw_numFrames++;
+        }
+
+        if ( dw_numFrames > 0 )
+        {
+            dw_rxFrames += SHNF_CommitRxSlots ( aw_lengths, dw_numFrames );
+            continue;
+        }
+
+        /* Announce the sleep, then check again. A frame enqueued after reading the
+           futex word changes it, so the wait returns at once */
+        dw_wakeup = ATOMIC_LOAD_ACQUIRE ( ps_ownInbox->dw_wakeup );
+        ATOMIC_EXCHANGE ( ps_ownInbox->dw_waiting, TRUE );
+        if ( shmIsEmpty ( ps_ownInbox ) && ! o_stopReceiver )
+        {
+            dw_rxSleeps++;
+            syscall ( SYS_futex, &ps_ownInbox->dw_wakeup, FUTEX_WAIT, dw_wakeup, &s_timeout, NULL, 0 );
+        }
+        ATOMIC_STORE_RELEASE ( ps_ownInbox->dw_waiting, FALSE );
+    }
+
+    return NULL;
+}
+
+#else /* linux */
+
+/**
+ * The shared memory transport relies on POSIX shared memory and futexes.
+ */
+static BOOLEAN shmStart ( UINT16 w_ownSadr )
+{
+    /* Avoid compiler warning */
+    w_ownSadr = w_ownSadr;
+
+    DATA_LOGGER ( "The shared memory transport is only available on linux\n" );
+    return FALSE;
+}
+
+static BOOLEAN shmSend ( const UINT8 * pb_frame, UINT16 w_frameLength,
+                         SHNF_t_TEL_TYPE e_telType, UINT16 w_adr )
+{
+    /* Avoid compiler warning */
+    pb_frame = pb_frame;
+    w_frameLength = w_frameLength;
+    e_telType = e_telType;
+    w_adr = w_adr;
+
+    return TRUE;
+}
+
+#define shmFlush            ( (void (*)(void))NULL )
+#define shmPrintStatistics  ( (void (*)(void))NULL )
+#define shmStop             ( (void (*)(void))NULL )
+
+#endif /* linux */
+
+/* The shared memory transport of the SHNF */
+const SHNF_t_TRANSPORT SHNF_s_ShmTransport =
+{
+    "shm",
+    shmStart,
+    shmSend,
+    shmFlush,
+    (void (*)(UINT16))NULL,
+    (void (*)(UINT16))NULL,
+    shmPrintStatistics,
+    shmStop
+};
+
+/* \} */
@@ -29,98 +29,329 @@
 #endif
 
 #include <stdlib.h>
+#include <string.h>
 
 #include "Time.h"
 
+/* Nano seconds per second */
+#define k_NSEC_PER_SEC  1000000000UL
+
+/* Number of bits of the nano seconds within a second, 10^9 < 2^30 */
+#define k_NSEC_BITS     30
+
+/**
+ * \brief Factors converting an elapsed time of seconds and nano seconds into a time
+ * base. The nano seconds are divided by a multiplication and a shift, which is exact
+ * for all values below 2^k_NSEC_BITS, as the shift is k_NSEC_BITS + ceil(log2(divisor))
+ * (T. Granlund, P. Montgomery, Division by invariant integers using multiplication)
+ */
+typedef struct
+{
+    UINT32 dw_unitsPerSec; /* units of the time base per second */
+    UINT64 ddw_mult;       /* ceil(2^b_shift / divisor) */
+    UINT8  b_shift;
+} t_TIMEBASE_FACTORS;
+
+#define TIMEBASE_FACTORS(divisor, log2Divisor)                                          \
+    { (UINT32)( k_NSEC_PER_SEC / (divisor) ),                                           \
+      ( ( (UINT64)1 << ( k_NSEC_BITS + (log2Divisor) ) ) + (divisor) - 1 ) / (divisor), \
+      (UINT8)( k_NSEC_BITS + (log2Divisor) ) }
+
+/* Factors per time base, indexed by openSAFETY_TIMEBASE */
+static const t_TIMEBASE_FACTORS as_timeBaseFactors[k_SHNFTIME_NUM_TIMEBASES] =
+{
+    TIMEBASE_FACTORS ( 1000UL, 10 ),    /* k_openSAFETY_TIMEBASE_1US   */
+    TIMEBASE_FACTORS ( 10000UL, 14 ),   /* k_openSAFETY_TIMEBASE_10US  */
+    TIMEBASE_FACTORS ( 100000UL, 17 ),  /* k_openSAFETY_TIMEBASE_100US */
+    TIMEBASE_FACTORS ( 1000000UL, 20 )  /* k_openSAFETY_TIMEBASE_1MS   */
+};
+
 /**
  * \brief For demo purposes, we will increment the timer, starting with zero at system start,
  * Therefore the initial start value of the system will be stored
  */
-UINT64 *i_initialTimerValue = 0;
+static BOOLEAN o_initialTimerValid = FALSE;
+static UINT64 ddw_initialSec;
+static UINT32 dw_initialNsec;
+
+/* Time of the simulated clock, only advanced per cycle or set to the time of a step */
+static UINT64 ddw_simulatedSec;
+static UINT32 dw_simulatedNsec;
+
+/* Step function of the simulated clock, NULL if the clock steps once per cycle */
+static SHNFTime_t_STEP_FUNC pf_stepFunc = (SHNFTime_t_STEP_FUNC)NULL;
+
+/* A clock the consecutive time is derived from */
+typedef struct
+{
+    /* name of the clock, see SHNFTime_SelectClock */
+    const char * pc_name;
+    /* returns the time elapsed since the start, FALSE if the clock cannot be read */
+    BOOLEAN ( *pf_Read ) ( UINT64 * pddw_sec, UINT32 * pdw_nsec );
+    /* TRUE, if the clock only advances on request */
+    BOOLEAN o_simulated;
+} t_CLOCK_SOURCE;
+
+static BOOLEAN ReadMonotonicClock(UINT64 * pddw_sec, UINT32 * pdw_nsec);
+static BOOLEAN ReadSimulatedClock(UINT64 * pddw_sec, UINT32 * pdw_nsec);
+static void AdvanceSimulatedClock(UINT32 dw_us);
+
+/* The clocks, which can be selected by name */
+static const t_CLOCK_SOURCE as_clockSources[] =
+{
+    { "monotonic", ReadMonotonicClock, FALSE },
+    { "simulated", ReadSimulatedClock, TRUE }
+};
+
+/* The selected clock, NULL until selected */
+static const t_CLOCK_SOURCE * ps_clockSource = (const t_CLOCK_SOURCE *)NULL;
+
+/* The consecutive time of the current application cycle, per time base */
+UINT64 SHNFTime_addw_cycleCt[k_SHNFTIME_NUM_TIMEBASES];
 
 /**
- * \brief This function returns a timer value with the specified time base (resolution)
+ * \brief This function reads the system clock and returns the time elapsed since the
+ * first call
  *
- * \param e_timeBase the time base (\see openSAFETY_TIMEBASE)
+ * \retval pddw_sec  the elapsed seconds
+ * \retval pdw_nsec  the elapsed nano seconds within the second
  *
- * \return 32 bit timer value
+ * \return - TRUE  - the clock has been read
+ *         - FALSE - reading the clock failed
  **/
-UINT32 SHNFTime_getTime(openSAFETY_TIMEBASE e_timeBase)
+static BOOLEAN ReadMonotonicClock(UINT64 * pddw_sec, UINT32 * pdw_nsec)
 {
-    UINT64 d_elapsedTime;
-    UINT32 u_timeFactor;
+    UINT64 ddw_sec;
+    UINT32 dw_nsec;
 
 #if WIN32
+    UINT64 ddw_hectoNanoSec;
 
-    u_timeFactor = 10;
+    /* the resolution is 100ns */
+    ddw_hectoNanoSec = gethectonanotime_first();
+    ddw_sec = ddw_hectoNanoSec / 10000000;
+    dw_nsec = (UINT32)( ddw_hectoNanoSec % 10000000 ) * 100;
+#else
+    struct timespec l_clockTime;
 
-    if ( i_initialTimerValue == 0 )
+    if ( clock_gettime( CLOCK_MONOTONIC, &l_clockTime) == -1 )
     {
-        i_initialTimerValue = (UINT64 *)malloc(sizeof(long));
-        *i_initialTimerValue = gethectonanotime_last();
+        return FALSE;
     }
 
-    d_elapsedTime = ( gethectonanotime_first() - *i_initialTimerValue ) / 10000;
+    ddw_sec = (UINT64)l_clockTime.tv_sec;
+    dw_nsec = (UINT32)l_clockTime.tv_nsec;
+#endif
 
-    Sleep(100);
+    if ( ! o_initialTimerValid )
+    {
+        ddw_initialSec = ddw_sec;
+        dw_initialNsec = dw_nsec;
+        o_initialTimerValid = TRUE;
+    }
 
-#else
-  struct timespec l_clockTime;
+    if ( dw_nsec < dw_initialNsec )
+    {
+        dw_nsec += k_NSEC_PER_SEC;
+        ddw_sec--;
+    }
+
+    if ( ddw_sec < ddw_initialSec )
+    {
+        DATA_LOGGER("Time is negative\n");
+        return FALSE;
+    }
+
+    *pddw_sec = ddw_sec - ddw_initialSec;
+    *pdw_nsec = dw_nsec - dw_initialNsec;
+
+    return TRUE;
+}
+
+/**
+ * \brief This function returns the time of the simulated clock, which starts with zero
+ **/
+static BOOLEAN ReadSimulatedClock(UINT64 * pddw_sec, UINT32 * pdw_nsec)
+{
+    *pddw_sec = ddw_simulatedSec;
+    *pdw_nsec = dw_simulatedNsec;
+
+    return TRUE;
+}
+
+/**
+ * \brief This function returns the selected clock. Without a selection, the clock
+ * named by the environment variable k_openSAFETY_CLOCK_ENV is selected, or
+ * k_openSAFETY_CLOCK if it is not set
+ **/
+static const t_CLOCK_SOURCE * GetClockSource(void)
+{
+    const char * pc_name;
+
+    if ( ps_clockSource == NULL )
+    {
+        pc_name = getenv ( k_openSAFETY_CLOCK_ENV );
+        if ( ( pc_name == NULL ) || ( ! SHNFTime_SelectClock ( pc_name ) ) )
+        {
+            (void)SHNFTime_SelectClock ( k_openSAFETY_CLOCK );
+        }
+        /* no else : selected by the environment */
+
+        if ( ps_clockSource == NULL )
+        {
+            ps_clockSource = &as_clockSources[0];
+        }
+        DATA_LOGGER1 ( "SHNF clock: %s\n", ps_clockSource->pc_name );
+    }
 
-  // u_timeFactor corresponds to the fact, that the result of
-  // the time calculation leads to a 1 musec value
-  u_timeFactor = 10;
+    return ps_clockSource;
+}
 
-  // get the current system time (the resolution is 100ns)
-  if ( clock_gettime( CLOCK_MONOTONIC, &l_clockTime) == -1 ) {
-      return 0;
-  }
+/**
+ * \brief This function reads the selected clock
+ **/
+static BOOLEAN ReadElapsedTime(UINT64 * pddw_sec, UINT32 * pdw_nsec)
+{
+    return GetClockSource()->pf_Read ( pddw_sec, pdw_nsec );
+}
 
-  d_elapsedTime = (UINT64)((UINT64)l_clockTime.tv_sec * 10000000 ) + ((UINT64)l_clockTime.tv_nsec / 100 );
+/**
+ * \brief This function converts an elapsed time into the given time base
+ **/
+static UINT64 ConvertTime(UINT64 ddw_sec, UINT32 dw_nsec, openSAFETY_TIMEBASE e_timeBase)
+{
+    const t_TIMEBASE_FACTORS * ps_factors;
 
+    /* unknown time bases are micro seconds, as ever */
+    if ( (UINT32)e_timeBase >= k_SHNFTIME_NUM_TIMEBASES )
+    {
+        e_timeBase = k_openSAFETY_TIMEBASE_1US;
+    }
+    ps_factors = &as_timeBaseFactors[e_timeBase];
 
-  if ( i_initialTimerValue == 0 )
-  {
-      i_initialTimerValue = (UINT64 *)malloc(sizeof(long));
-      *i_initialTimerValue = d_elapsedTime;
-      return 0;
-  }
-  if (d_elapsedTime < *i_initialTimerValue){
-	  DATA_LOGGER("Time is negative\n");
-  }
+    return ( ddw_sec * ps_factors->dw_unitsPerSec ) +
+           ( ( (UINT64)dw_nsec * ps_factors->ddw_mult ) >> ps_factors->b_shift );
+}
 
-  d_elapsedTime = ( d_elapsedTime - *i_initialTimerValue ) / u_timeFactor;
+/**
+ * \brief This function captures the time of the application cycle, in all time bases
+ **/
+void SHNFTime_StartCycle(void)
+{
+    UINT64 ddw_us;
+    UINT64 ddw_sec;
+    UINT32 dw_nsec;
+    UINT32 i;
 
+#if WIN32
+    /* paces the application loop of the windows demo */
+    if ( ! SHNFTime_IsSimulated() )
+    {
+        Sleep(100);
+    }
 #endif
 
-  switch(e_timeBase)
-  {
-    case k_openSAFETY_TIMEBASE_1US:
+    /* the nodes stepped together get the same time for the step */
+    if ( SHNFTime_IsSimulated() && ( pf_stepFunc != NULL ) )
     {
-      d_elapsedTime = d_elapsedTime;
-      break;
+        ddw_us = pf_stepFunc();
+        ddw_simulatedSec = ddw_us / 1000000ULL;
+        dw_simulatedNsec = (UINT32)( ddw_us % 1000000ULL ) * 1000UL;
     }
-    case k_openSAFETY_TIMEBASE_10US:
+    /* no else : the clock steps on its own */
+
+    /* the time of the last cycle is kept, if the clock cannot be read */
+    if ( ReadElapsedTime ( &ddw_sec, &dw_nsec ) )
     {
-      d_elapsedTime = d_elapsedTime / 10;
-      break;
+        for ( i = 0; i < k_SHNFTIME_NUM_TIMEBASES; i++ )
+        {
+            SHNFTime_addw_cycleCt[i] = ConvertTime ( ddw_sec, dw_nsec, (openSAFETY_TIMEBASE)i );
+        }
     }
-    case k_openSAFETY_TIMEBASE_100US:
+
+    /* the simulated clock steps once per cycle, for the next one */
+    if ( SHNFTime_IsSimulated() && ( pf_stepFunc == NULL ) )
     {
-      d_elapsedTime = d_elapsedTime / 100;
-      break;
+        AdvanceSimulatedClock ( k_openSAFETY_SIMULATED_CLOCK_STEP_US );
     }
-    case k_openSAFETY_TIMEBASE_1MS:
+}
+
+/**
+ * \brief This function selects the clock by its name
+ **/
+BOOLEAN SHNFTime_SelectClock(const char * pc_name)
+{
+    UINT32 i;
+
+    for ( i = 0; i < ( sizeof(as_clockSources) / sizeof(as_clockSources[0]) ); i++ )
     {
-      d_elapsedTime = d_elapsedTime / 1000;
-      break;
+        if ( strcmp ( as_clockSources[i].pc_name, pc_name ) == 0 )
+        {
+            ps_clockSource = &as_clockSources[i];
+            return TRUE;
+        }
     }
-    default: /* 100 nano sec */
+
+    DATA_LOGGER1 ( "Unknown SHNF clock \"%s\"\n", pc_name );
+    return FALSE;
+}
+
+/**
+ * \brief This function checks, if the simulated clock is selected
+ **/
+BOOLEAN SHNFTime_IsSimulated(void)
+{
+    return GetClockSource()->o_simulated;
+}
+
+/**
+ * \brief This function hands the simulated clock over to a step function
+ **/
+void SHNFTime_SetStepFunction(SHNFTime_t_STEP_FUNC pf_step)
+{
+    pf_stepFunc = pf_step;
+}
+
+/**
+ * \brief This function advances the simulated clock
+ **/
+static void AdvanceSimulatedClock(UINT32 dw_us)
+{
+    UINT64 ddw_nsec;
+
+    ddw_nsec = (UINT64)dw_simulatedNsec + ( (UINT64)( dw_us % 1000000UL ) * 1000 );
+    ddw_simulatedSec += ( dw_us / 1000000UL ) + ( ddw_nsec / k_NSEC_PER_SEC );
+    dw_simulatedNsec = (UINT32)( ddw_nsec % k_NSEC_PER_SEC );
+}
+
+/**
+ * \brief This function returns a timer value with the specified time base (resolution)
+ *
+ * \param e_timeBase the time base (\see openSAFETY_TIMEBASE)
+ *
+ * \return 64 bit timer value
+ **/
+UINT64 SHNFTime_getTime64(openSAFETY_TIMEBASE e_timeBase)
+{
+    UINT64 ddw_sec;
+    UINT32 dw_nsec;
+
+    if ( ! ReadElapsedTime ( &ddw_sec, &dw_nsec ) )
     {
-      d_elapsedTime = d_elapsedTime / 1;
-      break;
+        return 0;
     }
-  }
 
-  return (UINT32) d_elapsedTime ;
+    return ConvertTime ( ddw_sec, dw_nsec, e_timeBase );
+}
+
+/**
+ * \brief This function returns a timer value with the specified time base (resolution)
+ *
+ * \param e_timeBase the time base (\see openSAFETY_TIMEBASE)
+ *
+ * \return 32 bit timer value
+ **/
+UINT32 SHNFTime_getTime(openSAFETY_TIMEBASE e_timeBase)
+{
+    return (UINT32)SHNFTime_getTime64 ( e_timeBase );
 }
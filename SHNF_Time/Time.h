@@ -23,14 +23,104 @@
 
 #include "EPLStarget.h"
 
+/* Number of time bases, see openSAFETY_TIMEBASE */
+#define k_SHNFTIME_NUM_TIMEBASES 4
+
+/**
+ * \brief The consecutive time of the current application cycle, per time base. Only
+ * written by \see SHNFTime_StartCycle, read it with \see SHNFTime_getCycleTime
+ */
+extern UINT64 SHNFTime_addw_cycleCt[k_SHNFTIME_NUM_TIMEBASES];
+
+/**
+ * \brief The consecutive time of the current cycle, truncated to 32 bit. The time
+ * base has to be a valid openSAFETY_TIMEBASE
+ */
+#define SHNFTime_getCycleTime(e_timeBase)    ( (UINT32)SHNFTime_addw_cycleCt[(e_timeBase)] )
+
+/**
+ * \brief The consecutive time of the current cycle, without truncation, e.g. for
+ * the 40 bit CT of the SPDOs (SPDO_cfg_40_BIT_CT_SUPPORT)
+ */
+#define SHNFTime_getCycleTime64(e_timeBase)  ( SHNFTime_addw_cycleCt[(e_timeBase)] )
+
+/**
+ * \brief This function captures the time of the application cycle. It is called once at
+ * the start of every application loop, the stack units then read the same time with
+ * \see SHNFTime_getCycleTime during the whole loop.
+ *
+ * The time starts with zero at the first call of this function or of
+ * \see SHNFTime_getTime.
+ */
+void SHNFTime_StartCycle(void);
+
+/**
+ * \brief This function selects the clock the consecutive time is derived from, by
+ * its name. It has to be called before the first time is read.
+ * - "monotonic" - the monotonic system clock
+ * - "simulated" - a clock, which only advances by k_openSAFETY_SIMULATED_CLOCK_STEP_US
+ *                 per \see SHNFTime_StartCycle, or to the time of the step granted by
+ *                 a step function, see \see SHNFTime_SetStepFunction. The application
+ *                 loop does not wait for the idle tick then, so protocol time passes
+ *                 as fast as the CPU runs the stack
+ *
+ * Without a call, the clock named by the environment variable k_openSAFETY_CLOCK_ENV
+ * is used, or k_openSAFETY_CLOCK if it is not set.
+ *
+ * \param pc_name (IN) the name of the clock
+ *
+ * \return - TRUE  - the clock is selected
+ *         - FALSE - no clock of this name exists
+ */
+BOOLEAN SHNFTime_SelectClock(const char * pc_name);
+
+/**
+ * \brief This function checks, if the simulated clock is selected
+ *
+ * \return - TRUE  - the simulated clock is selected
+ *         - FALSE - the system clock is selected
+ */
+BOOLEAN SHNFTime_IsSimulated(void);
+
+/**
+ * \brief Function waiting for the next step of a simulated clock, which is shared by
+ * several nodes. It returns the simulated time of the step in micro seconds
+ */
+typedef UINT64 (*SHNFTime_t_STEP_FUNC)(void);
+
+/**
+ * \brief This function hands the simulated clock over to a step function, e.g. the
+ * step barrier of the shared memory transport. \see SHNFTime_StartCycle then calls
+ * the step function, which returns when the next step is granted to this node, and
+ * sets the clock to the time of the step. The nodes stepped by the same driver
+ * therefore run in lockstep, on the same protocol time.
+ *
+ * The step function has no effect on the system clock.
+ *
+ * \param pf_step (IN) the step function, NULL to step the clock once per cycle again
+ */
+void SHNFTime_SetStepFunction(SHNFTime_t_STEP_FUNC pf_step);
+
 /**
  * \brief This function returns a timer value with the specified time base (resolution)
  *
+ * The clock is read on every call, use \see SHNFTime_getCycleTime for the time of
+ * the application cycle.
+ *
  * \param e_timeBase (IN) the time base (\see openSAFETY_TIMEBASE)
  *
  * \return 32 bit timer value
  */
 UINT32 SHNFTime_getTime(openSAFETY_TIMEBASE e_timeBase);
 
-#endif
+/**
+ * \brief This function returns a timer value with the specified time base (resolution),
+ * see \see SHNFTime_getTime
+ *
+ * \param e_timeBase (IN) the time base (\see openSAFETY_TIMEBASE)
+ *
+ * \return 64 bit timer value
+ */
+UINT64 SHNFTime_getTime64(openSAFETY_TIMEBASE e_timeBase);
 
+#endif
@@ -15,6 +15,12 @@
  */
 #include "NetHelper.h"
 
+#if linux
+#include "CrossCompile_Linux.h"
+#else
+#include "CrossCompile_Win32.h"
+#endif
+
 #ifndef k_UDP_TARGET_NETWORK
   #error The compiler define 'k_UDP_TARGET_NETWORK' has to be set in the target main header file
 #endif
@@ -38,6 +44,13 @@ static struct in_addr * sia_localBroadcastAddress = (struct in_addr *)NULL;
  */
 static char * c_AdapterName = (char *)NULL;
 
+/**
+ * \brief The IP addresses of the SNs, indexed by their SADR, in network byte order.
+ * 0 marks an SADR with unknown address. Entries are written by the receiver thread
+ * and read by the stack thread, each one with a single 32 bit access.
+ */
+static volatile UINT32 adw_snAddresses[k_SADR_SPACE];
+
 /**
  * This function returns the address on the network as well as the name of the adapter used
  *
@@ -96,7 +109,15 @@ void TargetOnNetwork ( UINT16 i_targetAddress, struct in_addr * localIPAddress )
         return;
     }
 
-    /** Lookup for IP is not implemented yet */
+    /** SNs, whose address has been learned, are sent to directly */
+    if ( i_targetAddress < k_SADR_SPACE )
+    {
+        localIPAddress->s_addr = ATOMIC_LOAD_ACQUIRE( adw_snAddresses[i_targetAddress] );
+        if ( localIPAddress->s_addr != 0 )
+            return;
+    }
+
+    /** Unknown targets are reached by broadcast */
     BroadcastNetwork(localIPAddress);
 }
 
@@ -117,7 +138,24 @@ void BroadcastNetwork ( struct in_addr * localIPAddress )
 
 void StoreIPForSN ( struct in_addr snAddress, UINT16 senderAddress )
 {
+    UINT16 i;
+
+    if ( ( senderAddress == 0 ) || ( senderAddress >= k_SADR_SPACE ) || ( snAddress.s_addr == 0 ) )
+        return;
+
+    /** Nearly every frame confirms the known address */
+    if ( adw_snAddresses[senderAddress] == snAddress.s_addr )
+        return;
+
+    /** An SN, which got a new SADR assigned, is not reachable under its old one */
+    for ( i = 1; i < k_SADR_SPACE; i++ )
+    {
+        if ( adw_snAddresses[i] == snAddress.s_addr )
+            ATOMIC_STORE_RELEASE( adw_snAddresses[i], 0 );
+    }
 
+    DBG_PRINTF2 ( "SN %u is located at %s\n", senderAddress, inet_ntoa ( snAddress ) );
+    ATOMIC_STORE_RELEASE( adw_snAddresses[senderAddress], snAddress.s_addr );
 }
 
 /**
@@ -45,6 +45,9 @@
 #define NETWORK_FAILURE   ((int)-1)
 #endif
 
+/* Number of safety addresses, an SADR is stored in 10 bits */
+#define k_SADR_SPACE 1024
+
 #ifndef k_UDP_TARGET_NETWORK
   #error The compiler define 'k_UDP_TARGET_NETWORK' has to be set in the target main header file
 #endif
@@ -61,10 +64,12 @@ void AdapterOnNetwork ( UINT16 i_bufLength, char ** adapterDescription, struct i
 
 /**
  * This function returns the address on the network, we are going to send to for the
- * given target. If the given target is 0xFFFF, we are returning the local adapter address
+ * given target. If the given target is 0xFFFF, we are returning the local adapter address.
+ * The address of an SN is known, once a frame sent by it has been received, see
+ * \see StoreIPForSN. Broadcast is used for target 0 and for all SNs not known yet.
  *
- * \param i_targetAddress - the address for the intended target, or 0xFFFF for the local adapter
- *                          interface
+ * \param i_targetAddress - the address for the intended target, 0 for broadcast, or 0xFFFF
+ *                          for the local adapter interface
  * \retval localIPAddress - the in_addr structure for the address
  */
 void TargetOnNetwork ( UINT16 i_targetAddress, struct in_addr * localIPAddress );
@@ -73,6 +78,9 @@ void TargetOnNetwork ( UINT16 i_targetAddress, struct in_addr * localIPAddress )
  * This functions saves the assignment of the given snAddress to the safety sender address,
  * therefore allowing to send to specific targets. If the given ip address is already stored
  * for another target, the senderAddress get's reassigned
+ *
+ * \param snAddress - the IP address the frame was received from
+ * \param senderAddress - the SADR of the sender of the frame, 1 .. 1023
  */
 void StoreIPForSN ( struct in_addr snAddress, UINT16 senderAddress );
 
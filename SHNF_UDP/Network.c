@@ -14,10 +14,27 @@
  *
  */
 
+#if linux
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE /* recvmmsg and sendmmsg */
+#endif
+#include <sys/socket.h>
+#endif
+
 #include "Network.h"
 #include "NetHelper.h"
 #include "datalogger.h"
 
+#if linux
+/* Message headers of the batches, the receiving ones are only used by the receiver
+   thread, the sending ones only by the stack thread */
+static struct mmsghdr as_recvMsgs[k_UDP_BATCH_SIZE];
+static struct iovec as_recvIov[k_UDP_BATCH_SIZE];
+static struct mmsghdr as_sendMsgs[k_UDP_BATCH_SIZE];
+static struct iovec as_sendIov[k_UDP_BATCH_SIZE];
+static struct sockaddr_in as_sendTargets[k_UDP_BATCH_SIZE];
+#endif
+
 /**
  * \brief This function retrieves and/or opens the global socket. Additionally it
  *        determines which IP Address will be used for this instance.
@@ -153,62 +170,171 @@ UINT32 ReceiveFromNetwork ( UINT8 * c_ReceiveBuffer,
                             UINT32 i_ReceiveBufferLength,
                             struct sockaddr * connectionData )
 {
-    UINT8 * c_recvBuffer;
-    struct sockaddr_in servaddr;
-    socklen_t sl_addressLength;
-    UINT32 i_numBytesReceived = 0;
-    UINT32 fd_udpSocket;
+    t_NETWORK_DATAGRAM s_datagram;
+
+    s_datagram.pb_buffer = c_ReceiveBuffer;
+    s_datagram.w_bufferLength = (UINT16)i_ReceiveBufferLength;
 
-    /* Allocating the memory for the buffer */
-    c_recvBuffer = (UINT8*) malloc ( sizeof(UINT8) * ( i_ReceiveBufferLength + 1 ) );
-    /* Zero'ing the buffer to prevent ghost memory */
-    memset ( c_recvBuffer, 0, sizeof(UINT8) * ( i_ReceiveBufferLength + 1 ) );
+    if ( ReceiveBatchFromNetwork ( &s_datagram, 1 ) < 0 )
+        return NETWORK_FAILURE;
+
+    memcpy ( connectionData, &s_datagram.s_sender, sizeof(struct sockaddr) );
+    return s_datagram.w_length;
+}
+
+INT32 ReceiveBatchFromNetwork ( t_NETWORK_DATAGRAM as_datagrams[], UINT32 i_maxDatagrams )
+{
+    UINT32 fd_udpSocket;
+    UINT32 i;
+    INT32 i_numReceived;
 
     /* Open a socket for receiving data */
     if ( ( fd_udpSocket = GetSocketForReceiver() ) == NETWORK_FAILURE )
     {
         DATA_LOGGER1 ( "Error obtaining socket [%d] for message receiver thread!\n", errno);
-        return NETWORK_FAILURE;
+        return -1;
+    }
+
+#if linux
+    if ( i_maxDatagrams > k_UDP_BATCH_SIZE )
+        i_maxDatagrams = k_UDP_BATCH_SIZE;
+
+    /** The datagrams are received directly into the given buffers, nothing is cleared
+     *  or copied, only the received bytes of a buffer are valid */
+    for ( i = 0; i < i_maxDatagrams; i++ )
+    {
+        as_recvIov[i].iov_base = as_datagrams[i].pb_buffer;
+        as_recvIov[i].iov_len = as_datagrams[i].w_bufferLength;
+        as_recvMsgs[i].msg_hdr.msg_name = &as_datagrams[i].s_sender;
+        as_recvMsgs[i].msg_hdr.msg_namelen = sizeof(struct sockaddr_in);
+        as_recvMsgs[i].msg_hdr.msg_iov = &as_recvIov[i];
+        as_recvMsgs[i].msg_hdr.msg_iovlen = 1;
+        as_recvMsgs[i].msg_hdr.msg_control = NULL;
+        as_recvMsgs[i].msg_hdr.msg_controllen = 0;
+        as_recvMsgs[i].msg_hdr.msg_flags = 0;
     }
 
-    servaddr.sin_port = 0;
-    sl_addressLength = sizeof(struct sockaddr);
-    i_numBytesReceived = 0;
+    /** Blocks for the first datagram only, the ones already waiting are taken along */
+    do
+    {
+        i_numReceived = recvmmsg ( fd_udpSocket, as_recvMsgs, i_maxDatagrams, MSG_WAITFORONE, NULL );
+    }
+    while ( ( i_numReceived < 0 ) && ( errno == EINTR ) );
 
-    while ( i_numBytesReceived == 0 )
+    if ( i_numReceived < 0 )
+    {
+        DATA_LOGGER2 ( "Error receiving from socket [%d] - %s!\n", errno, strerror ( errno ) );
+        return -1;
+    }
+
+    for ( i = 0; i < (UINT32)i_numReceived; i++ )
+    {
+        /** Truncated datagrams can not be valid frames, they are reported as empty */
+        if ( as_recvMsgs[i].msg_hdr.msg_flags & MSG_TRUNC )
+            as_datagrams[i].w_length = 0;
+        else
+            as_datagrams[i].w_length = (UINT16)as_recvMsgs[i].msg_len;
+    }
+#else
     {
-        if ( ( i_numBytesReceived = recvfrom ( fd_udpSocket, SOCKET_RECV_TYPE c_recvBuffer, i_ReceiveBufferLength,
-                (UINT8) 0, (struct sockaddr *) &servaddr, &sl_addressLength ) ) == NETWORK_FAILURE )
+        socklen_t sl_addressLength = sizeof(struct sockaddr_in);
+        int i_numBytesReceived;
+
+        /** Without recvmmsg, a batch consists of a single datagram */
+        i = 0;
+        if ( ( i_numBytesReceived = recvfrom ( fd_udpSocket, SOCKET_RECV_TYPE as_datagrams[0].pb_buffer,
+                as_datagrams[0].w_bufferLength, 0, (struct sockaddr *) &as_datagrams[0].s_sender,
+                &sl_addressLength ) ) == SOCKET_ERROR )
         {
             DATA_LOGGER2 ( "Error receiving from socket [%d] - %s!\n", errno, strerror ( errno ) );
-            // i_numBytesReceived = NETWORK_FAILURE; - obsolete, as it is already set to this value
-            break;
+            return -1;
         }
+        as_datagrams[0].w_length = (UINT16)i_numBytesReceived;
+        i_numReceived = 1;
     }
+#endif
+
+    DATA_LOGGER_DEBUG1 ( "%d datagrams received\n", (int) i_numReceived );
+
+    return i_numReceived;
+}
+
+INT32 SendBatchOnNetwork ( const t_NETWORK_DATAGRAM as_datagrams[], UINT32 i_numDatagrams )
+{
+    UINT32 fd_udpSocket;
+    UINT32 i_numSent = 0;
+    UINT32 i;
+    INT32 i_result;
 
-    /* If the loop broke because of a failure, we have to return */
-    if ( i_numBytesReceived == NETWORK_FAILURE )
+    /* Open a socket for sending data */
+    if ( ( fd_udpSocket = GetSocketForSender() ) == NETWORK_FAILURE )
     {
-        free ( c_recvBuffer );
-        return NETWORK_FAILURE;
+        DATA_LOGGER1 ( "Error obtaining socket [%d] for sending!\n", errno);
+        return -1;
     }
 
 #if linux
-    DATA_LOGGER_DEBUG2("Package [%d bytes] received from %s\n",
-                (int) i_numBytesReceived,
-                inet_ntoa(servaddr.sin_addr));
+    while ( i_numSent < i_numDatagrams )
+    {
+        UINT32 i_batch = i_numDatagrams - i_numSent;
+
+        if ( i_batch > k_UDP_BATCH_SIZE )
+            i_batch = k_UDP_BATCH_SIZE;
+
+        for ( i = 0; i < i_batch; i++ )
+        {
+            const t_NETWORK_DATAGRAM * ps_datagram = &as_datagrams[i_numSent + i];
+
+            as_sendTargets[i].sin_family = AF_INET;
+            as_sendTargets[i].sin_port = htons ( k_UDP_SERVICE_PORT );
+            /** Determine the sending address */
+            TargetOnNetwork ( ps_datagram->w_targetAddress, &as_sendTargets[i].sin_addr );
+
+            as_sendIov[i].iov_base = ps_datagram->pb_buffer;
+            as_sendIov[i].iov_len = ps_datagram->w_length;
+            memset ( &as_sendMsgs[i].msg_hdr, 0, sizeof(struct msghdr) );
+            as_sendMsgs[i].msg_hdr.msg_name = &as_sendTargets[i];
+            as_sendMsgs[i].msg_hdr.msg_namelen = sizeof(struct sockaddr_in);
+            as_sendMsgs[i].msg_hdr.msg_iov = &as_sendIov[i];
+            as_sendMsgs[i].msg_hdr.msg_iovlen = 1;
+        }
+
+        do
+        {
+            i_result = sendmmsg ( fd_udpSocket, as_sendMsgs, i_batch, 0 );
+        }
+        while ( ( i_result < 0 ) && ( errno == EINTR ) );
+
+        /** An error is only reported, if it concerns the first datagram of the call,
+         *  the remaining datagrams are left to the caller */
+        if ( i_result <= 0 )
+        {
+            DATA_LOGGER2 ( "Error sending to socket [%d] - %s!\n", errno, strerror ( errno ) );
+            break;
+        }
+
+        i_numSent += (UINT32)i_result;
+        if ( (UINT32)i_result < i_batch )
+            break;
+    }
+#else
+    /** Without sendmmsg, every datagram is sent on its own */
+    for ( i = 0; i < i_numDatagrams; i++ )
+    {
+        i_result = (INT32)SendOnNetwork ( as_datagrams[i].w_targetAddress, as_datagrams[i].pb_buffer,
+                as_datagrams[i].w_length );
+        if ( i_result == (INT32)NETWORK_FAILURE )
+            break;
+        i_numSent++;
+    }
 #endif
 
-    /* Return the data as well as the connection information */
-    memcpy ( c_ReceiveBuffer, c_recvBuffer, i_numBytesReceived );
-    memcpy ( connectionData, &servaddr, sizeof(struct sockaddr) );
+    DATA_LOGGER_DEBUG2 ( "%u of %u datagrams sent\n", i_numSent, i_numDatagrams );
 
-    /** If memset is left out here, the call to free may destroy the received packet on Linux.
-     *  So we call memset first, and free afterwards.  */
-    memset ( c_recvBuffer, 0, i_numBytesReceived );
-    free ( c_recvBuffer );
+    if ( ( i_numSent == 0 ) && ( i_numDatagrams > 0 ) )
+        return -1;
 
-    return i_numBytesReceived;
+    return (INT32)i_numSent;
 }
 
 /**
@@ -51,6 +51,20 @@
 /* various network functions define a failure state by returning -1 */
 #define NETWORK_FAILURE ((UINT8)-1)
 
+/*
+ * One datagram of a batch. For receiving, pb_buffer and w_bufferLength describe
+ * the target buffer, w_length and s_sender are filled in. For sending, pb_buffer
+ * and w_length describe the frame, w_targetAddress the addressed SN.
+ */
+typedef struct
+{
+    UINT8 *             pb_buffer;          /* buffer of the datagram */
+    UINT16              w_bufferLength;     /* size of the buffer, only used for receiving */
+    UINT16              w_length;           /* number of bytes in the datagram */
+    UINT16              w_targetAddress;    /* target SN address, or 0 for broadcast */
+    struct sockaddr_in  s_sender;           /* sender of a received datagram */
+} t_NETWORK_DATAGRAM;
+
 /**
  * \brief This function receives a frame from the network
  * \param i_ReceiveBufferLength IN length of the buffer
@@ -79,6 +93,36 @@ UINT32 SendOnNetwork ( UINT16 i_targetAddress,
                        const UINT8 * c_sendBuffer,
                        UINT32 i_sendBufferLength );
 
+/**
+ * \brief This function receives up to the given number of datagrams from the network
+ * with a single system call (recvmmsg) on Linux.
+ *
+ * The call blocks until at least one datagram has arrived, and then returns all
+ * further datagrams already waiting, without blocking again. Every datagram is
+ * written directly into the buffer given for it.
+ *
+ * \param i_maxDatagrams IN the number of entries in as_datagrams, at most k_UDP_BATCH_SIZE
+ * \retval as_datagrams IN/OUT the buffers to receive into, the length and sender of
+ *         every received datagram is filled in
+ * \return
+ *   - success - the number of datagrams received
+ *   - failure - -1
+ */
+INT32 ReceiveBatchFromNetwork ( t_NETWORK_DATAGRAM as_datagrams[], UINT32 i_maxDatagrams );
+
+/**
+ * \brief This function sends the given datagrams on the network, with a single system
+ * call (sendmmsg) on Linux, if the socket accepts all of them at once.
+ *
+ * \param as_datagrams IN the datagrams to be sent
+ * \param i_numDatagrams IN the number of entries in as_datagrams
+ * \return
+ *   - success - the number of datagrams sent, less than i_numDatagrams if the
+ *               socket refused the remaining ones
+ *   - failure - -1, if no datagram could be sent
+ */
+INT32 SendBatchOnNetwork ( const t_NETWORK_DATAGRAM as_datagrams[], UINT32 i_numDatagrams );
+
 /**
  * \brief Closes the connection and cleans up the socket
  */
@@ -63,6 +63,13 @@
 #define SAPL_cfg_CT_BASIS k_openSAFETY_TIMEBASE_1MS /* this value has to be used for this
                                           windows demo */
 
+/** SAPL_cfg_RX_FRAMES_PER_CYCLE:
+    This symbol represents the maximum number of received frames processed
+    within one application loop.
+    allowed values: 1 .. k_openSAFETY_RX_RING_SIZE
+*/
+#define SAPL_cfg_RX_FRAMES_PER_CYCLE 16U
+
 /** SAPL_k_NO_CRCS:
     This symbol represents the number of the CRCs in the parameter checksum
     object (0x1018/0x06).
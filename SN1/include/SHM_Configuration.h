@@ -0,0 +1,29 @@
+/**
+ * \file SHM_SN/SHM_Configuration.h
+ */
+
+#ifndef SHM_CONFIGURATION_H_
+#define SHM_CONFIGURATION_H_
+
+/* All nodes attached to a segment have to use the same configuration, as it
+   defines the layout of the segment */
+
+/** Name of the POSIX shared memory segment. All nodes of one safety domain attach
+    to the same segment */
+#define k_SHM_SEGMENT_NAME       "/openSAFETY_shnf_sdn1"
+
+/** Access rights of the segment, if it is created by this node */
+#define k_SHM_SEGMENT_MODE       0660
+
+/** Maximum number of nodes attached to the segment, at most 32 */
+#define k_SHM_MAX_NODES          16
+
+/** Number of frame slots in the inbox of every node.
+    NOTE : Has to be a power of two, as the ring index is masked */
+#define k_SHM_RING_SIZE          64
+
+/** Timeout in micro seconds of the receiver waiting for frames. The senders wake the
+    receiver after every flush, so this only bounds the wait of a lost wake up */
+#define k_SHM_WAIT_TIMEOUT_US    100000
+
+#endif /* SHM_CONFIGURATION_H_ */
@@ -73,8 +73,8 @@
  **    global variables
  *******************************************************************************/
 //for printing the Application Output
-static UINT32 printDelay= 10000000UL;
-static UINT32 printCnt = 0L;
+static UINT32 printDelay= 10000UL; /* in consecutive time ticks */
+static UINT32 printCt = 0UL;
 static UINT8  applData0_old = 0;
 
 static char logfile[] = "logfile.log";
@@ -99,7 +99,7 @@ static SNMTS_t_SN_STATE_MAIN e_LastSnState;
 static BOOLEAN InitCt(void);
 static BOOLEAN InitEPLS(void);
 static void Build(void);
-static void Process(void);
+static UINT8 Process(void);
 
 static void PrintSnState(SNMTS_t_SN_STATE_MAIN e_snState);
 static void OutputHeader(void);
@@ -125,6 +125,7 @@ int main(void) /*lint !e970 (Note -- Use of modifier or type 'int' outside of a
     BOOLEAN o_break = TRUE; /* to avoid the warning C4127: conditional
                              expression is constant; while(1) */
     SNMTS_t_SN_STATE_MAIN e_actSnState; /* to get the actual SN state */
+    UINT8 b_numRxFrames; /* number of frames processed in the application loop */
 
     /* if the initialization of the target was successful */
     if (SAPL_InitTarget())
@@ -134,15 +135,17 @@ int main(void) /*lint !e970 (Note -- Use of modifier or type 'int' outside of a
 
         /* The consecutive time value must be the same on both safety controller
        for the initialization */
-        dw_Ct = SHNFTime_getTime(SAPL_cfg_CT_BASIS);
+        SHNFTime_StartCycle();
+        dw_Ct = SHNFTime_getCycleTime(SAPL_cfg_CT_BASIS);
 
 
-        /* initialize unit SHNF */
-        SHNF_Init(SAPL_k_SN3_SADR);
-
-        /* if the initialization of the EPLS stack was successful */
-        if (InitEPLS())
+        /* if unit SHNF has started its transport and the initialization
+           of the EPLS stack was successful */
+        if (SHNF_Init(SAPL_k_SN3_SADR) && InitEPLS())
         {
+            /* subscribe to the SPDOs of the configured producers */
+            SHNF_SubscribeRxSpdoSources();
+
         	PrintApplicationData();
         	//ab_0_act_ProcessData[0]= 1U;
         	//ab_0_act_ProcessData[1] = 1U;
@@ -158,7 +161,12 @@ int main(void) /*lint !e970 (Note -- Use of modifier or type 'int' outside of a
                 {
                     /* The consecutive time value must be the same on both safety
              controller and the same value during one application loop */
-                    dw_Ct = SHNFTime_getTime(SAPL_cfg_CT_BASIS);
+                    SHNFTime_StartCycle();
+                    dw_Ct = SHNFTime_getCycleTime(SAPL_cfg_CT_BASIS);
+#if (SPDO_cfg_40_BIT_CT_SUPPORT == EPLS_k_ENABLE)
+                    /* inflate the CT to the 40 bit CT of the SPDOs */
+                    SPDO_UpdateExtCtValue(dw_Ct);
+#endif /* (SPDO_cfg_40_BIT_CT_SUPPORT == EPLS_k_ENABLE) */
                     //DataLoggerFile(logfile, "CT:  %d\n", dw_Ct);
 
                     /* calculation of the CRC */
@@ -169,7 +177,10 @@ int main(void) /*lint !e970 (Note -- Use of modifier or type 'int' outside of a
 
                     Build();
 
-                    Process();
+                    b_numRxFrames = Process();
+
+                    /* all frames built and answered in this loop are sent together */
+                    SHNF_FlushTxMemBlocks();
 
                     UINT8 applData0 = getProcessData0();
                     if(applData0 != applData0_old){
@@ -177,7 +188,7 @@ int main(void) /*lint !e970 (Note -- Use of modifier or type 'int' outside of a
                     	PrintApplicationData();
                     }
 
-                    if(printCnt >= printDelay){
+                    if((dw_Ct - printCt) >= printDelay){
                     	UINT32 avg = getAVG();
                     	UINT32 cnt = getCNT();
                     	UINT32 maxDel = getMaxPropDelay();
@@ -189,9 +200,9 @@ int main(void) /*lint !e970 (Note -- Use of modifier or type 'int' outside of a
                     	printf("Min PropDelay: %zu \n ",minDel);
 						PrintSnState(e_actSnState);
 
-						printCnt = 0;
-					}else{
-						printCnt++;
+						SHNF_PrintEventStatistics();
+
+						printCt = dw_Ct;
 					}
 
                     /* if the actual SN state update succeeded */
@@ -202,10 +213,22 @@ int main(void) /*lint !e970 (Note -- Use of modifier or type 'int' outside of a
                         {
                             /* print the actual SN state */
                             PrintSnState(e_actSnState);
+                            /* the parameter download may have changed the SPDO producers */
+                            if (e_actSnState == SNMTS_k_ST_OPERATIONAL)
+                            {
+                                SHNF_SubscribeRxSpdoSources();
+                            }
                             /*store the last SN state */
                             e_LastSnState = e_actSnState;
                         }
                     }
+
+                    /* if no frame was pending, sleep until a frame is received
+                       or the next consecutive time tick is due */
+                    if (b_numRxFrames == 0U)
+                    {
+                        SHNF_WaitForEvent();
+                    }
                 }
                 /* no else : the error was already printed in the
                     SAPL_SERR_SignalErrorClbk() */
@@ -323,6 +346,19 @@ static void Build(void)
                                   call of the SSC_BuildTxFrames */
     UINT8 b_numFreeMngtFrms = 1U; /* number of free management frames can be sent
                                   per call of the SSC_BuildTxFrames */
+    UINT16 w_numFreeTxFrms; /* number of frames the SHNF can take */
+
+    /* while the network is congested, the SHNF can take less frames */
+    w_numFreeTxFrms = SHNF_GetNumFreeTxFrames(SHNF_k_SPDO);
+    if (w_numFreeTxFrms < b_numFreeSpdoFrms)
+    {
+        b_numFreeSpdoFrms = (UINT8)w_numFreeTxFrms;
+    }
+    w_numFreeTxFrms = SHNF_GetNumFreeTxFrames(SHNF_k_SNMT);
+    if (w_numFreeTxFrms < b_numFreeMngtFrms)
+    {
+        b_numFreeMngtFrms = (UINT8)w_numFreeTxFrms;
+    }
 
     /* Guard timeout is checked */
     SNMTS_TimerCheck(dw_Ct, &b_numFreeMngtFrms);
@@ -338,28 +374,38 @@ static void Build(void)
  **
  ** Function    : Process
  **
- ** Description : This function gets a EPLS frame from the SHNF and calls the
- **               corresponding process function.
+ ** Description : This function gets all pending EPLS frames from the SHNF,
+ **               up to SAPL_cfg_RX_FRAMES_PER_CYCLE, and calls the
+ **               corresponding process function for each frame.
  **
  ** Parameters  : -
  **
- ** Returnvalue : -
+ ** Returnvalue : number of processed EPLS frames
  **
  *******************************************************************************/
-static void Process(void)
+static UINT8 Process(void)
 {
+    SHNF_t_RX_FRAME as_rxFrames[SAPL_cfg_RX_FRAMES_PER_CYCLE]; /* references to
+                                                 the received EPLS frames */
+    UINT8   b_numFrames;   /* number of received EPLS frames */
+    UINT8   b_frameIdx;    /* index of the processed EPLS frame */
     UINT16  w_frameLength; /* length of received EPLS frame */
     UINT8  *pb_rxFrame;    /* reference to a received EPLS frame */
-    SHNF_t_TEL_TYPE e_telType;
+#if (SPDO_cfg_MAX_NO_RX_SPDO != 0)
+    UINT32  dw_rxTimeout;  /* earliest SCT deadline of the Rx SPDOs */
+#endif
 
-    /* get reference to received EPLS frame */
-    pb_rxFrame = SHNF_GetEplsFrame(&w_frameLength, &e_telType);
+    /* get references to all received EPLS frames, up to the budget of one
+       application loop. All of them are processed with the same consecutive time */
+    b_numFrames = SHNF_GetEplsFrames(as_rxFrames, SAPL_cfg_RX_FRAMES_PER_CYCLE);
 
-    /* if EPLS frame was received */
-    if(pb_rxFrame != NULL)
+    for (b_frameIdx = 0U; b_frameIdx < b_numFrames; b_frameIdx++)
     {
+        pb_rxFrame = as_rxFrames[b_frameIdx].pb_frame;
+        w_frameLength = as_rxFrames[b_frameIdx].w_frameLength;
+
         /* if the received frame is SPDO frame */
-        if (e_telType == SHNF_k_SPDO)
+        if (as_rxFrames[b_frameIdx].e_telType == SHNF_k_SPDO)
         {
             /* The received SPDO frame is processed */
             SPDO_ProcessRxSpdo(dw_Ct, pb_rxFrame, w_frameLength);
@@ -368,26 +414,40 @@ static void Process(void)
         else
         {
             /* while the frame processing is busy and no fail safe error happened */
-            while(SSC_ProcessSNMTSSDOFrame(dw_Ct, pb_rxFrame,
+            while (SSC_ProcessSNMTSSDOFrame(dw_Ct, pb_rxFrame,
                     w_frameLength) == SSC_k_BUSY)
             {
                 pb_rxFrame = (UINT8 *)NULL;
                 w_frameLength = 0U;
             }
         }
+    }
 
 #if (SPDO_cfg_MAX_NO_RX_SPDO != 0)
-        /* SCT timeout is checked */
-        SPDO_CheckRxTimeout(dw_Ct); // for thiscase, dont check timeout
+    /* SCT timeout is checked once for the whole batch, after all received
+       SPDOs were processed. Without a received frame, it is only checked if
+       the earliest deadline of the Rx SPDOs elapsed */
+    if ((b_numFrames > 0U) ||
+        (SPDO_GetNextRxTimeout(&dw_rxTimeout) &&
+         EPLS_TIMEOUT(dw_Ct, dw_rxTimeout)))
+    {
+        SPDO_CheckRxTimeout(dw_Ct);
+    }
+    /* no else : no deadline elapsed */
 #endif
 
-        /* release frame */
-        SHNF_ReleaseEplsFrame();
+    /* if EPLS frames were received */
+    if (b_numFrames > 0U)
+    {
+        /* release all frames of the batch */
+        SHNF_ReleaseEplsFrames(b_numFrames);
     }
     /* no else : no EPLS frame was received */
 
     /* call the Control Flow Monitoring */
     SCFM_TACK_PATH();
+
+    return b_numFrames;
 }
 void ProcessApplicationData(){
 	//DATA_LOGGER1("ProcessData[0] Tx Mapping on 0x6000/1 is %d\n\n", ab_0_act_ProcessData[0]);
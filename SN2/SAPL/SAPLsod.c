@@ -43,6 +43,10 @@
 
 #include "datalogger.h"
 
+#if (SPDO_cfg_PROCESS_IMAGE == EPLS_k_ENABLE)
+#include "ProcessImage.h"
+#endif
+
 /*******************************************************************************
 **    global variables
 *******************************************************************************/
@@ -399,13 +403,26 @@ const SOD_cfg_TO_RAM_ROM SOD_t_OBJECT *SAPL_ps_OD[EPLS_cfg_MAX_INSTANCES]=
   #endif
 };
 
+/* ProcessData[0] is mapped to RxSPDO 0, it is taken from the process image, if
+   the image is provided */
+static UINT8 getRxProcessData0(){
+#if (SPDO_cfg_PROCESS_IMAGE == EPLS_k_ENABLE)
+	UINT8 b_data;
+
+	if (SHNF_ReadProcessImage(0U, k_PI_RX, 0U, &b_data, 1U, NULL) != 0U){
+		return b_data;
+	}
+#endif
+	return ab_0_act_ProcessData[0];
+}
+
 void PrintApplicationData(){
-	DATA_LOGGER1("ProcessData[0] Rx Mapping on 0x6000/1 is %d\n\n", ab_0_act_ProcessData[0]);
+	DATA_LOGGER1("ProcessData[0] Rx Mapping on 0x6000/1 is %d\n\n", getRxProcessData0());
 	DATA_LOGGER1("ProcessData[1] Tx Mapping on 0x6000/2 is %d\n\n", ab_0_act_ProcessData[1]);
 }
 
 UINT8 getProcessData0(){
-	return ab_0_act_ProcessData[0];
+	return getRxProcessData0();
 }
 
 UINT8 getProcessData1(){
@@ -413,5 +430,17 @@ UINT8 getProcessData1(){
 }
 
 void increaseAppData(){
+#if (SPDO_cfg_PROCESS_IMAGE == EPLS_k_ENABLE)
+	UINT8 b_data;
+
+	/* ProcessData[1] is mapped to TxSPDO 0, the stack takes it into the SOD before
+	   the SPDO is built */
+	if (SHNF_ReadProcessImage(0U, k_PI_TX, 0U, &b_data, 1U, NULL) == 0U){
+		b_data = ab_0_act_ProcessData[1];
+	}
+	b_data++;
+	(void)SHNF_WriteProcessImage(0U, k_PI_TX, 0U, &b_data, 1U);
+#else
 	ab_0_act_ProcessData[1]++;
+#endif
 }
@@ -161,9 +161,8 @@
 /* Define to enable or disable the using of the Lookup table for the SPDO
    number assignment. If the loop-up table is enabled then the SPDO filtering
    works faster but it needs always 2 Byte * 1024 memory. If the loop-up table
-   is disabled then a linear search table is used to filter the SPDO frames and
-   the filtering works slower because of linear searching. This linear search
-   table needs 4 Bytes per SADR configured in the SPDO communication parameters.
+   is disabled then a table sorted by the SADR is used to filter the SPDO frames,
+   it is searched binary. This table needs 4 Bytes per SPDO of the instance.
 
    Allowed values: EPLS_k_ENABLE, EPLS_k_DISABLE */
 #define SPDO_cfg_SPDO_NUM_LOOK_UP_TABLE         EPLS_k_DISABLE
@@ -211,6 +210,16 @@
  * Allowed values: EPLS_k_ENABLE, EPLS_k_DISABLE */
 #define SPDO_cfg_CONNECTION_VALID_STATISTIC   EPLS_k_DISABLE
 
+/* The data of the SPDOs is published to the application in a double buffered
+ * process image, see SHNF_Common/ProcessImage.h
+ * Allowed values: EPLS_k_ENABLE, EPLS_k_DISABLE */
+#define SPDO_cfg_PROCESS_IMAGE                EPLS_k_ENABLE
+
+/* Writes to objects mapped into a Tx SPDO mark the Tx SPDO as changed, it is
+ * sent with the next SPDO_BuildTxSpdo() as after SPDO_TxDataChanged()
+ * Allowed values: EPLS_k_ENABLE, EPLS_k_DISABLE */
+#define SPDO_cfg_TX_DATA_CHANGE_TRACKING      EPLS_k_ENABLE
+
 /* Maximum number of the Rx SPDOs.
    If the value of this define is 0 then the code size is reduced and the data
    in the received SPDOs and Time Response SPDOs will not be processed. Only the
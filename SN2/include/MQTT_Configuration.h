@@ -15,12 +15,52 @@
 
 #define k_MQTT_BASE_TOPIC		  "openSafety/scm"
 #define k_MQTT_BASE_TOPIC_SW		  "openSafety/scmsw"
-#define k_MQTT_SUBSCRIBE_TOPIC		  "openSafety/scm"
+#define k_MQTT_SUBSCRIBE_TOPIC		  "openSafety/scm/#" /* matches the base topic and its sub topics */
+/* Sub topic for the messages carrying several length prefixed frames */
+#define k_MQTT_COALESCED_SUFFIX		  "/frames"
+
+/** Routing of the frames to one topic per telegram type and address,
+    k_MQTT_TOPIC_PREFIX/<sdn>/<spdo|treq|snmt|ssdo>/<adr>. SPDOs are published on the
+    SADR of the producer, time requests on their TADR, SNMT and SSDO frames on the
+    SADR they are addressed to. A node subscribes to its own SADR, to the producers
+    of its RxSPDOs and to the time requests addressed to its TxSPDOs.
+    allowed values: EPLS_k_ENABLE, EPLS_k_DISABLE (all frames on k_MQTT_BASE_TOPIC) */
+#define k_MQTT_TOPIC_ROUTING            EPLS_k_ENABLE
+#define k_MQTT_TOPIC_PREFIX             "openSAFETY"
+/** Safety domain number of the node, used as first level of the routed topics */
+#define k_MQTT_SDN                      1
 
 
 #define CLIENTID    "OpenSafetySN2"
 #define QOS         0
 #define TIMEOUT     10000L
+/** Number of publish buffers. A buffer is in flight from the publish until the
+    client confirms it was written (QoS 0) or acknowledged, which bounds the
+    messages queued inside the client. Frames not getting a buffer stay in the
+    send queue of the SHNF, see k_openSAFETY_TX_QUEUE_DEPTH */
+#define k_MQTT_PUBLISH_BUFFERS          16
+/** QoS per telegram class, the defaults can be changed at runtime with mqttSetQos.
+    Routed topics are subscribed with the QoS of their class, QOS is used for the
+    topics without routing */
+#define k_MQTT_QOS_SPDO                 0
+#define k_MQTT_QOS_SSDO                 1
+#define k_MQTT_QOS_SNMT                 1
+/** Reporting of the SSDO and SNMT requests the client failed to deliver, so they
+    are repeated without waiting for their response timeout. Only the SCM sends requests
+    allowed values: EPLS_k_ENABLE, EPLS_k_DISABLE */
+#define k_MQTT_LOST_FRAME_REPORTS       EPLS_k_DISABLE
+
+/** Coalescing of the frames sent within one application loop into one MQTT message
+    allowed values: EPLS_k_ENABLE, EPLS_k_DISABLE (every frame is published on its own) */
+#define k_MQTT_COALESCE_FRAMES          EPLS_k_DISABLE
+/** Trigger for publishing the coalesced frames
+    allowed values: k_MQTT_FLUSH_END_OF_CYCLE, k_MQTT_FLUSH_MAX_LATENCY */
+#define k_MQTT_COALESCE_FLUSH           k_MQTT_FLUSH_END_OF_CYCLE
+/** The coalesced frames are published before the message would exceed this size */
+#define k_MQTT_COALESCE_MAX_BYTES       1024
+/** With k_MQTT_FLUSH_MAX_LATENCY, the coalesced frames are published once the
+    oldest one has been waiting for this time, in micro seconds */
+#define k_MQTT_COALESCE_MAX_LATENCY_US  2000UL
 
 
 
@@ -39,7 +39,7 @@
  * The length field of a message is a 8-bit integer, therefore the maximum
  * length of a safety payload is 255 bytes.
  */
-#define k_openSAFETY_MAX_PAYLOAD_LENGTH ( ( 2 ^ 8 ) - 1)
+#define k_openSAFETY_MAX_PAYLOAD_LENGTH ( ( 1 << 8 ) - 1)
 
 /*
  * The maximum length of frame 1 and frame 2 combined is 2 * payload + min
@@ -63,8 +63,58 @@
 #define k_openSAFETY_BUFFER_SIZE k_MAX_RECEIVING_BUFFER
 
 /* Size of the EPLS frame queue.
-   NOTE : The maximum queue size need in TST_UNT_PreCon_WB() */
-#define k_openSAFETY_FRAME_QUEUE_SIZE SCM_cfg_MAX_NUM_OF_NODES*2
+   NOTE : SCM_cfg_MAX_NUM_OF_NODES is not applicable on a SN, the pool only has to
+          hold the frames built within one application loop */
+#define k_openSAFETY_FRAME_QUEUE_SIZE 32
+
+/* Depth of the send queue, holding the frames the transport did not accept (e.g.
+   the buffer of the MQTT client is full or it is reconnecting). A queued frame keeps
+   its slot of the frame pool, so the depth has to be below k_openSAFETY_FRAME_QUEUE_SIZE */
+#define k_openSAFETY_TX_QUEUE_DEPTH 16
+
+/* Policies of the send queue per telegram type, if a frame does not fit.
+   allowed values: k_openSAFETY_TX_POLICY_DROP_NEWEST, k_openSAFETY_TX_POLICY_DROP_OLDEST,
+                   k_openSAFETY_TX_POLICY_OVERWRITE (SPDO only, keeps the newest SPDO per TxSPDO)
+   NOTE : SNMT and SSDO frames are repeated by the stack on timeout, SPDOs are
+          superseded by the next one of the same TxSPDO */
+#define k_openSAFETY_TX_POLICY_SPDO k_openSAFETY_TX_POLICY_OVERWRITE
+#define k_openSAFETY_TX_POLICY_SNMT k_openSAFETY_TX_POLICY_DROP_NEWEST
+#define k_openSAFETY_TX_POLICY_SSDO k_openSAFETY_TX_POLICY_DROP_NEWEST
+
+/* Number of frame slots in the RX ring between the network thread and the stack.
+   NOTE : Has to be a power of two, as the ring index is masked */
+#define k_openSAFETY_RX_RING_SIZE 32
+
+/* Interval of the idle tick in micro seconds, which wakes up the application loop
+   if no frame has been received. The stack timers (SPDO refresh, SCT, guarding,
+   SSDO timeouts) are resolved in consecutive time ticks, so this interval has to
+   be at most one consecutive time tick */
+#define k_openSAFETY_EVENT_TICK_US 1000
+
+/* Transport of the SHNF, selected by name at start up: "mqtt", "udp", "selftest"
+   or "shm".
+   NOTE : The environment variable named by k_openSAFETY_TRANSPORT_ENV overrides it */
+#define k_openSAFETY_TRANSPORT      "mqtt"
+#define k_openSAFETY_TRANSPORT_ENV  "OPENSAFETY_SHNF_TRANSPORT"
+
+/* Clock of the consecutive time, selected by name at start up: "monotonic" or
+   "simulated" (see SHNFTime_SelectClock). The simulated clock advances by
+   k_openSAFETY_SIMULATED_CLOCK_STEP_US per application loop. With the "shm" transport
+   the nodes are stepped in lockstep by the step driver (tools/shmstep) instead.
+   NOTE : The environment variable named by k_openSAFETY_CLOCK_ENV overrides it */
+#define k_openSAFETY_CLOCK                    "monotonic"
+#define k_openSAFETY_CLOCK_ENV                "OPENSAFETY_SHNF_CLOCK"
+#define k_openSAFETY_SIMULATED_CLOCK_STEP_US  k_openSAFETY_EVENT_TICK_US
+
+/* Frame trace, started at start up if the environment variable named by
+   k_openSAFETY_TRACE_ENV holds the path of the ring file. The ring keeps the last
+   k_openSAFETY_TRACE_RING_SIZE frames and is written as pcap to <path>.pcap on
+   clean up. The variable named by k_openSAFETY_TRACE_FILTER_ENV selects the traced
+   telegram types ("spdo,ssdo,snmt"), all are traced without it.
+   NOTE : Has to be a power of two, as the ring index is masked */
+#define k_openSAFETY_TRACE_ENV         "OPENSAFETY_SHNF_TRACE"
+#define k_openSAFETY_TRACE_FILTER_ENV  "OPENSAFETY_SHNF_TRACE_FILTER"
+#define k_openSAFETY_TRACE_RING_SIZE   4096
 
 /* Maximum number of receive failures */
 #define k_openSAFETY_MAX_RX_FAILURE_COUNTER   15
@@ -95,6 +145,11 @@
 /* Determine if the given ID is a Slim SSDO frame ID */
 #define openSAFETY_IS_SLIM_SSDO_FRAME_ID(bID)  ( ( bID >> 5 ) == ( openSAFETY_SLIM_SSDO_FRAME_MASK >> 5 ) )
 
+/* Mask for a SPDO time request, without the connection valid bit */
+#define openSAFETY_SPDO_TREQ_FRAME_MASK   0xC8
+/* Determine if the given ID is a SPDO time request frame ID */
+#define openSAFETY_IS_SPDO_TREQ_FRAME_ID(bID)  ( ( bID & 0xF8 ) == openSAFETY_SPDO_TREQ_FRAME_MASK )
+
 
 
 /**
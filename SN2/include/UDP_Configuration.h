@@ -4,6 +4,10 @@
 
 #include "UDP.h"
 
+/** Maximum number of datagrams received or sent with a single system call. Has to
+    be at most k_openSAFETY_RX_RING_SIZE, as a batch is received into the RX ring */
+#define k_UDP_BATCH_SIZE         16
+
 /** The port the system will receive data on */
 #define k_UDP_SERVICE_PORT       9877 /* UDP port */
 
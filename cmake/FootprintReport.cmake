@@ -0,0 +1,124 @@
+################################################################################
+# Writes the memory footprint of a linked target into a text file.
+#
+# Called after the build with cmake -P, the parameters are passed with -D:
+#   NM      nm of the toolchain (CMAKE_NM)
+#   BINARY  the linked executable
+#   REPORT  the report file to be written
+#   CONFIG  description of the configuration, printed in the first line
+#   TOP     number of the largest objects listed, 40 if not set
+#
+# The sizes are taken from the symbol table, so the static data of every module
+# is listed with its symbol. The source file is only shown for builds with debug
+# information.
+################################################################################
+
+# the source of an object may be empty, the empty list element is kept
+CMAKE_POLICY(SET CMP0007 NEW)
+
+IF(NOT NM OR NOT BINARY OR NOT REPORT)
+    MESSAGE(FATAL_ERROR "FootprintReport: NM, BINARY and REPORT must be set")
+ENDIF()
+
+IF(NOT TOP)
+    SET(TOP 40)
+ENDIF()
+
+EXECUTE_PROCESS(COMMAND ${NM} --size-sort -S -t d -l ${BINARY}
+                OUTPUT_VARIABLE NM_OUTPUT
+                RESULT_VARIABLE NM_RESULT
+                ERROR_QUIET)
+
+IF(NOT NM_RESULT EQUAL 0)
+    MESSAGE(WARNING "FootprintReport: ${NM} failed on ${BINARY}, no report written")
+    RETURN()
+ENDIF()
+
+SET(SIZE_TEXT 0)
+SET(SIZE_RODATA 0)
+SET(SIZE_DATA 0)
+SET(SIZE_BSS 0)
+SET(OBJECTS)
+
+STRING(REPLACE ";" "," NM_OUTPUT "${NM_OUTPUT}")
+STRING(REPLACE "\n" ";" NM_LINES "${NM_OUTPUT}")
+
+FOREACH(LINE ${NM_LINES})
+    # <address> <size> <type> <symbol>[<tab><file>:<line>]
+    IF(LINE MATCHES "^[0-9]+ ([0-9]+) ([A-Za-z]) ([^\t]+)(\t(.*))?$")
+        SET(SIZE ${CMAKE_MATCH_1})
+        SET(TYPE ${CMAKE_MATCH_2})
+        SET(SYMBOL ${CMAKE_MATCH_3})
+        SET(SOURCE ${CMAKE_MATCH_5})
+        # nm pads the sizes with zeros
+        MATH(EXPR SIZE "${SIZE}")
+        STRING(REGEX REPLACE ":[0-9]+$" "" SOURCE "${SOURCE}")
+        GET_FILENAME_COMPONENT(SOURCE "${SOURCE}" NAME)
+
+        SET(SECTION)
+        IF(TYPE MATCHES "^[tTwW]$")
+            MATH(EXPR SIZE_TEXT "${SIZE_TEXT} + ${SIZE}")
+        ELSEIF(TYPE MATCHES "^[rR]$")
+            MATH(EXPR SIZE_RODATA "${SIZE_RODATA} + ${SIZE}")
+            SET(SECTION rodata)
+        ELSEIF(TYPE MATCHES "^[dDgG]$")
+            MATH(EXPR SIZE_DATA "${SIZE_DATA} + ${SIZE}")
+            SET(SECTION data)
+        ELSEIF(TYPE MATCHES "^[bBsScC]$")
+            MATH(EXPR SIZE_BSS "${SIZE_BSS} + ${SIZE}")
+            SET(SECTION bss)
+        ENDIF()
+
+        # the variables are listed, nm sorts them by their size
+        IF(SECTION STREQUAL "data" OR SECTION STREQUAL "bss")
+            LIST(APPEND OBJECTS "${SIZE}|${SECTION}|${SYMBOL}|${SOURCE}")
+        ENDIF()
+    ENDIF()
+ENDFOREACH()
+
+MATH(EXPR SIZE_RAM "${SIZE_DATA} + ${SIZE_BSS}")
+
+SET(TEXT "Memory footprint of ${CONFIG}\n\n")
+SET(TEXT "${TEXT}Static sizes in bytes, taken from the symbol table of ${BINARY}\n")
+SET(TEXT "${TEXT}  text   ${SIZE_TEXT}\n")
+SET(TEXT "${TEXT}  rodata ${SIZE_RODATA}\n")
+SET(TEXT "${TEXT}  data   ${SIZE_DATA}\n")
+SET(TEXT "${TEXT}  bss    ${SIZE_BSS}\n")
+SET(TEXT "${TEXT}  RAM    ${SIZE_RAM} (data + bss)\n\n")
+SET(TEXT "${TEXT}Largest variables\n")
+
+IF(OBJECTS)
+    LIST(REVERSE OBJECTS)
+    LIST(LENGTH OBJECTS NUM_OBJECTS)
+    IF(NUM_OBJECTS LESS TOP)
+        SET(TOP ${NUM_OBJECTS})
+    ENDIF()
+    MATH(EXPR LAST "${TOP} - 1")
+
+    FOREACH(INDEX RANGE ${LAST})
+        LIST(GET OBJECTS ${INDEX} OBJECT)
+        STRING(REPLACE "|" ";" OBJECT "${OBJECT}")
+        LIST(GET OBJECT 0 SIZE)
+        LIST(GET OBJECT 1 SECTION)
+        LIST(GET OBJECT 2 SYMBOL)
+        LIST(GET OBJECT 3 SOURCE)
+
+        # the sizes are aligned to the right of a column of 10 characters
+        STRING(LENGTH "${SIZE}" LEN)
+        SET(PAD "          ")
+        MATH(EXPR LEN "10 - ${LEN}")
+        IF(LEN LESS 0)
+            SET(LEN 0)
+        ENDIF()
+        STRING(SUBSTRING "${PAD}" 0 ${LEN} PAD)
+
+        IF(SOURCE)
+            SET(TEXT "${TEXT}${PAD}${SIZE}  ${SECTION}\t${SYMBOL} (${SOURCE})\n")
+        ELSE()
+            SET(TEXT "${TEXT}${PAD}${SIZE}  ${SECTION}\t${SYMBOL}\n")
+        ENDIF()
+    ENDFOREACH()
+ENDIF()
+
+FILE(WRITE ${REPORT} "${TEXT}")
+MESSAGE(STATUS "Memory footprint of ${CONFIG}: ${SIZE_RAM} bytes of static RAM, see ${REPORT}")
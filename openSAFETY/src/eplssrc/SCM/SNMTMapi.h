@@ -36,6 +36,18 @@
 */
 void SNMTM_BuildRequest(UINT32 dw_ct, UINT8 *pb_numFreeFrms);
 
+/**
+* @brief This function signals that a request to the given SN was lost on the network.
+*
+* It is called by the application, if the SHNF reports a request as not delivered. The
+* request is repeated with the next call of SNMTM_BuildRequest(), without waiting for the
+* SNMT timeout. The repetition is counted, as after a timeout.
+*
+* @param        w_sadr        address of the SN the lost request was sent to (not checked,
+*   any value allowed), valid range: (UINT16)
+*/
+void SNMTM_RequestLost(UINT16 w_sadr);
+
 #endif /* #ifndef SNMTMAPI_H */
 
 /** @} */
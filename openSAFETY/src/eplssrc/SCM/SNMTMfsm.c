@@ -470,6 +470,51 @@ BOOLEAN SNMTM_CheckFsmAvailable(void)
   return o_return;
 }
 
+/**
+* @brief This function signals that a request to the given SN was lost on the network.
+*
+* The response timer of the FSM waiting for a response of this SN is set to timeout, so
+* the request is repeated with the next call of SNMTM_BuildRequest() instead of after the
+* SNMT timeout. The repetition is counted like one after a timeout, if no repetition is
+* left, the missing response is reported.
+*
+* @param        w_sadr        address of the SN the lost request was sent to (not checked,
+*   any value allowed), valid range: (UINT16)
+*/
+void SNMTM_RequestLost(UINT16 w_sadr)
+{
+  UINT16 w_fsmNum; /* loop counter */
+  UINT32 *pdw_respTimeout = (UINT32 *)NULL;  /* ref to response timout, only
+                                                valid after SOD read access */
+  SOD_t_ERROR_RESULT s_errRes; /* SOD access error */
+
+  for(w_fsmNum = 0U; w_fsmNum < SNMTM_cfg_MAX_NUM_FSM; w_fsmNum++)
+  {
+    /* if the FSM waits for a response of this SN */
+    if((!as_Fsm[w_fsmNum].o_wfRequest) &&
+       (as_Fsm[w_fsmNum].s_reqHdr.w_adr == w_sadr))
+    {
+      pdw_respTimeout = (UINT32 *)SOD_ReadVirt(EPLS_k_SCM_INST_NUM_
+                                               &s_AccessTimeout, &s_errRes);
+
+      /* if read access to SOD failed */
+      if(pdw_respTimeout == NULL)
+      {
+        SERR_SetError(EPLS_k_SCM_INST_NUM_ s_errRes.w_errorCode,
+                      (UINT32)(s_errRes.e_abortCode));
+      }
+      else /* read access to SOD succeeded */
+      {
+        /* response timeout is set back to the time of transmission */
+        as_Fsm[w_fsmNum].dw_respTimeout -= *pdw_respTimeout;
+      }
+    }
+    /* no else : FSM not affected */
+  }
+
+  SCFM_TACK_PATH();
+}
+
 /**
 * @brief This function assigns a single received response to the matching request that
 * is processed in a single FSM waiting for response.
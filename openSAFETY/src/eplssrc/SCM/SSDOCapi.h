@@ -204,6 +204,18 @@ BOOLEAN SSDOC_SendReadReq(UINT16 w_sadr, UINT16 w_reqNum,
 */
 BOOLEAN SSDOC_CheckFsmAvailable(void);
 
+/**
+* @brief This function signals that a request to the given SN was lost on the network.
+*
+* It is called by the application, if the SHNF reports a request as not delivered. The
+* request is repeated with the next call of SSDOC_BuildRequest(), without waiting for the
+* SSDO timeout. The repetition is counted as a retry, as after a timeout.
+*
+* @param        w_sadr        address of the SN the lost request was sent to (not checked,
+*   any value allowed), valid range: (UINT16)
+*/
+void SSDOC_RequestLost(UINT16 w_sadr);
+
 
 /**
 * @brief This function handles service request repetitions in case of a precedent
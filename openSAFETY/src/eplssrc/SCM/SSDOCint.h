@@ -485,6 +485,15 @@ void SSDOC_TimerReStart(UINT16 w_fsmNum, UINT32 dw_ct);
 */
 void SSDOC_TimerToTimeout(UINT16 const w_fsmNum);
 
+/**
+* @brief This function sets the given response timer to timeout, like an elapsed response
+* time. The retransmission is counted as retry.
+*
+* @param        w_fsmNum        FSM number (not checked, checked in
+*     SSDOC_RequestLost()), valid range: 0 .. SSDOC_cfg_MAX_NUM_FSM - 1
+*/
+void SSDOC_TimerExpire(UINT16 const w_fsmNum);
+
 /**
 * @brief This function checks the given response timer.
 *
@@ -219,6 +219,20 @@ void SSDOC_TimerToTimeout(UINT16 const w_fsmNum)
   SCFM_TACK_PATH();
 }
 
+/**
+* @brief This function sets the given response timer to timeout, like an elapsed response
+* time. The retransmission is counted as retry.
+*
+* @param        w_fsmNum        FSM number (not checked, checked in
+* 	SSDOC_RequestLost()), valid range: 0 .. SSDOC_cfg_MAX_NUM_FSM - 1
+*/
+void SSDOC_TimerExpire(UINT16 const w_fsmNum)
+{
+  /* set response timeout for the retransmission */
+  as_ServTimer[w_fsmNum].dw_respTimeout -= as_ServTimer[w_fsmNum].dw_sodRespTimeout;
+  SCFM_TACK_PATH();
+}
+
 /**
 * @brief This function checks the given response timer.
 *
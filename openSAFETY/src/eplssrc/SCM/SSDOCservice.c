@@ -463,6 +463,35 @@ BOOLEAN SSDOC_ServiceFsmProcess(UINT32 dw_ct, UINT16 w_fsmNum,
   return o_return;
 }
 
+/**
+* @brief This function signals that a request to the given SN was lost on the network.
+*
+* The response timer of the FSM waiting for a response of this SN is set to timeout, so
+* the request is repeated with the next call of SSDOC_BuildRequest() instead of after the
+* SSDO timeout. The repetition is counted as a retry, if no retry is left, the SSDO timeout
+* is reported.
+*
+* @param        w_sadr        address of the SN the lost request was sent to (not checked,
+*   any value allowed), valid range: (UINT16)
+*/
+void SSDOC_RequestLost(UINT16 w_sadr)
+{
+  UINT16 w_fsmNum; /* loop counter */
+
+  for(w_fsmNum = 0U; w_fsmNum < (UINT16)SSDOC_cfg_MAX_NUM_FSM; w_fsmNum++)
+  {
+    /* if the FSM waits for a response of this SN */
+    if((!as_ServFsm[w_fsmNum].o_waitForReq) &&
+       (as_ServFsm[w_fsmNum].s_reqBuf.s_hdr.w_adr == w_sadr))
+    {
+      SSDOC_TimerExpire(w_fsmNum);
+    }
+    /* no else : FSM not affected */
+  }
+
+  SCFM_TACK_PATH();
+}
+
 /**
 * @brief This function checks whether a SSDO transfer is already running with the given SN.
 *
@@ -268,6 +268,22 @@
   #error SPDO_cfg_IMMEDIATE_DATA_ONLY_AFTER_TSYNC is invalid
 #endif
 
+#ifndef SPDO_cfg_PROCESS_IMAGE
+  #define SPDO_cfg_PROCESS_IMAGE EPLS_k_DISABLE
+#endif
+#if ((SPDO_cfg_PROCESS_IMAGE != EPLS_k_ENABLE) && \
+     (SPDO_cfg_PROCESS_IMAGE != EPLS_k_DISABLE))
+  #error SPDO_cfg_PROCESS_IMAGE is invalid
+#endif
+
+#ifndef SPDO_cfg_TX_DATA_CHANGE_TRACKING
+  #define SPDO_cfg_TX_DATA_CHANGE_TRACKING EPLS_k_DISABLE
+#endif
+#if ((SPDO_cfg_TX_DATA_CHANGE_TRACKING != EPLS_k_ENABLE) && \
+     (SPDO_cfg_TX_DATA_CHANGE_TRACKING != EPLS_k_DISABLE))
+  #error SPDO_cfg_TX_DATA_CHANGE_TRACKING is invalid
+#endif
+
 #ifndef SPDO_cfg_FRAME_CPY_INTERN
   #error SPDO_cfg_FRAME_CPY_INTERN is not defined
 #endif
@@ -106,12 +106,15 @@ const UINT8 * SFS_FrmDeSerialize(BYTE_B_INSTNUM_ UINT8 *pb_frame,
   UINT8 *pb_sub2;
   UINT16  w_subFrm1Len;
   UINT16  w_subFrm2Len;
+  UINT8   b_calcCrc1 = 0;
+  UINT8   b_calcCrc2 = 0;
   UINT16  w_calcCrc1 = 0;
   UINT16  w_calcCrc2 = 0;
   UINT16  w_crc1 = 0;
   UINT16  w_crc2 = 0;
   UINT16  w_calcFrameLength;
   BOOLEAN o_doublePayload = TRUE;
+  BOOLEAN o_dataIdent = TRUE;
 
 #if (SPDO_cfg_40_BIT_CT_SUPPORT == EPLS_k_ENABLE)
   UINT16 w_expSdn;
@@ -324,10 +327,21 @@ const UINT8 * SFS_FrmDeSerialize(BYTE_B_INSTNUM_ UINT8 *pb_frame,
         SFS_NET_CPY8(&b_crc2, ADD_OFFSET(&pb_sub2[0], w_subFrm2Len));
         w_crc2 = b_crc2;
 
-        /* calculate the CRC */
-        w_calcCrc1 = SHNF_Crc8Calc(0U, (INT32)w_subFrm1Len, (void *)&pb_sub1[0]);
-        w_calcCrc2 = SHNF_Crc8Calc(0U, (INT32)w_subFrm2Len, (void *)&pb_sub2[0]);
-
+        if (o_doublePayload)
+        {
+          /* calculate both CRCs and compare the payload data in one pass */
+          o_dataIdent = SHNF_Crc8CalcDual((INT32)k_SFRM1_HDR_LEN, (void *)&pb_sub1[0],
+                                          (INT32)k_SFRM2_HDR_LEN, (void *)&pb_sub2[0],
+                                          (INT32)ps_hdrInfo->b_le, &b_calcCrc1, &b_calcCrc2);
+          w_calcCrc1 = b_calcCrc1;
+          w_calcCrc2 = b_calcCrc2;
+        }
+        else
+        {
+          /* calculate the CRC */
+          w_calcCrc1 = SHNF_Crc8Calc(0U, (INT32)w_subFrm1Len, (void *)&pb_sub1[0]);
+          w_calcCrc2 = SHNF_Crc8Calc(0U, (INT32)w_subFrm2Len, (void *)&pb_sub2[0]);
+        }
       }
       else
       {
@@ -345,9 +359,10 @@ const UINT8 * SFS_FrmDeSerialize(BYTE_B_INSTNUM_ UINT8 *pb_frame,
         }
         else
         {
-			/* calculate the CRC */
-			w_calcCrc1 = SHNF_Crc16Calc(0U, (INT32)w_subFrm1Len, (void *)&pb_sub1[0]);
-			w_calcCrc2 = SHNF_Crc16Calc(0U, (INT32)w_subFrm2Len, (void *)&pb_sub2[0]);
+          /* calculate both CRCs and compare the payload data in one pass */
+          o_dataIdent = SHNF_Crc16CalcDual((INT32)k_SFRM1_HDR_LEN, (void *)&pb_sub1[0],
+                                           (INT32)k_SFRM2_HDR_LEN, (void *)&pb_sub2[0],
+                                           (INT32)ps_hdrInfo->b_le, &w_calcCrc1, &w_calcCrc2);
         }
       }
 
@@ -385,8 +400,7 @@ const UINT8 * SFS_FrmDeSerialize(BYTE_B_INSTNUM_ UINT8 *pb_frame,
                         (UINT32)(w_crc2));
         }
       }
-      else if ((o_doublePayload) &&
-           (MEMCMP_IDENT != MEMCOMP(pb_sub1 + k_SFRM1_DATA, pb_sub2 + k_SFRM2_DATA, ps_hdrInfo->b_le)))
+      else if (!o_dataIdent)
       {
         /* count all errornous telegrams */
         SERR_CountCommonEvt(B_INSTNUM_ SERR_k_SFS_DATA);
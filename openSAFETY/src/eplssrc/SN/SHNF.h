@@ -206,6 +206,119 @@ extern UINT16 SHNF_Crc16Calc(UINT16 w_initCrc, INT32 l_subFrameLength,
 extern UINT16 SHNF_Crc16CalcSlim(UINT16 w_initCrc, INT32 l_subFrameLength,
         const void *pv_subFrame);
 
+/**
+ * @brief This function returns the CRC checksums over both sub frames of a frame with payload data of maximum 8 bytes,
+ * which carries its payload data in both sub frames, and compares the payload data of the sub frames. The CRCs and the
+ * comparison are done in one pass over the sub frames. The results are 8 bit CRCs, as of SHNF_Crc8Calc().
+ *
+ * @param        l_hdrLength1            header length of sub frame ONE in bytes
+ *
+ * @param        pv_subFrame1            reference to sub frame ONE
+ *
+ * @param        l_hdrLength2            header length of sub frame TWO in bytes
+ *
+ * @param        pv_subFrame2            reference to sub frame TWO
+ *
+ * @param        l_dataLength            payload data length of each sub frame in bytes
+ *
+ * @param        pb_crc1                 8 bit CRC check sum over sub frame ONE (pointer not checked, only called with reference to variable)
+ *
+ * @param        pb_crc2                 8 bit CRC check sum over sub frame TWO (pointer not checked, only called with reference to variable)
+ *
+ * @return
+ *  - TRUE             - payload data of both sub frames is identical
+ *  - FALSE            - payload data differs
+ */
+#define SHNF_Crc8CalcDual(a,b,c,d,e,f,g)	HNFiff_Crc8CalcDualSwp(a,b,c,d,e,f,g)
+extern BOOLEAN SHNF_Crc8CalcDual(INT32 l_hdrLength1, const void *pv_subFrame1,
+        INT32 l_hdrLength2, const void *pv_subFrame2, INT32 l_dataLength,
+        UINT8 *pb_crc1, UINT8 *pb_crc2);
+
+/**
+ * @brief This function returns the CRC checksums over both sub frames of a frame with payload data of minimum 9 bytes
+ * and maximum 254 bytes, which carries its payload data in both sub frames, and compares the payload data of the sub
+ * frames. The CRCs and the comparison are done in one pass over the sub frames. The results are 16 bit CRCs, as of
+ * SHNF_Crc16Calc().
+ *
+ * @param        l_hdrLength1            header length of sub frame ONE in bytes
+ *
+ * @param        pv_subFrame1            reference to sub frame ONE
+ *
+ * @param        l_hdrLength2            header length of sub frame TWO in bytes
+ *
+ * @param        pv_subFrame2            reference to sub frame TWO
+ *
+ * @param        l_dataLength            payload data length of each sub frame in bytes
+ *
+ * @param        pw_crc1                 16 bit CRC check sum over sub frame ONE (pointer not checked, only called with reference to variable)
+ *
+ * @param        pw_crc2                 16 bit CRC check sum over sub frame TWO (pointer not checked, only called with reference to variable)
+ *
+ * @return
+ *  - TRUE             - payload data of both sub frames is identical
+ *  - FALSE            - payload data differs
+ */
+#define SHNF_Crc16CalcDual(a,b,c,d,e,f,g)	HNFiff_Crc16_755B_CalcDualSwp(a,b,c,d,e,f,g)
+extern BOOLEAN SHNF_Crc16CalcDual(INT32 l_hdrLength1, const void *pv_subFrame1,
+        INT32 l_hdrLength2, const void *pv_subFrame2, INT32 l_dataLength,
+        UINT16 *pw_crc1, UINT16 *pw_crc2);
+
+#if (SPDO_cfg_PROCESS_IMAGE == EPLS_k_ENABLE)
+/**
+ * @brief This function publishes the payload data of a Rx SPDO to the application. It is called after the data of a
+ * received SPDO was copied into the SOD and after the mapped objects were set to their default values.
+ *
+ * The payload data is passed in the layout of the SPDO, as defined by the mapping of the Rx SPDO.
+ *
+ * @param        b_instNum               instance number
+ *
+ * @param        w_rxSpdoIdx             Rx SPDO index, valid range: 0..(SPDO_cfg_MAX_NO_RX_SPDO-1)
+ *
+ * @param        pv_data                 reference to the payload data (pointer not checked, only called with reference to array)
+ *
+ * @param        b_len                   length of the payload data in bytes, 0 if no object is mapped
+ */
+extern void SHNF_PublishRxImage(BYTE_B_INSTNUM_ UINT16 w_rxSpdoIdx,
+        const void *pv_data, UINT8 b_len);
+
+/**
+ * @brief This function fetches the payload data of a Tx SPDO, which was published by the application since the last
+ * call. It is called before a Tx SPDO is built, the data fetched is copied into the mapped objects of the SOD.
+ *
+ * The payload data is returned in the layout of the SPDO, as defined by the mapping of the Tx SPDO.
+ *
+ * @param        b_instNum               instance number
+ *
+ * @param        w_txSpdoIdx             Tx SPDO index, valid range: 0..(SPDO_cfg_MAX_NO_TX_SPDO-1)
+ *
+ * @retval       pv_data                 reference to the payload data (pointer not checked, only called with reference to array)
+ *
+ * @param        b_len                   length of the payload data in bytes, as defined by the mapping
+ *
+ * @return
+ *  - TRUE             - new payload data of b_len bytes is copied into pv_data
+ *  - FALSE            - no new payload data was published or its length differs from b_len
+ */
+extern BOOLEAN SHNF_FetchTxImage(BYTE_B_INSTNUM_ UINT16 w_txSpdoIdx,
+        void *pv_data, UINT8 b_len);
+
+#if (SPDO_cfg_TX_DATA_CHANGE_TRACKING == EPLS_k_ENABLE)
+/**
+ * @brief This function returns the Tx SPDOs, whose image was changed by the application since the last call. It is
+ * called before the Tx SPDOs are built, the Tx SPDOs returned are sent as after SPDO_TxDataChanged().
+ *
+ * @param        b_instNum               instance number
+ *
+ * @retval       padw_changed            bit set of the Tx SPDOs, the Tx SPDO index i is bit (i % 32) of word (i / 32)
+ *                                       (pointer not checked, only called with reference to array)
+ *
+ * @param        w_noWords               number of words of padw_changed
+ */
+extern void SHNF_TakeChangedTxImages(BYTE_B_INSTNUM_ UINT32 *padw_changed,
+        UINT16 w_noWords);
+#endif
+#endif
+
 #endif
 
 /** @} */
@@ -23,6 +23,7 @@
 #include "EPLStarget.h"
 #include "EPLScfg.h"
 #include "EPLStypes.h"
+#include "EPLScfgCheck.h"
 
 #include "SERRapi.h"
 #include "SERR.h"
@@ -34,6 +35,8 @@
 #include "SOD.h"
 #include "SODint.h"
 
+#include "SPDO.h"
+
 
 /**
  * This define represents the zero valid string.
@@ -99,6 +102,12 @@ static BOOLEAN CallBeforeReadClbk(BYTE_B_INSTNUM_ const SOD_t_OBJECT *ps_object,
 static BOOLEAN CallBeforeWriteClbk(BYTE_B_INSTNUM_ const void *pv_data,
                                    const SOD_t_OBJECT *ps_object,
                                    UINT32 dw_offset, UINT32 dw_size);
+static void *ObjData(const SOD_t_OBJECT *ps_object);
+#if (SPDO_cfg_TX_DATA_CHANGE_TRACKING == EPLS_k_ENABLE)
+  static void TxDataChanged(BYTE_B_INSTNUM_ const void *pv_data,
+                            const SOD_t_OBJECT *ps_object,
+                            UINT32 dw_offset, UINT32 dw_size);
+#endif
 
 /**
  * @brief This function initializes all module global and global variables defined in the unit SOD and checks the SOD.
@@ -466,6 +475,12 @@ BOOLEAN SOD_Write(BYTE_B_INSTNUM_ PTR_TYPE dw_hdl, BOOLEAN o_appObj,
                                               exceeds the defined limit of 10 */
                         {
                         /* RSM_IGNORE_QUALITY_END */
+                        #if (SPDO_cfg_TX_DATA_CHANGE_TRACKING == EPLS_k_ENABLE)
+                          /* the Tx SPDOs mapping the object are signaled,
+                             if the data is changed */
+                          TxDataChanged(B_INSTNUM_ pv_data, ps_object, dw_offset,
+                                        dw_size);
+                        #endif
                           /* data is copied */
                           SOD_DataCpy(pv_data, ps_object, dw_offset, dw_size);
 
@@ -2011,7 +2026,36 @@ BOOLEAN SOD_CallAfterWriteClbk(BYTE_B_INSTNUM_
 void SOD_DataCpy(const void *pv_data, const SOD_t_OBJECT *ps_object,
                     UINT32 dw_offset, UINT32 dw_size)
 {
-  void *pv_dst; /* temporary destination pointer to increase the readablity */
+  void *pv_dst = ObjData(ps_object); /* temporary destination pointer to
+                                        increase the readablity */
+
+  /* if the whole object is copied */
+  if ((dw_size == 0U) && (dw_offset == 0U))
+  {
+    /* the whole data is copied into the object dictionary */
+    MEMCOPY(pv_dst, pv_data, ps_object->s_attr.dw_objLen);
+  }
+  /* else a segment of the object is copied */
+  else
+  {
+    /* the data segment is copied into the object dictionary */
+    MEMCOPY((void *)(ADD_OFFSET(pv_dst, dw_offset)), pv_data, dw_size);
+  }
+
+  /* call the Control Flow Monitoring */
+  SCFM_TACK_PATH();
+}
+
+/**
+* @brief This function returns the pointer to the data of an object.
+*
+* @param        ps_object         pointer to the SOD entry (pointer not checked, only called with reference to struct in SOD_DataCpy() or TxDataChanged()) valid range : <> NULL
+*
+* @return       pointer to the data of the object
+*/
+static void *ObjData(const SOD_t_OBJECT *ps_object)
+{
+  void *pv_dst; /* pointer to the data */
   void *pv_objData; /* pointer to the object data */
 
   pv_objData = ps_object->pv_objData;
@@ -2040,20 +2084,60 @@ void SOD_DataCpy(const void *pv_data, const SOD_t_OBJECT *ps_object,
     pv_dst = pv_objData;
   }
 
-  /* if the whole object is copied */
-  if ((dw_size == 0U) && (dw_offset == 0U))
-  {
-    /* the whole data is copied into the object dictionary */
-    MEMCOPY(pv_dst, pv_data, ps_object->s_attr.dw_objLen);
-  }
-  /* else a segment of the object is copied */
-  else
+  return pv_dst;
+}
+
+#if (SPDO_cfg_TX_DATA_CHANGE_TRACKING == EPLS_k_ENABLE)
+/**
+* @brief This function signals a write access to a mappable object to the SPDO, if the data is changed.
+*
+* The Tx SPDOs mapping the written bytes are sent with the next SPDO_BuildTxSpdo(), as after SPDO_TxDataChanged().
+* It has to be called before the data is copied into the OD.
+*
+* @param        b_instNum         instance number (not checked, checked in SOD_Write()) valid range: 0..(EPLS_cfg_MAX_INSTANCES-1)
+*
+* @param        pv_data           pointer to the data to be written (pointer not checked, checked in SOD_Write()) valid range : <> NULL
+*
+* @param        ps_object         pointer to the SOD entry (pointer not checked, only called with reference to struct in SOD_Write()) valid range : <> NULL
+*
+* @param        dw_offset         start offset in bytes of the segment within the data block (not checked, checked in SOD_Write()) valid range : UINT32
+*
+* @param        dw_size           size in bytes of the segment (not checked, checked in SOD_Write()) valid range : UINT32
+*/
+static void TxDataChanged(BYTE_B_INSTNUM_ const void *pv_data,
+                          const SOD_t_OBJECT *ps_object,
+                          UINT32 dw_offset, UINT32 dw_size)
+{
+  const UINT8 *pb_dst; /* pointer to the written bytes in the OD */
+  UINT32 dw_len; /* number of the written bytes */
+
+  /* if the object is mappable */
+  if (EPLS_IS_BIT_SET(ps_object->s_attr.w_attr, SOD_k_ATTR_PDO_MAP))
   {
-    /* the data segment is copied into the object dictionary */
-    MEMCOPY((void *)(ADD_OFFSET(pv_dst, dw_offset)), pv_data, dw_size);
+    /* if the whole object is written */
+    if ((dw_size == 0U) && (dw_offset == 0U))
+    {
+      dw_len = ps_object->s_attr.dw_objLen;
+    }
+    /* else a segment of the object is written */
+    else
+    {
+      dw_len = dw_size;
+    }
+
+    pb_dst = ADD_OFFSET(ObjData(ps_object), dw_offset);
+
+    /* if the data is changed */
+    if (MEMCOMP(pb_dst, pv_data, dw_len) != 0)
+    {
+      SPDO_TxObjWritten(B_INSTNUM_ pb_dst, dw_len);
+    }
+    /* no else : the data is not changed */
   }
+  /* no else : the object can not be mapped */
 
   /* call the Control Flow Monitoring */
   SCFM_TACK_PATH();
 }
+#endif
 /** @} */
@@ -113,6 +113,21 @@ void SPDO_ActivateStart(BYTE_B_INSTNUM);
 
 void SPDO_SetExtCtInitValue(BYTE_B_INSTNUM_ UINT64 const ddw_ctInitVal);
 
+#if (SPDO_cfg_TX_DATA_CHANGE_TRACKING == EPLS_k_ENABLE)
+/**
+* @brief This function is called by the SOD, if the data of a mappable object is changed.
+*
+* The Tx SPDOs mapping any of the written bytes are signaled as after SPDO_TxDataChanged().
+*
+* @param        b_instNum        instance number (not checked, checked in SOD_Write()), valid range: 0..(EPLS_cfg_MAX_INSTANCES-1)
+*
+* @param        pv_data          pointer to the first written byte in the SOD (not checked, any value allowed)
+*
+* @param        dw_len           number of the written bytes (not checked, any value allowed), valid range: (UINT32)
+*/
+void SPDO_TxObjWritten(BYTE_B_INSTNUM_ const void *pv_data, UINT32 dw_len);
+#endif
+
 #endif
 
 /** @} */
@@ -46,6 +46,9 @@ void SPDO_UpdateExtCtValue(BYTE_B_INSTNUM_ UINT32 const dw_ct);
 *
 * If a TxSPDO was built and sent then pw_noFreeFrm will be decremented.
 *
+* Only the TxSPDOs with new data, see SPDO_TxDataChanged(), or an expired refresh prescale time are
+* visited for the data only SPDOs.
+*
 * @attention The smallest Refresh Prescale time in the SOD object with index 0x1C00-0x1FFE and
 * sub-index 0x02 gives the call frequency of this function.
 *
@@ -103,6 +106,10 @@ void SPDO_ProcessRxSpdo(BYTE_B_INSTNUM_ UINT32 dw_ct, UINT8 *pb_rxFrm,
 *
 * This Tx SPDO is immediately sent by the SPDO_BuildTxSpdo() before the refresh prescale timeout.
 *
+* If SPDO_cfg_TX_DATA_CHANGE_TRACKING is enabled, the call is not needed after the data was changed
+* by SOD_Write() or by the Tx image of the process image. Such writes signal the Tx SPDOs mapping the
+* changed data.
+*
 * @see          SPDO_BuildTxSpdo()
 *
 * @param        b_instNum          instance number (checked) valid range: 0..(EPLS_cfg_MAX_INSTANCES-1)
@@ -126,6 +133,23 @@ void SPDO_TxDataChanged(BYTE_B_INSTNUM_ UINT16 w_txSpdoNum);
 #if (SPDO_cfg_MAX_NO_RX_SPDO != 0)
   void SPDO_CheckRxTimeout(BYTE_B_INSTNUM_ UINT32 dw_ct);
 #endif
+
+/**
+* @brief This function returns the earliest SCT deadline of all RxSPDOs.
+*
+* An event driven application does not have to call SPDO_CheckRxTimeout() before this
+* deadline, unless a frame was processed in the meantime.
+*
+* @param        b_instNum        instance number (checked) valid range: 0..(EPLS_cfg_MAX_INSTANCES-1)
+* @retval       pdw_ct           consecutive time of the deadline (checked) valid range: <> NULL
+*
+* @return
+* - TRUE             - a deadline is pending
+* - FALSE            - no deadline is pending or the parameters are invalid
+*/
+#if (SPDO_cfg_MAX_NO_RX_SPDO != 0)
+  BOOLEAN SPDO_GetNextRxTimeout(BYTE_B_INSTNUM_ UINT32 *pdw_ct);
+#endif
   /**
   * @brief This function reads the status of the SPDO.
   *
@@ -48,6 +48,23 @@
     UINT16 w_spdoIdx;
   } t_ADR_TO_SPDO_NUM;
 
+  /**
+   * Sparse assignment table, only the assigned SN addresses are stored.
+   *
+   * The entries are sorted by the SN address and searched binary. The entries of all instances are
+   * taken from one array, the main instance gets SPDO_cfg_MAX_NO_xX_SPDO entries, every other instance
+   * SPDO_cfg_MAX_NO_xX_SPDO_SDG entries.
+  */
+  typedef struct
+  {
+    /** entries sorted by the SN address, the part of the instance in the shared array */
+    t_ADR_TO_SPDO_NUM *ps_entry;
+    /** number of the assigned SN addresses */
+    UINT16 w_noEntries;
+    /** maximum number of entries */
+    UINT16 w_maxEntries;
+  } t_ADR_MAP;
+
 #else
   /**
    * The lookup table is addressed by the SN address.
@@ -69,10 +86,10 @@ typedef struct
   #if (SPDO_cfg_SPDO_NUM_LOOK_UP_TABLE == EPLS_k_DISABLE)
     #if (SPDO_cfg_MAX_NO_RX_SPDO != 0)
       /** SADR to Rx SPDO index table */
-      t_ADR_TO_SPDO_NUM as_sAdrToRxSpdoIdx[SPDO_cfg_MAX_NO_RX_SPDO];
+      t_ADR_MAP s_sAdrToRxSpdoIdx;
     #endif
     /** TADR to Tx SPDO index table */
-    t_ADR_TO_SPDO_NUM as_tAdrToTxSpdoIdx[SPDO_cfg_MAX_NO_TX_SPDO];
+    t_ADR_MAP s_tAdrToTxSpdoIdx;
   #else
     #if (SPDO_cfg_MAX_NO_RX_SPDO != 0)
       /** SADR to Rx SPDO index table */
@@ -92,6 +109,21 @@ typedef struct
 
 static t_ASSIGN_OBJ as_Obj[EPLS_cfg_MAX_INSTANCES] SAFE_NO_INIT_SEKTOR;
 
+#if (SPDO_cfg_SPDO_NUM_LOOK_UP_TABLE == EPLS_k_DISABLE)
+  #if (SPDO_cfg_MAX_NO_RX_SPDO != 0)
+    /** entries of the SADR to Rx SPDO index tables of all instances */
+    static t_ADR_TO_SPDO_NUM as_SAdrToRxSpdoIdx[SPDO_SHARED_SIZE(SPDO_cfg_MAX_NO_RX_SPDO,
+                                                                 SPDO_cfg_MAX_NO_RX_SPDO_SDG)] SAFE_NO_INIT_SEKTOR;
+  #endif
+  /** entries of the TADR to Tx SPDO index tables of all instances */
+  static t_ADR_TO_SPDO_NUM as_TAdrToTxSpdoIdx[SPDO_SHARED_SIZE(SPDO_cfg_MAX_NO_TX_SPDO,
+                                                               SPDO_cfg_MAX_NO_TX_SPDO_SDG)] SAFE_NO_INIT_SEKTOR;
+
+  static UINT16 FindAdr(const t_ADR_MAP *ps_map, UINT16 w_adr);
+  static BOOLEAN InsertAdr(t_ADR_MAP *ps_map, UINT16 w_adr, UINT16 w_spdoIdx);
+  static UINT16 GetSpdoIdx(const t_ADR_MAP *ps_map, UINT16 w_adr);
+#endif
+
 /**
  * @brief This function initializes the assignment tables for the SPDOs.
  *
@@ -100,24 +132,28 @@ static t_ASSIGN_OBJ as_Obj[EPLS_cfg_MAX_INSTANCES] SAFE_NO_INIT_SEKTOR;
 void SPDO_InitAssign(BYTE_B_INSTNUM)
 {
   t_ASSIGN_OBJ *po_this = &as_Obj[B_INSTNUMidx]; /* instance pointer */
-  UINT32 i; /* loop counter */
+  #if (SPDO_cfg_SPDO_NUM_LOOK_UP_TABLE == EPLS_k_ENABLE)
+    UINT32 i; /* loop counter */
+  #endif
 
   #if (SPDO_cfg_SPDO_NUM_LOOK_UP_TABLE == EPLS_k_DISABLE)
     #if (SPDO_cfg_MAX_NO_RX_SPDO != 0)
       /* SADR to Rx SPDO index table is initialized */
-      for(i = 0U; i < (UINT32)SPDO_cfg_MAX_NO_RX_SPDO; i++)
-      {
-        po_this->as_sAdrToRxSpdoIdx[i].w_spdoIdx = k_INVALID_SPDO_NUM;
-        po_this->as_sAdrToRxSpdoIdx[i].w_adr = k_NOT_USED_ADR;
-      }
+      po_this->s_sAdrToRxSpdoIdx.ps_entry =
+          &as_SAdrToRxSpdoIdx[SPDO_SHARED_START(B_INSTNUMidx, SPDO_cfg_MAX_NO_RX_SPDO,
+                                                SPDO_cfg_MAX_NO_RX_SPDO_SDG)];
+      po_this->s_sAdrToRxSpdoIdx.w_maxEntries =
+          SPDO_SHARED_NUM(B_INSTNUMidx, SPDO_cfg_MAX_NO_RX_SPDO, SPDO_cfg_MAX_NO_RX_SPDO_SDG);
+      po_this->s_sAdrToRxSpdoIdx.w_noEntries = 0U;
     #endif
 
     /* TADR to Tx SPDO index table is initialized */
-    for(i = 0U; i < (UINT32)SPDO_cfg_MAX_NO_TX_SPDO; i++)
-    {
-      po_this->as_tAdrToTxSpdoIdx[i].w_spdoIdx = k_INVALID_SPDO_NUM;
-      po_this->as_tAdrToTxSpdoIdx[i].w_adr = k_NOT_USED_ADR;
-    }
+    po_this->s_tAdrToTxSpdoIdx.ps_entry =
+        &as_TAdrToTxSpdoIdx[SPDO_SHARED_START(B_INSTNUMidx, SPDO_cfg_MAX_NO_TX_SPDO,
+                                              SPDO_cfg_MAX_NO_TX_SPDO_SDG)];
+    po_this->s_tAdrToTxSpdoIdx.w_maxEntries =
+        SPDO_SHARED_NUM(B_INSTNUMidx, SPDO_cfg_MAX_NO_TX_SPDO, SPDO_cfg_MAX_NO_TX_SPDO_SDG);
+    po_this->s_tAdrToTxSpdoIdx.w_noEntries = 0U;
   #else
     /* The TADR to Tx SPDO index table and the SADR to Rx SPDO index
        lookup tables are initialized (k_LOOKUP_TABLE_SIZE is divisible by 4
@@ -183,12 +219,6 @@ void SPDO_InitAssign(BYTE_B_INSTNUM)
     BOOLEAN o_ret = FALSE; /* return value */
     t_ASSIGN_OBJ *po_this = &as_Obj[B_INSTNUMidx]; /* instance pointer */
     UINT16 w_spdoIdx; /* temporary variable for SPDO index */
-    #if (SPDO_cfg_SPDO_NUM_LOOK_UP_TABLE == EPLS_k_DISABLE)
-      BOOLEAN o_break = FALSE; /* flag for breaking the for cycle */
-      UINT32 rx; /* loop counter */
-      t_ADR_TO_SPDO_NUM *ps_rxTableEntry; /* pointer to access the rx SPDO
-                                             number table */
-    #endif
 
     /* if SPDO is not used */
     if (w_sAdr == k_NOT_USED_ADR)
@@ -210,36 +240,16 @@ void SPDO_InitAssign(BYTE_B_INSTNUM)
       if (w_spdoIdx == k_INVALID_SPDO_NUM)
       {
         #if (SPDO_cfg_SPDO_NUM_LOOK_UP_TABLE == EPLS_k_DISABLE)
-          rx = 0U;
-          /* SADR to Rx SPDO number is inserted */
-          while ((rx < (UINT32)SPDO_cfg_MAX_NO_RX_SPDO) && (!o_break))
+          /* if SADR to Rx SPDO number is inserted */
+          if (InsertAdr(&po_this->s_sAdrToRxSpdoIdx, w_sAdr, w_rxSpdoIdx))
           {
-            ps_rxTableEntry = &po_this->as_sAdrToRxSpdoIdx[rx];
-            /* if address has been already inserted */
-            if (ps_rxTableEntry->w_adr == w_sAdr)
-            {
-              /* error happened (See Returnvalue) */
-              o_break = TRUE;
-            }
-            /* else address was not found */
-            else
-            {
-              /* if address is free */
-              if (ps_rxTableEntry->w_adr == k_NOT_USED_ADR)
-              {
-                ps_rxTableEntry->w_adr = w_sAdr;
-                ps_rxTableEntry->w_spdoIdx = w_rxSpdoIdx;
-
-                /* the last and the largest SPDO index is stored */
-                po_this->w_noProcRxSpdo = (UINT16)(w_rxSpdoIdx + 1U);
-
-                o_ret = TRUE;
-                o_break = TRUE;
-              }
-              /* no else : next entry */
-              rx++;
-            }
+            /* the last and the largest SPDO index is stored */
+            po_this->w_noProcRxSpdo = (UINT16)(w_rxSpdoIdx + 1U);
+
+            o_ret = TRUE;
           }
+          /* no else : address has been already inserted or the table is full
+             error happened (See Returnvalue) */
         #else
           /* address is free */
           if (po_this->aw_sAdrToRxSpdoIdx[w_sAdr] == k_INVALID_SPDO_NUM)
@@ -285,12 +295,6 @@ BOOLEAN SPDO_AddTAdr(BYTE_B_INSTNUM_ UINT16 w_txSpdoIdx, UINT16 w_tAdr)
   #if (SPDO_cfg_MAX_NO_RX_SPDO != 0)
     UINT16 w_spdoIdx; /* temporary variable for SPDO index */
   #endif
-  #if (SPDO_cfg_SPDO_NUM_LOOK_UP_TABLE == EPLS_k_DISABLE)
-    BOOLEAN o_break = FALSE; /* flag for breaking the for cycle */
-    UINT32 tx; /* loop counter */
-    t_ADR_TO_SPDO_NUM *ps_txTableEntry; /* pointer to access the tx SPDO number
-                                           table */
-  #endif
 
   /* if SPDO is not used */
   if (w_tAdr == k_NOT_USED_ADR)
@@ -318,36 +322,16 @@ BOOLEAN SPDO_AddTAdr(BYTE_B_INSTNUM_ UINT16 w_txSpdoIdx, UINT16 w_tAdr)
     /* RSM_IGNORE_QUALITY_END */
 
       #if (SPDO_cfg_SPDO_NUM_LOOK_UP_TABLE == EPLS_k_DISABLE)
-        tx = 0U;
-        /* TADR to Tx SPDO index is inserted */
-        while ((tx < (UINT32)SPDO_cfg_MAX_NO_TX_SPDO) && (!o_break))
+        /* if TADR to Tx SPDO index is inserted */
+        if (InsertAdr(&po_this->s_tAdrToTxSpdoIdx, w_tAdr, w_txSpdoIdx))
         {
-          ps_txTableEntry = &po_this->as_tAdrToTxSpdoIdx[tx];
-          /* if address is not free */
-          if (ps_txTableEntry->w_adr == w_tAdr)
-          {
-            /* error happened (See Returnvalue) */
-            o_break = TRUE;
-          }
-          /* else address was not found */
-          else
-          {
-            /* if address is free */
-            if (ps_txTableEntry->w_adr == k_NOT_USED_ADR)
-            {
-              ps_txTableEntry->w_adr = w_tAdr;
-              ps_txTableEntry->w_spdoIdx = w_txSpdoIdx;
-
-              /* the last and the largest SPDO index is stored */
-              po_this->w_noProcTxSpdo = (UINT16)(w_txSpdoIdx + 1U);
-
-              o_ret = TRUE;
-              o_break = TRUE;
-            }
-            /* no else : next entry */
-            tx++;
-          }
+          /* the last and the largest SPDO index is stored */
+          po_this->w_noProcTxSpdo = (UINT16)(w_txSpdoIdx + 1U);
+
+          o_ret = TRUE;
         }
+        /* no else : address is not free or the table is full
+           error happened (See Returnvalue) */
       #else
         /* address is free */
         if (po_this->aw_tAdrToTxSpdoIdx[w_tAdr] == k_INVALID_SPDO_NUM)
@@ -387,34 +371,10 @@ BOOLEAN SPDO_AddTAdr(BYTE_B_INSTNUM_ UINT16 w_txSpdoIdx, UINT16 w_tAdr)
   {
     UINT16 w_ret = k_INVALID_SPDO_NUM; /* return value */
     t_ASSIGN_OBJ *po_this = &as_Obj[B_INSTNUMidx]; /* instance pointer */
-    #if (SPDO_cfg_SPDO_NUM_LOOK_UP_TABLE == EPLS_k_DISABLE)
-      BOOLEAN o_break = FALSE; /* flag for breaking the for cycle */
-      UINT32 i; /* loop counter */
-    #endif
 
     #if (SPDO_cfg_SPDO_NUM_LOOK_UP_TABLE == EPLS_k_DISABLE)
-      i = 0U;
       /* search SADR */
-      while ((i < (UINT32)SPDO_cfg_MAX_NO_RX_SPDO) && (!o_break))
-      {
-        /* if address is found */
-        if (po_this->as_sAdrToRxSpdoIdx[i].w_adr == w_sAdr)
-        {
-          w_ret = po_this->as_sAdrToRxSpdoIdx[i].w_spdoIdx;
-          o_break = TRUE;
-        }
-        /* else address is not found */
-        else
-        {
-          /* if end of the source address table */
-          if (po_this->as_sAdrToRxSpdoIdx[i].w_adr == k_NOT_USED_ADR)
-          {
-            o_break = TRUE;
-          }
-          /* no else : next entry */
-          i++;
-        }
-      }
+      w_ret = GetSpdoIdx(&po_this->s_sAdrToRxSpdoIdx, w_sAdr);
     #else
       /* get Spdo index */
       w_ret = po_this->aw_sAdrToRxSpdoIdx[w_sAdr];
@@ -439,34 +399,10 @@ UINT16 SPDO_GetSpdoIdxForTAdr(BYTE_B_INSTNUM_ UINT16 w_tAdr)
 {
   UINT16 w_ret = k_INVALID_SPDO_NUM; /* return value */
   t_ASSIGN_OBJ *po_this = &as_Obj[B_INSTNUMidx]; /* instance pointer */
-  #if (SPDO_cfg_SPDO_NUM_LOOK_UP_TABLE == EPLS_k_DISABLE)
-    BOOLEAN o_break = FALSE; /* flag for breaking the for cycle */
-    UINT32 i; /* loop counter */
-  #endif
 
   #if (SPDO_cfg_SPDO_NUM_LOOK_UP_TABLE == EPLS_k_DISABLE)
-    i = 0U;
-    /* search SADR */
-    while ((i < (UINT32)SPDO_cfg_MAX_NO_TX_SPDO) && (!o_break))
-    {
-      /* if address is found */
-      if (po_this->as_tAdrToTxSpdoIdx[i].w_adr == w_tAdr)
-      {
-        w_ret = po_this->as_tAdrToTxSpdoIdx[i].w_spdoIdx;
-        o_break = TRUE;
-      }
-      /* else address is not found */
-      else
-      {
-        /* if end of the target address table */
-        if (po_this->as_tAdrToTxSpdoIdx[i].w_adr == k_NOT_USED_ADR)
-        {
-          o_break = TRUE;
-        }
-        /* no else : next entry */
-        i++;
-      }
-    }
+    /* search TADR */
+    w_ret = GetSpdoIdx(&po_this->s_tAdrToTxSpdoIdx, w_tAdr);
   #else
     /* get Spdo index */
     w_ret = po_this->aw_tAdrToTxSpdoIdx[w_tAdr];
@@ -510,4 +446,112 @@ UINT16 SPDO_GetNoProcTxSpdo(BYTE_B_INSTNUM)
   return as_Obj[B_INSTNUMidx].w_noProcTxSpdo;
 }
 
+#if (SPDO_cfg_SPDO_NUM_LOOK_UP_TABLE == EPLS_k_DISABLE)
+/**
+ * @brief This function searches the position of an SN address in a sparse assignment table.
+ *
+ * @param        ps_map               assignment table (not checked, only called with reference to struct) valid range: <> NULL
+ *
+ * @param        w_adr                SN address (not checked, any value allowed) valid range: (UINT16)
+ *
+ * @return       position of the first entry with an SN address >= w_adr, number of the entries if there is none
+ */
+static UINT16 FindAdr(const t_ADR_MAP *ps_map, UINT16 w_adr)
+{
+  UINT16 w_low = 0U; /* first entry of the search range */
+  UINT16 w_high = ps_map->w_noEntries; /* entry after the search range */
+  UINT16 w_mid; /* entry in the middle of the search range */
+
+  /* binary search for the first entry with an SN address >= w_adr */
+  while (w_low < w_high)
+  {
+    w_mid = (UINT16)(w_low + ((UINT16)(w_high - w_low) >> 1));
+
+    /* if the SN address of the entry is lower */
+    if (ps_map->ps_entry[w_mid].w_adr < w_adr)
+    {
+      w_low = (UINT16)(w_mid + 1U);
+    }
+    else
+    {
+      w_high = w_mid;
+    }
+  }
+
+  return w_low;
+}
+
+/**
+ * @brief This function inserts an SN address with SPDO index into a sparse assignment table.
+ *
+ * @param        ps_map               assignment table (not checked, only called with reference to struct) valid range: <> NULL
+ *
+ * @param        w_adr                SN address (not checked, checked in SPDO_AddSAdr() or SPDO_AddTAdr()) valid range: 1..(EPLS_k_MAX_SADR)
+ *
+ * @param        w_spdoIdx            SPDO index (not checked, checked in SPDO_ActivateRxSpdoMapping() or SPDO_ActivateTxSpdoMapping()) valid range: 0..(SPDO_cfg_MAX_NO_xX_SPDO-1)
+ *
+ * @return
+ * - TRUE             - success
+ * - FALSE            - the SN address has been already inserted or the table is full
+ */
+static BOOLEAN InsertAdr(t_ADR_MAP *ps_map, UINT16 w_adr, UINT16 w_spdoIdx)
+{
+  BOOLEAN o_ret = FALSE; /* return value */
+  UINT16 w_pos = FindAdr(ps_map, w_adr); /* position of the new entry */
+  UINT16 w_entry; /* loop counter */
+
+  /* if the address has been already inserted */
+  if ((w_pos < ps_map->w_noEntries) && (ps_map->ps_entry[w_pos].w_adr == w_adr))
+  {
+    /* error happened (See Returnvalue) */
+  }
+  /* else if the table is full */
+  else if (ps_map->w_noEntries >= ps_map->w_maxEntries)
+  {
+    /* error happened (See Returnvalue) */
+  }
+  /* else the address is inserted */
+  else
+  {
+    /* the entries with a higher SN address are moved up */
+    for (w_entry = ps_map->w_noEntries; w_entry > w_pos; w_entry--)
+    {
+      ps_map->ps_entry[w_entry] = ps_map->ps_entry[w_entry - 1U];
+    }
+
+    ps_map->ps_entry[w_pos].w_adr = w_adr;
+    ps_map->ps_entry[w_pos].w_spdoIdx = w_spdoIdx;
+    ps_map->w_noEntries++;
+
+    o_ret = TRUE;
+  }
+
+  return o_ret;
+}
+
+/**
+ * @brief This function gets the SPDO index of an SN address from a sparse assignment table.
+ *
+ * @param        ps_map               assignment table (not checked, only called with reference to struct) valid range: <> NULL
+ *
+ * @param        w_adr                SN address (not checked, any value allowed) valid range: (UINT16)
+ *
+ * @return       0..1022            - valid SPDO index  k_INVALID_SPDO_NUM - the SN address is not assigned
+ */
+static UINT16 GetSpdoIdx(const t_ADR_MAP *ps_map, UINT16 w_adr)
+{
+  UINT16 w_ret = k_INVALID_SPDO_NUM; /* return value */
+  UINT16 w_pos = FindAdr(ps_map, w_adr); /* position of the SN address */
+
+  /* if the address is found */
+  if ((w_pos < ps_map->w_noEntries) && (ps_map->ps_entry[w_pos].w_adr == w_adr))
+  {
+    w_ret = ps_map->ps_entry[w_pos].w_spdoIdx;
+  }
+  /* no else : the address is not assigned */
+
+  return w_ret;
+}
+#endif
+
 /** @} */
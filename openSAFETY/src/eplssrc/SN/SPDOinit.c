@@ -71,10 +71,12 @@ BOOLEAN SPDO_InitAll(BYTE_B_INSTNUM_ UINT16 *pw_noTxSpdo, UINT16 *pw_noRxSpdo)
   BOOLEAN o_ret = FALSE; /* return value */
 
   SPDO_InitTxSm(B_INSTNUM);
+  SPDO_InitTxSyncProd(B_INSTNUM);
   SPDO_InitTxMapp(B_INSTNUM);
   #if (SPDO_cfg_MAX_NO_RX_SPDO != 0)
     SPDO_InitRxMapp(B_INSTNUM);
     SPDO_InitRxSyncCons(B_INSTNUM);
+    SPDO_InitRxCons(B_INSTNUM);
   #endif
 
   SPDO_InitAssign(B_INSTNUM);
@@ -127,6 +127,25 @@
  */
 #define SPDO_NUM_TO_INTERNAL_SPDO_IDX(spdoNum) ((UINT16)((spdoNum)-1U))
 
+/**
+ * @name Arrays shared by all instances
+ *
+ * The per SPDO structures of all instances are taken from one array. The main instance gets the first
+ * SPDO_cfg_MAX_NO_xX_SPDO entries, every other instance the following SPDO_cfg_MAX_NO_xX_SPDO_SDG entries.
+ * The arrays are divided in the init functions, like the mapping parameters and the SPDO statistic counters.
+ * @{
+ */
+/** number of entries of an array shared by all instances */
+#define SPDO_SHARED_SIZE(w_noMain, w_noSdg) \
+    ((w_noMain) + ((EPLS_cfg_MAX_INSTANCES - 1) * (w_noSdg)))
+/** index of the first entry of an instance in an array shared by all instances */
+#define SPDO_SHARED_START(b_inst, w_noMain, w_noSdg) \
+    (((b_inst) == 0U) ? 0UL : ((UINT32)(w_noMain) + (((UINT32)(b_inst) - 1UL) * (UINT32)(w_noSdg))))
+/** number of entries of an instance in an array shared by all instances */
+#define SPDO_SHARED_NUM(b_inst, w_noMain, w_noSdg) \
+    ((UINT16)(((b_inst) == 0U) ? (w_noMain) : (w_noSdg)))
+/** @} */
+
 #if (SPDO_cfg_PROP_DELAY_STATISTIC == EPLS_k_ENABLE)
   /**
   * PROP_DELAY_DIVISOR defines the divisor for the SHNF_adwPropDelayStatistic
@@ -305,6 +324,10 @@ typedef struct
     UINT32 dw_sct;
     /** CT when the last RxSPDO got received */
     UINT32 dw_CtLastReceived;
+    /** position in the deadline heap, k_NOT_SCHEDULED if no deadline is pending */
+    UINT16 w_heapPos;
+    /** next deadline (SCT or timeout of the extended CT), only valid if scheduled */
+    UINT32 dw_deadline;
 
 #if (SPDO_cfg_40_BIT_CT_SUPPORT == EPLS_k_ENABLE)
     /** extended CT of the producer */
@@ -360,8 +383,11 @@ typedef struct
  */
 typedef struct
 {
-    /** sturcture array for the "Time Synchronization Producer" state machine */
-    t_TX_SYNC_PROD_SM as_txSyncProdSm[SPDO_cfg_MAX_NO_TX_SPDO];
+    /**
+     * structure array for the "Time Synchronization Producer" state machine, the part of the instance
+     * in the array shared by all instances
+     */
+    t_TX_SYNC_PROD_SM *ps_txSyncProdSm;
 } t_TX_SYNC_PROD_SM_OBJ;
 
 /**
@@ -390,8 +416,6 @@ typedef struct
   #endif
     /** timeout for the delta t (SPDO cycle time) */
     UINT32 dw_timeoutDT;
-    /** if TRUE then new Tx PDO data are available */
-    BOOLEAN o_newData;
     /**
      * Flag for SPDO last Ct check
      *
@@ -421,13 +445,32 @@ typedef struct
     t_VARIABLE_FOR_TX_SPDO s_txVar;
 } t_TX_SPDO;
 
+/**
+ * Number of words of a bit set of the Tx SPDOs, the Tx SPDO index i is bit (i % 32) of word (i / 32).
+ */
+#define SPDO_k_TX_SET_WORDS (((UINT16)SPDO_cfg_MAX_NO_TX_SPDO + 31U) / 32U)
+
 /**
  * Object structure for the SPDO Producer state machine.
  */
 typedef struct
 {
-    /** Tx SPDO structure */
-    t_TX_SPDO as_txSpdo[SPDO_cfg_MAX_NO_TX_SPDO];
+    /** Tx SPDO structures, the part of the instance in the array shared by all instances */
+    t_TX_SPDO *ps_txSpdo;
+    /** bit set of the Tx SPDOs with new data, which was not sent yet */
+    UINT32 adw_newData[SPDO_k_TX_SET_WORDS];
+    /**
+     * Bit set of the Tx SPDOs to be processed by the SPDO Producer state machine, the Tx SPDOs with new data,
+     * an expired refresh time or a Tx SPDO sent by the time synchronization
+     */
+    UINT32 adw_due[SPDO_k_TX_SET_WORDS];
+    /**
+     * Earliest refresh timeout of the Tx SPDOs not in adw_due, the refresh times are checked again after it
+     * expired. Only valid if o_refreshValid is TRUE.
+     */
+    UINT32 dw_nextRefresh;
+    /** FALSE if the refresh times are to be checked with the next call of SPDO_ProdSmDue() */
+    BOOLEAN o_refreshValid;
 } t_TXSM_OBJ;
 
 /**
@@ -584,6 +627,25 @@ BOOLEAN SPDO_TxSpdoIdxExists(BYTE_B_INSTNUM_ UINT16 w_txSpdoIdx);
  */
 void SPDO_NewData(BYTE_B_INSTNUM_ UINT16 w_txSpdoIdx);
 
+/**
+ * @brief This function sets the new data flag for the given Tx SPDO, without any check.
+ *
+ * @param        b_instNum          instance number (not checked, checked in SPDO_TxDataChanged() or SOD_Write() or SPDO_BuildTxSpdo()) valid range: 0..(EPLS_cfg_MAX_INSTANCES-1)
+ *
+ * @param        w_txSpdoIdx        index in the internal array of the Tx SPDO structures (not checked, checked in SPDO_TxSpdoIdxExists() or created in SPDO_TxObjWritten()) valid range: 0..(SPDO_cfg_MAX_NO_TX_SPDO-1)
+ */
+void SPDO_MarkTxData(BYTE_B_INSTNUM_ UINT16 w_txSpdoIdx);
+
+#if ((SPDO_cfg_PROCESS_IMAGE == EPLS_k_ENABLE) && \
+     (SPDO_cfg_TX_DATA_CHANGE_TRACKING == EPLS_k_ENABLE))
+/**
+ * @brief This function sets the new data flag for the Tx SPDOs, whose image was changed by the application.
+ *
+ * @param        b_instNum          instance number (not checked, checked in SPDO_BuildTxSpdo()) valid range: 0..(EPLS_cfg_MAX_INSTANCES-1)
+ */
+void SPDO_TakeTxImageChanges(BYTE_B_INSTNUM);
+#endif
+
 /**
  * @brief Realization of the "SPDO Producer" state machine.
  *
@@ -601,6 +663,24 @@ void SPDO_NewData(BYTE_B_INSTNUM_ UINT16 w_txSpdoIdx);
 void SPDO_ProdSm(BYTE_B_INSTNUM_ UINT32 dw_ct, UINT16 w_txSpdoIdx,
         UINT16 *pw_noFreeFrm);
 
+/**
+ * @brief This function calls the "SPDO Producer" state machine for the Tx SPDOs, which are due.
+ *
+ * A Tx SPDO is due, if new data is available, its refresh time expired or it was sent by the time
+ * synchronization since the last call. The other Tx SPDOs are not visited. The refresh times are only
+ * checked, when the earliest of them expired.
+ *
+ * @param        b_instNum               instance number (not checked, checked in SPDO_BuildTxSpdo()) valid range: 0..(EPLS_cfg_MAX_INSTANCES-1)
+ *
+ * @param        dw_ct                   consecutive time, internal timer value (not checked, any value allowed) valid range: (UINT32)
+ *
+ * @param        w_noTxSpdo              number of the Tx SPDOs to be processed (not checked, checked in SPDO_GetNoProcTxSpdo()) valid range: 0..SPDO_cfg_MAX_NO_TX_SPDO
+ *
+ * @retval       pw_noFreeFrm            number of the free frames to be sent (pointer not checked, checked in SPDO_BuildTxSpdo()) valid range: <> NULL
+ */
+void SPDO_ProdSmDue(BYTE_B_INSTNUM_ UINT32 dw_ct, UINT16 w_noTxSpdo,
+        UINT16 *pw_noFreeFrm);
+
 /**
  * @brief This function sends a Tx SPDO
  *
@@ -637,6 +717,13 @@ BOOLEAN SPDO_SendTxSpdo(BYTE_B_INSTNUM_ UINT32 dw_ct, UINT16 w_txSpdoIdx,
  * @name Function prototypes for the SPDOtxSyncProdSm.c
  * @{
  */
+/**
+ * @brief This function initializes the pointer to the time synchronization producer state machines of the instance.
+ *
+ * @param        b_instNum          instance number (not checked, checked in SSC_InitAll()), valid range: 0..(EPLS_cfg_MAX_INSTANCES-1)
+ */
+void SPDO_InitTxSyncProd(BYTE_B_INSTNUM);
+
 /**
  * @brief This function resets the given SPDO time synchronization producer state machine.
  *
@@ -812,6 +899,58 @@ void SPDO_ResetConnectionValidBitField(BYTE_B_INSTNUM);
 BOOLEAN SPDO_CtValid(BYTE_B_INSTNUM_ UINT16 w_rxSpdoIdx, UINT16 w_rxSpdoCt);
 #endif
 
+/**
+ * @brief This function initializes the deadline heap of the SPDO Consumer State Machines.
+ *
+ * @param        b_instNum          instance number (not checked, checked in SSC_InitAll()), valid range: 0..(EPLS_cfg_MAX_INSTANCES-1)
+ */
+#if (SPDO_cfg_MAX_NO_RX_SPDO != 0)
+void SPDO_InitRxCons(BYTE_B_INSTNUM);
+#endif
+
+/**
+ * @brief This function returns the Rx SPDO with the earliest deadline, if the deadline elapsed.
+ *
+ * @param        b_instNum          instance number (not checked, checked in SPDO_CheckRxTimeout()), valid range: 0..(EPLS_cfg_MAX_INSTANCES-1)
+ *
+ * @param        dw_ct              consecutive time, internal timer value (not checked, any value allowed) valid range: (UINT32)
+ *
+ * @retval       pw_rxSpdoIdx       Rx SPDO index of the elapsed deadline (pointer not checked, only called with reference to variable) valid range: <> NULL
+ *
+ * @return
+ * - TRUE             - a deadline elapsed, the Rx SPDO is to be checked
+ * - FALSE            - no deadline elapsed
+ */
+#if (SPDO_cfg_MAX_NO_RX_SPDO != 0)
+BOOLEAN SPDO_ConsSmGetDue(BYTE_B_INSTNUM_ UINT32 dw_ct, UINT16 *pw_rxSpdoIdx);
+#endif
+
+/**
+ * @brief This function returns the earliest deadline of all Rx SPDOs.
+ *
+ * @param        b_instNum          instance number (not checked, checked in SPDO_GetNextRxTimeout()), valid range: 0..(EPLS_cfg_MAX_INSTANCES-1)
+ *
+ * @retval       pdw_deadline       consecutive time of the deadline (pointer not checked, checked in SPDO_GetNextRxTimeout()) valid range: <> NULL
+ *
+ * @return
+ * - TRUE             - a deadline is pending
+ * - FALSE            - no deadline is pending, all Rx SPDOs are in the safe state
+ */
+#if (SPDO_cfg_MAX_NO_RX_SPDO != 0)
+BOOLEAN SPDO_ConsSmNextDeadline(BYTE_B_INSTNUM_ UINT32 *pdw_deadline);
+#endif
+
+/**
+ * @brief This function removes the deadline of a Rx SPDO.
+ *
+ * @param        b_instNum          instance number (not checked, checked in SPDO_CheckRxTimeout()), valid range: 0..(EPLS_cfg_MAX_INSTANCES-1)
+ *
+ * @param        w_rxSpdoIdx        Rx SPDO index (not checked, returned by SPDO_ConsSmGetDue()), valid range: 0..(SPDO_cfg_MAX_NO_RX_SPDO-1)
+ */
+#if (SPDO_cfg_MAX_NO_RX_SPDO != 0)
+void SPDO_ConsSmUnschedule(BYTE_B_INSTNUM_ UINT16 w_rxSpdoIdx);
+#endif
+
 /** @} */
 
 /**
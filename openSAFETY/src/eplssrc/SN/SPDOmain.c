@@ -129,6 +129,10 @@ BOOLEAN SPDO_Init(BYTE_B_INSTNUM)
   * Safety Control Time (SCT) is defined for every RxSPDO in the SOD referenced by index 0x1400-0x17FE
   * and sub-index 0x02 (object name : SCT_U32)
   *
+  * Only the RxSPDOs with an elapsed deadline are checked. The deadlines are kept in a heap by the
+  * SPDO Consumer State Machine, so the check does not depend on the number of RxSPDOs if no deadline
+  * elapsed.
+  *
   * @attention The smallest Safety Control Time in the SOD object with index 0x1400-0x17FE and sub-index
   * 0x02 gives the call frequency of this function.
   *
@@ -140,7 +144,8 @@ BOOLEAN SPDO_Init(BYTE_B_INSTNUM)
     t_SPDO_OBJ *po_this; /* instance pointer */
     /* number of Rx SPDOs to be processed */
     UINT16 w_noProcRxSpdo;
-    UINT16 w_rxSpdoIdx; /* loop counter for the Rx SPDOs */
+    UINT16 w_rxSpdoIdx; /* Rx SPDO with an elapsed deadline */
+    UINT16 w_noChecked; /* loop counter for the checked Rx SPDOs */
 
     #if (EPLS_cfg_MAX_INSTANCES > 1)
       /* if b_instNum is wrong */
@@ -160,12 +165,22 @@ BOOLEAN SPDO_Init(BYTE_B_INSTNUM)
         /* if the SPDO is active */
         if (po_this->o_spdoRunning)
         {
-          /* for all Rx SPDOs to be processed */
-          for(w_rxSpdoIdx=0U; w_rxSpdoIdx < w_noProcRxSpdo; w_rxSpdoIdx++)
+          /* for all Rx SPDOs with an elapsed deadline, every Rx SPDO is checked
+             once at most */
+          for(w_noChecked=0U; (w_noChecked < w_noProcRxSpdo) &&
+              SPDO_ConsSmGetDue(B_INSTNUM_ dw_ct, &w_rxSpdoIdx); w_noChecked++)
           {
-            /* Consumer state machine is called */
-            SPDO_ConsSm(B_INSTNUM_ dw_ct, w_rxSpdoIdx, (EPLS_t_FRM_HDR *)NULL,
-                        (UINT8 *)NULL, FALSE);
+            /* if the Rx SPDO is to be processed */
+            if (w_rxSpdoIdx < w_noProcRxSpdo)
+            {
+              /* Consumer state machine is called, it updates the deadline */
+              SPDO_ConsSm(B_INSTNUM_ dw_ct, w_rxSpdoIdx, (EPLS_t_FRM_HDR *)NULL,
+                          (UINT8 *)NULL, FALSE);
+            }
+            else
+            {
+              SPDO_ConsSmUnschedule(B_INSTNUM_ w_rxSpdoIdx);
+            }
           }
         }
         /* no else : the SPDO is not active */
@@ -174,6 +189,47 @@ BOOLEAN SPDO_Init(BYTE_B_INSTNUM)
     /* call the Control Flow Monitoring */
     SCFM_TACK_PATH();
   }
+
+  /**
+  * @brief This function returns the earliest SCT deadline of all RxSPDOs.
+  *
+  * An event driven application does not have to call SPDO_CheckRxTimeout() before this
+  * deadline, unless a frame was processed in the meantime.
+  *
+  * @param        b_instNum        instance number (checked) valid range: 0..(EPLS_cfg_MAX_INSTANCES-1)
+  * @retval       pdw_ct           consecutive time of the deadline (checked) valid range: <> NULL
+  *
+  * @return
+  * - TRUE             - a deadline is pending
+  * - FALSE            - no deadline is pending or the parameters are invalid
+  */
+  BOOLEAN SPDO_GetNextRxTimeout(BYTE_B_INSTNUM_ UINT32 *pdw_ct)
+  {
+    BOOLEAN o_ret = FALSE; /* return value */
+
+    #if (EPLS_cfg_MAX_INSTANCES > 1)
+      /* if b_instNum is wrong */
+      if(B_INSTNUMidx >= (UINT8)EPLS_cfg_MAX_INSTANCES)
+      {
+        SERR_SetError(B_INSTNUM_ SPDO_k_ERR_INST_INV,
+                      (UINT32)B_INSTNUMidx);
+      }
+      else
+    #endif
+      if (pdw_ct == NULL)
+      {
+        SERR_SetError(B_INSTNUM_ SPDO_k_ERR_PTR_INV, 0UL);
+      }
+      else if (as_Obj[B_INSTNUMidx].o_spdoRunning)
+      {
+        o_ret = SPDO_ConsSmNextDeadline(B_INSTNUM_ pdw_ct);
+      }
+      /* no else : the SPDO is not active */
+
+    /* call the Control Flow Monitoring */
+    SCFM_TACK_PATH();
+    return o_ret;
+  }
 #endif
 
 /**
@@ -181,6 +237,9 @@ BOOLEAN SPDO_Init(BYTE_B_INSTNUM)
 *
 * If a TxSPDO was built and sent then pw_noFreeFrm will be decremented.
 *
+* Only the TxSPDOs with new data, see SPDO_TxDataChanged(), or an expired refresh prescale time are
+* visited for the data only SPDOs.
+*
 * @attention The smallest Refresh Prescale time in the SOD object with index 0x1C00-0x1FFE and
 * sub-index 0x02 gives the call frequency of this function.
 *
@@ -232,6 +291,12 @@ void SPDO_BuildTxSpdo(BYTE_B_INSTNUM_ UINT32 dw_ct, UINT16 *pw_noFreeFrm)
       /* if the SPDO is active */
       if (po_this->o_spdoRunning)
       {
+      #if ((SPDO_cfg_PROCESS_IMAGE == EPLS_k_ENABLE) && \
+           (SPDO_cfg_TX_DATA_CHANGE_TRACKING == EPLS_k_ENABLE))
+        /* Tx SPDOs with a changed image get new data */
+        SPDO_TakeTxImageChanges(B_INSTNUM);
+      #endif
+
         /* for all TxSPDO to be processed */
         for(w_spdoIdx = 0U; w_spdoIdx < w_noProcTxSpdo; w_spdoIdx++)
         {
@@ -250,12 +315,9 @@ void SPDO_BuildTxSpdo(BYTE_B_INSTNUM_ UINT32 dw_ct, UINT16 *pw_noFreeFrm)
         }
       #endif
 
-        /* for all TxSPDO to be processed */
-        for(w_spdoIdx = 0U; w_spdoIdx < w_noProcTxSpdo; w_spdoIdx++)
-        {
-          /* Check if Data only SPDO is to be sent */
-          SPDO_ProdSm(B_INSTNUM_ dw_ct, w_spdoIdx, pw_noFreeFrm);
-        }
+        /* Check if Data only SPDOs are to be sent, only the TxSPDOs with
+           new data or an expired refresh time are visited */
+        SPDO_ProdSmDue(B_INSTNUM_ dw_ct, w_noProcTxSpdo, pw_noFreeFrm);
       }
       /* no else : the SPDO is not active */
     }
@@ -308,6 +370,12 @@ UINT8 SPDO_BuildTxSpdoIx(BYTE_B_INSTNUM_ UINT32 dw_ct, UINT16 w_spdoIdx)
       /* if the SPDO is active */
       if (po_this->o_spdoRunning)
       {
+      #if ((SPDO_cfg_PROCESS_IMAGE == EPLS_k_ENABLE) && \
+           (SPDO_cfg_TX_DATA_CHANGE_TRACKING == EPLS_k_ENABLE))
+        /* Tx SPDOs with a changed image get new data */
+        SPDO_TakeTxImageChanges(B_INSTNUM);
+      #endif
+
         /* Check if Time Response SPDO is to be sent */
         SPDO_TimeSyncProdSm(B_INSTNUM_ dw_ct, w_spdoIdx,
                               (EPLS_t_FRM_HDR *)NULL, &w_noFreeFrm);
@@ -517,6 +585,10 @@ void SPDO_ProcessRxSpdo(BYTE_B_INSTNUM_ UINT32 dw_ct, UINT8 *pb_rxFrm,
 *
 * This Tx SPDO is immediately sent by the SPDO_BuildTxSpdo() before the refresh prescale timeout.
 *
+* If SPDO_cfg_TX_DATA_CHANGE_TRACKING is enabled, the call is not needed after the data was changed
+* by SOD_Write() or by the Tx image of the process image. Such writes signal the Tx SPDOs mapping the
+* changed data.
+*
 * @see          SPDO_BuildTxSpdo()
 *
 * @param        b_instNum          instance number (checked) valid range: 0..(EPLS_cfg_MAX_INSTANCES-1)
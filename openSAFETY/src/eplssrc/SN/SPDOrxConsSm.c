@@ -80,15 +80,72 @@ static UINT32 min_propdelay =40000;
 #endif /* (SPDO_cfg_40_BIT_CT_SUPPORT == EPLS_k_ENABLE) */
 
 /**
- * Object structure to control the Rx SPDO Consumer State Machine.
+ * Object structure to control the Rx SPDO Consumer State Machine, shared by all instances.
 */
-STATIC t_RX_CONS_SM as_ConsSm[EPLS_cfg_MAX_INSTANCES]
-                             [SPDO_cfg_MAX_NO_RX_SPDO] SAFE_NO_INIT_SEKTOR;
+STATIC t_RX_CONS_SM as_ConsSm[SPDO_SHARED_SIZE(SPDO_cfg_MAX_NO_RX_SPDO,
+                                               SPDO_cfg_MAX_NO_RX_SPDO_SDG)] SAFE_NO_INIT_SEKTOR;
+
+/**
+ * Pointer to the first Rx SPDO Consumer State Machine of each instance.
+*/
+STATIC t_RX_CONS_SM *aps_ConsSm[EPLS_cfg_MAX_INSTANCES] SAFE_NO_INIT_SEKTOR;
+
+/**
+ * Position of a Rx SPDO, which is not in the deadline heap.
+ */
+#define k_NOT_SCHEDULED 0xFFFFU
+
+/**
+ * Macro to decide whether a deadline is before another one.
+ *
+ * @param dwA deadline A
+ * @param dwB deadline B
+ *
+ * @return
+ * - TRUE  - deadline A is before deadline B
+ * - FALSE - deadline A is equal to or after deadline B
+*/
+#define DEADLINE_BEFORE(dwA,dwB) (((UINT32)((dwA)-(dwB))) >= 0x80000000UL)
+
+/**
+ * Deadline heap of the Rx SPDOs.
+ *
+ * Every Rx SPDO with a pending deadline, i.e. the SCT of a Rx SPDO which is not in the safe
+ * state or the timeout of the extended CT, is held in a binary min-heap ordered by
+ * t_RX_CONS_SM.dw_deadline. The deadline is updated at the end of every call of SPDO_ConsSm(),
+ * so SPDO_CheckRxTimeout() only has to look at the root of the heap.
+*/
+typedef struct
+{
+  /** number of Rx SPDOs in the heap */
+  UINT16 w_noEntries;
+  /** Rx SPDO indices, the first one has the earliest deadline, taken from aw_SctHeapIdx */
+  UINT16 *pw_rxSpdoIdx;
+} t_RX_SCT_HEAP;
+
+STATIC t_RX_SCT_HEAP as_SctHeap[EPLS_cfg_MAX_INSTANCES] SAFE_NO_INIT_SEKTOR;
+
+/**
+ * Rx SPDO indices of the deadline heaps of all instances.
+*/
+STATIC UINT16 aw_SctHeapIdx[SPDO_SHARED_SIZE(SPDO_cfg_MAX_NO_RX_SPDO,
+                                             SPDO_cfg_MAX_NO_RX_SPDO_SDG)] SAFE_NO_INIT_SEKTOR;
 
 
 STATIC void ProcessData(BYTE_B_INSTNUM_ UINT32 dw_ct, UINT16 w_rxSpdoIdx,
                         const EPLS_t_FRM_HDR *ps_rxSpdoHeader,
                         const UINT8 *pb_rxSpdoData);
+static void Schedule(BYTE_B_INSTNUM_ UINT16 w_rxSpdoIdx);
+#if (SPDO_cfg_CONNECTION_VALID_BIT_FIELD == EPLS_k_ENABLE)
+static void UpdateConnValidBit(BYTE_B_INSTNUM_ UINT16 w_rxSpdoIdx,
+                               const EPLS_t_FRM_HDR *ps_rxSpdoHeader,
+                               BOOLEAN o_timeSyncFailure);
+#endif
+#if ((SPDO_cfg_40_BIT_CT_SUPPORT == EPLS_k_ENABLE) && (SPDO_cfg_EXTENDED_CT_BIT_FIELD == EPLS_k_ENABLE))
+static void UpdateExtCtBit(BYTE_B_INSTNUM_ UINT16 w_rxSpdoIdx);
+#endif
+static void HeapSiftUp(BYTE_B_INSTNUM_ UINT16 w_pos);
+static void HeapSiftDown(BYTE_B_INSTNUM_ UINT16 w_pos);
 
 #if (SPDO_cfg_MAX_NO_RX_SPDO != 0)
 /**
@@ -105,7 +162,7 @@ STATIC void ProcessData(BYTE_B_INSTNUM_ UINT32 dw_ct, UINT16 w_rxSpdoIdx,
 BOOLEAN SPDO_ConsSmConnect(BYTE_B_INSTNUM_ UINT16 w_rxSpdoIdx)
 {
   /* pointer to the Consumer SM structure */
-  t_RX_CONS_SM *ps_consSm = &as_ConsSm[B_INSTNUMidx][w_rxSpdoIdx];
+  t_RX_CONS_SM *ps_consSm = &aps_ConsSm[B_INSTNUMidx][w_rxSpdoIdx];
   UINT16 w_TxSpdoIdx;
   BOOLEAN o_retVal = TRUE;
   /* index = number - 1 */
@@ -144,7 +201,7 @@ void SPDO_ConsSmInit(BYTE_B_INSTNUM_ UINT16 w_rxSpdoIdx, const UINT32 *pdw_sct,
                      UINT32 const * const pdw_safeReactionTime)
 {
   /* pointer to the Consumer SM structure */
-  t_RX_CONS_SM *ps_consSm = &as_ConsSm[B_INSTNUMidx][w_rxSpdoIdx];
+  t_RX_CONS_SM *ps_consSm = &aps_ConsSm[B_INSTNUMidx][w_rxSpdoIdx];
 
   ps_consSm->pdw_sct = pdw_sct;
   ps_consSm->pw_minSPDOPropDelay = pw_minSPDOPropDelay;
@@ -167,7 +224,7 @@ void SPDO_ConsSmInit(BYTE_B_INSTNUM_ UINT16 w_rxSpdoIdx, const UINT32 *pdw_sct,
 void SPDO_ConsSmResetRx(BYTE_B_INSTNUM_ UINT16 w_rxSpdoIdx)
 {
   /* pointer to the Consumer SM structure */
-  t_RX_CONS_SM *ps_consSm = &as_ConsSm[B_INSTNUMidx][w_rxSpdoIdx];
+  t_RX_CONS_SM *ps_consSm = &aps_ConsSm[B_INSTNUMidx][w_rxSpdoIdx];
 
   ps_consSm->o_safeState = TRUE;
 
@@ -187,8 +244,20 @@ void SPDO_ConsSmResetRx(BYTE_B_INSTNUM_ UINT16 w_rxSpdoIdx)
   ps_consSm->o_extCtUsed = FALSE;
   ps_consSm->o_extCtValid = FALSE;
   ps_consSm->o_extCtUnknown = TRUE;
+#if (SPDO_cfg_EXTENDED_CT_BIT_FIELD == EPLS_k_ENABLE)
+  /* reset the extended CT bit, SPDO_ConsSm() is not called until the next Rx SPDO */
+  UpdateExtCtBit(B_INSTNUM_ w_rxSpdoIdx);
+#endif /* (SPDO_cfg_EXTENDED_CT_BIT_FIELD == EPLS_k_ENABLE) */
 #endif /* (SPDO_cfg_40_BIT_CT_SUPPORT == EPLS_k_ENABLE) */
 
+#if (SPDO_cfg_CONNECTION_VALID_BIT_FIELD == EPLS_k_ENABLE)
+  /* reset the connection valid bit, for the same reason */
+  UpdateConnValidBit(B_INSTNUM_ w_rxSpdoIdx, (const EPLS_t_FRM_HDR *)NULL, FALSE);
+#endif
+
+  /* no deadline is pending in the safe state */
+  SPDO_ConsSmUnschedule(B_INSTNUM_ w_rxSpdoIdx);
+
   /* All references to the SOD entries are initialized once in
      SPDO_ConsSmInit(). These references do not have to be reset */
 
@@ -228,7 +297,7 @@ void SPDO_ConsSmTimeSyncSucceeded(BYTE_B_INSTNUM_ UINT16 w_rxSpdoIdx,
                                   UINT16 w_tPropDelay)
 {
   /* pointer to the Consumer SM structure */
-  t_RX_CONS_SM *ps_consSm = &as_ConsSm[B_INSTNUMidx][w_rxSpdoIdx];
+  t_RX_CONS_SM *ps_consSm = &aps_ConsSm[B_INSTNUMidx][w_rxSpdoIdx];
 
   /* TRefCons and TRefProd are stored */
   ps_consSm->w_tRefCons = w_tRefCons;
@@ -264,47 +333,17 @@ void SPDO_ConsSm(BYTE_B_INSTNUM_ UINT32 dw_ct, UINT16 w_rxSpdoIdx,
                  const UINT8 *pb_rxSpdoData, BOOLEAN o_timeSyncFailure)
 {
   /* pointer to the Consumer SM structure */
-  t_RX_CONS_SM *ps_consSm = &as_ConsSm[B_INSTNUMidx][w_rxSpdoIdx];
+  t_RX_CONS_SM *ps_consSm = &aps_ConsSm[B_INSTNUMidx][w_rxSpdoIdx];
+#if ((SPDO_cfg_CONNECTION_VALID_BIT_FIELD == EPLS_k_ENABLE) || \
+     ((SPDO_cfg_40_BIT_CT_SUPPORT == EPLS_k_ENABLE) && (SPDO_cfg_EXTENDED_CT_BIT_FIELD == EPLS_k_ENABLE)))
+  /* TRUE, if the state machine was in the safe state before */
+  BOOLEAN o_safeStateBefore = ps_consSm->o_safeState;
+#endif
 
 
 #if (SPDO_cfg_CONNECTION_VALID_BIT_FIELD == EPLS_k_ENABLE)
   /* the "connection valid" bit field is optional and not to be created on IO Modules */
-  if ((o_timeSyncFailure) ||
-    (ps_consSm->o_safeState))
-  {
-    #if (SPDO_cfg_CONNECTION_VALID_STATISTIC == EPLS_k_ENABLE)
-    /* increase the statistic counter in case a connection turns from valid to invalid */
-    if ( SHNF_aaulConnValidBit[B_INSTNUMidx][w_rxSpdoIdx / 32] & (0x00000001UL << (w_rxSpdoIdx % 32)))
-    {
-      SHNF_aaulConnValidStatistic[B_INSTNUMidx][w_rxSpdoIdx]++;
-    }
-    #endif
-    /* reset the connection valid bit */
-    SHNF_aaulConnValidBit[B_INSTNUMidx][w_rxSpdoIdx / 32] =
-    SHNF_aaulConnValidBit[B_INSTNUMidx][w_rxSpdoIdx / 32] & (~(0x00000001UL << (w_rxSpdoIdx % 32)));
-  }
-  else if ( NULL != ps_rxSpdoHeader)
-  {
-    if ( 0 == (ps_rxSpdoHeader->b_id & k_FRAME_BIT_CONN_VALID))
-    {
-      #if (SPDO_cfg_CONNECTION_VALID_STATISTIC == EPLS_k_ENABLE)
-      /* increase the statistic counter in case a connection turns from valid to invalid */
-      if ( SHNF_aaulConnValidBit[B_INSTNUMidx][w_rxSpdoIdx / 32] & (0x00000001UL << (w_rxSpdoIdx % 32)))
-      {
-        SHNF_aaulConnValidStatistic[B_INSTNUMidx][w_rxSpdoIdx]++;
-      }
-      #endif
-      /* reset the connection valid bit */
-      SHNF_aaulConnValidBit[B_INSTNUMidx][w_rxSpdoIdx / 32] =
-      SHNF_aaulConnValidBit[B_INSTNUMidx][w_rxSpdoIdx / 32] & (~(0x00000001UL << (w_rxSpdoIdx % 32)));
-    }
-    else
-    {
-      /* set the connection valid bit */
-      SHNF_aaulConnValidBit[B_INSTNUMidx][w_rxSpdoIdx / 32] =
-      SHNF_aaulConnValidBit[B_INSTNUMidx][w_rxSpdoIdx / 32] | (0x00000001UL << (w_rxSpdoIdx % 32));
-    }
-  }
+  UpdateConnValidBit(B_INSTNUM_ w_rxSpdoIdx, ps_rxSpdoHeader, o_timeSyncFailure);
 #endif
 #if (SPDO_cfg_40_BIT_CT_SUPPORT == EPLS_k_ENABLE)
   if ((NULL != ps_rxSpdoHeader) &&
@@ -333,17 +372,7 @@ void SPDO_ConsSm(BYTE_B_INSTNUM_ UINT32 dw_ct, UINT16 w_rxSpdoIdx,
   }
 #if (SPDO_cfg_EXTENDED_CT_BIT_FIELD == EPLS_k_ENABLE)
   /* handle the extended CT bit */
-  if ( ps_consSm->o_extCtUnknown ||
-      !ps_consSm->o_extCtUsed)
-  {
-    /* reset the extended CT bit */
-    SHNF_aaulExtCtBit[B_INSTNUMidx][w_rxSpdoIdx / 32] &= ~(0x00000001UL << (w_rxSpdoIdx % 32));
-  }
-  else
-  {
-    /* set the extended CT bit */
-    SHNF_aaulExtCtBit[B_INSTNUMidx][w_rxSpdoIdx / 32] |= (0x00000001UL << (w_rxSpdoIdx % 32));
-  }
+  UpdateExtCtBit(B_INSTNUM_ w_rxSpdoIdx);
 #endif /* (SPDO_cfg_EXTENDED_CT_BIT_FIELD == EPLS_k_ENABLE) */
 
   /* handling for SPDOs with 40 bit CT */
@@ -437,6 +466,25 @@ void SPDO_ConsSm(BYTE_B_INSTNUM_ UINT32 dw_ct, UINT16 w_rxSpdoIdx,
     }
   }
 
+  /* the next deadline of the Rx SPDO is updated */
+  Schedule(B_INSTNUM_ w_rxSpdoIdx);
+
+#if ((SPDO_cfg_CONNECTION_VALID_BIT_FIELD == EPLS_k_ENABLE) || \
+     ((SPDO_cfg_40_BIT_CT_SUPPORT == EPLS_k_ENABLE) && (SPDO_cfg_EXTENDED_CT_BIT_FIELD == EPLS_k_ENABLE)))
+  /* if the state machine entered the safe state, the bits are reset now. The Rx SPDO
+     is not checked in every cycle, so there may be no further call until the next Rx SPDO */
+  if ((!o_safeStateBefore) && (ps_consSm->o_safeState))
+  {
+#if (SPDO_cfg_CONNECTION_VALID_BIT_FIELD == EPLS_k_ENABLE)
+    UpdateConnValidBit(B_INSTNUM_ w_rxSpdoIdx, (const EPLS_t_FRM_HDR *)NULL, FALSE);
+#endif
+#if ((SPDO_cfg_40_BIT_CT_SUPPORT == EPLS_k_ENABLE) && (SPDO_cfg_EXTENDED_CT_BIT_FIELD == EPLS_k_ENABLE))
+    UpdateExtCtBit(B_INSTNUM_ w_rxSpdoIdx);
+#endif
+  }
+  /* no else : no change to the safe state */
+#endif
+
   /* call the Control Flow Monitoring */
   SCFM_TACK_PATH();
 }
@@ -458,7 +506,7 @@ BOOLEAN SPDO_CtValid(BYTE_B_INSTNUM_ UINT16 w_rxSpdoIdx, UINT16 w_rxSpdoCt)
 {
   BOOLEAN o_ret = FALSE; /* return value */
   /* pointer to the Consumer SM structure */
-  t_RX_CONS_SM *ps_consSm = &as_ConsSm[B_INSTNUMidx][w_rxSpdoIdx];
+  t_RX_CONS_SM *ps_consSm = &aps_ConsSm[B_INSTNUMidx][w_rxSpdoIdx];
 
   /* if CT has not to be checked or CT has changed and increased */
   if (!ps_consSm->o_lastValidRxSpdoCtChk ||
@@ -473,6 +521,138 @@ BOOLEAN SPDO_CtValid(BYTE_B_INSTNUM_ UINT16 w_rxSpdoIdx, UINT16 w_rxSpdoCt)
   return o_ret;
 }
 
+/**
+ * @brief This function initializes the SPDO Consumer State Machines of the instance and their deadline heap.
+ *
+ * The main instance gets the first SPDO_cfg_MAX_NO_RX_SPDO state machines, every other instance
+ * SPDO_cfg_MAX_NO_RX_SPDO_SDG state machines.
+ *
+ * @param        b_instNum          instance number (not checked, checked in SSC_InitAll()), valid range: 0..(EPLS_cfg_MAX_INSTANCES-1)
+ */
+void SPDO_InitRxCons(BYTE_B_INSTNUM)
+{
+  UINT32 dw_start = SPDO_SHARED_START(B_INSTNUMidx, SPDO_cfg_MAX_NO_RX_SPDO,
+                                      SPDO_cfg_MAX_NO_RX_SPDO_SDG); /* first entry of the instance */
+  UINT16 w_noRxSpdo = SPDO_SHARED_NUM(B_INSTNUMidx, SPDO_cfg_MAX_NO_RX_SPDO,
+                                      SPDO_cfg_MAX_NO_RX_SPDO_SDG); /* number of the Rx SPDOs */
+  UINT16 w_rxSpdoIdx; /* loop counter for the Rx SPDOs */
+
+  aps_ConsSm[B_INSTNUMidx] = &as_ConsSm[dw_start];
+  as_SctHeap[B_INSTNUMidx].pw_rxSpdoIdx = &aw_SctHeapIdx[dw_start];
+  as_SctHeap[B_INSTNUMidx].w_noEntries = 0U;
+
+  /* loop for all Rx SPDOs of the instance */
+  for (w_rxSpdoIdx = 0U; w_rxSpdoIdx < w_noRxSpdo; w_rxSpdoIdx++)
+  {
+    aps_ConsSm[B_INSTNUMidx][w_rxSpdoIdx].w_heapPos = k_NOT_SCHEDULED;
+  }
+
+  SCFM_TACK_PATH();
+}
+
+/**
+ * @brief This function returns the Rx SPDO with the earliest deadline, if the deadline elapsed.
+ *
+ * @param        b_instNum          instance number (not checked, checked in SPDO_CheckRxTimeout()), valid range: 0..(EPLS_cfg_MAX_INSTANCES-1)
+ *
+ * @param        dw_ct              consecutive time, internal timer value (not checked, any value allowed) valid range: (UINT32)
+ *
+ * @retval       pw_rxSpdoIdx       Rx SPDO index of the elapsed deadline (pointer not checked, only called with reference to variable) valid range: <> NULL
+ *
+ * @return
+ * - TRUE             - a deadline elapsed, the Rx SPDO is to be checked
+ * - FALSE            - no deadline elapsed
+ */
+BOOLEAN SPDO_ConsSmGetDue(BYTE_B_INSTNUM_ UINT32 dw_ct, UINT16 *pw_rxSpdoIdx)
+{
+  BOOLEAN o_ret = FALSE; /* return value */
+  const t_RX_SCT_HEAP *ps_heap = &as_SctHeap[B_INSTNUMidx];
+
+  /* if the earliest deadline elapsed */
+  if ((ps_heap->w_noEntries != 0U) &&
+      EPLS_TIMEOUT(dw_ct,
+          aps_ConsSm[B_INSTNUMidx][ps_heap->pw_rxSpdoIdx[0]].dw_deadline))
+  {
+    *pw_rxSpdoIdx = ps_heap->pw_rxSpdoIdx[0];
+    o_ret = TRUE;
+  }
+  /* no else : no deadline elapsed */
+
+  SCFM_TACK_PATH();
+  return o_ret;
+}
+
+/**
+ * @brief This function returns the earliest deadline of all Rx SPDOs.
+ *
+ * @param        b_instNum          instance number (not checked, checked in SPDO_GetNextRxTimeout()), valid range: 0..(EPLS_cfg_MAX_INSTANCES-1)
+ *
+ * @retval       pdw_deadline       consecutive time of the deadline (pointer not checked, checked in SPDO_GetNextRxTimeout()) valid range: <> NULL
+ *
+ * @return
+ * - TRUE             - a deadline is pending
+ * - FALSE            - no deadline is pending, all Rx SPDOs are in the safe state
+ */
+BOOLEAN SPDO_ConsSmNextDeadline(BYTE_B_INSTNUM_ UINT32 *pdw_deadline)
+{
+  BOOLEAN o_ret = FALSE; /* return value */
+  const t_RX_SCT_HEAP *ps_heap = &as_SctHeap[B_INSTNUMidx];
+
+  if (ps_heap->w_noEntries != 0U)
+  {
+    *pdw_deadline = aps_ConsSm[B_INSTNUMidx][ps_heap->pw_rxSpdoIdx[0]].dw_deadline;
+    o_ret = TRUE;
+  }
+  /* no else : no deadline is pending */
+
+  SCFM_TACK_PATH();
+  return o_ret;
+}
+
+/**
+ * @brief This function removes the deadline of a Rx SPDO.
+ *
+ * @param        b_instNum          instance number (not checked, checked in SPDO_CheckRxTimeout() or SSC_ProcessSNMTSSDOFrame() or SSC_InitAll()), valid range: 0..(EPLS_cfg_MAX_INSTANCES-1)
+ *
+ * @param        w_rxSpdoIdx        Rx SPDO index (not checked, returned by SPDO_ConsSmGetDue() or checked in SPDO_ConsSmResetRx()), valid range: 0..(SPDO_cfg_MAX_NO_RX_SPDO-1)
+ */
+void SPDO_ConsSmUnschedule(BYTE_B_INSTNUM_ UINT16 w_rxSpdoIdx)
+{
+  t_RX_SCT_HEAP *ps_heap = &as_SctHeap[B_INSTNUMidx];
+  t_RX_CONS_SM *ps_consSm = &aps_ConsSm[B_INSTNUMidx][w_rxSpdoIdx];
+  UINT16 w_pos = ps_consSm->w_heapPos; /* position of the removed Rx SPDO */
+  UINT16 w_lastIdx; /* Rx SPDO index of the last entry of the heap */
+
+  /* if the Rx SPDO is in the heap */
+  if (w_pos != k_NOT_SCHEDULED)
+  {
+    ps_consSm->w_heapPos = k_NOT_SCHEDULED;
+    ps_heap->w_noEntries--;
+
+    /* if the removed Rx SPDO was not the last entry, the last entry fills the gap */
+    if (w_pos != ps_heap->w_noEntries)
+    {
+      w_lastIdx = ps_heap->pw_rxSpdoIdx[ps_heap->w_noEntries];
+      ps_heap->pw_rxSpdoIdx[w_pos] = w_lastIdx;
+      aps_ConsSm[B_INSTNUMidx][w_lastIdx].w_heapPos = w_pos;
+
+      if (DEADLINE_BEFORE(aps_ConsSm[B_INSTNUMidx][w_lastIdx].dw_deadline,
+                          ps_consSm->dw_deadline))
+      {
+        HeapSiftUp(B_INSTNUM_ w_pos);
+      }
+      else
+      {
+        HeapSiftDown(B_INSTNUM_ w_pos);
+      }
+    }
+    /* no else : the last entry was removed */
+  }
+  /* no else : no deadline is pending */
+
+  SCFM_TACK_PATH();
+}
+
 #pragma CTC SKIP
 /**
 * @brief Returns a pointer to the internal object. This function is only called by the unit test.
@@ -494,11 +674,11 @@ const t_RX_CONS_SM* SPDO_GetRxConsSmObj(BYTE_B_INSTNUM_ UINT16 w_rxSpdoIdx)
     if(B_INSTNUMidx < (UINT8)EPLS_cfg_MAX_INSTANCES)
     {
       /* get pointer to object */
-      ps_obj = &as_ConsSm[B_INSTNUMidx][w_rxSpdoIdx];
+      ps_obj = &aps_ConsSm[B_INSTNUMidx][w_rxSpdoIdx];
     }
     /* else - do nothing */
   #else
-    ps_obj = &as_ConsSm[B_INSTNUMidx][w_rxSpdoIdx];
+    ps_obj = &aps_ConsSm[B_INSTNUMidx][w_rxSpdoIdx];
   #endif
 
   /* call the Control Flow Monitoring */
@@ -527,7 +707,7 @@ STATIC void ProcessData(BYTE_B_INSTNUM_ UINT32 dw_ct, UINT16 w_rxSpdoIdx,
                         const UINT8 *pb_rxSpdoData)
 {
   /* pointer to the Consumer SM structure */
-  t_RX_CONS_SM *ps_consSm = &as_ConsSm[B_INSTNUMidx][w_rxSpdoIdx];
+  t_RX_CONS_SM *ps_consSm = &aps_ConsSm[B_INSTNUMidx][w_rxSpdoIdx];
   UINT32 w_propDelay;  /* temporary variable for the propagation delay */
   UINT32 w_deltaTCons; /* temporary variable for delta T consumer */
   UINT32 w_deltaTProd; /* temporary variable for delta T producer */
@@ -755,7 +935,7 @@ BOOLEAN SPDO_GetRxSpdoStatus(BYTE_B_INSTNUM_ UINT16 const w_rxSpdoIdx, UINT32 co
 	else
 	{
         /* set the ptr to the SPDO instance */
-        ps_consSm = &as_ConsSm[B_INSTNUMidx][w_rxSpdoIdx];
+        ps_consSm = &aps_ConsSm[B_INSTNUMidx][w_rxSpdoIdx];
         /* check if process data is valid */
         if ((ps_consSm->o_timeSyncOk) &&
             (!ps_consSm->o_safeState))
@@ -772,6 +952,267 @@ BOOLEAN SPDO_GetRxSpdoStatus(BYTE_B_INSTNUM_ UINT16 const w_rxSpdoIdx, UINT32 co
 	return bRetVal;
 }
 
+#if (SPDO_cfg_CONNECTION_VALID_BIT_FIELD == EPLS_k_ENABLE)
+/**
+* @brief This function updates the "connection valid" bit of a Rx SPDO.
+*
+* The bit is reset on a time synchronization failure and in the safe state, otherwise it is taken from the
+* received Rx SPDO. A bit turning from valid to invalid is counted, if SPDO_cfg_CONNECTION_VALID_STATISTIC
+* is enabled.
+*
+* @param        b_instNum              instance number (not checked, checked in SPDO_ConsSm() or SPDO_ConsSmResetRx()), valid range: 0..(EPLS_cfg_MAX_INSTANCES-1)
+*
+* @param        w_rxSpdoIdx            Rx SPDO index (not checked, checked in SPDO_ConsSm() or SPDO_ConsSmResetRx()), valid range: 0..(SPDO_cfg_MAX_NO_RX_SPDO-1)
+*
+* @param        ps_rxSpdoHeader        reference to RxSPDO header info (pointer checked) valid range: <> NULL, == NULL
+*
+* @param        o_timeSyncFailure      TRUE : time synchronization failure FALSE : no time synchronization failure (checked) valid range: TRUE,FALSE
+*/
+static void UpdateConnValidBit(BYTE_B_INSTNUM_ UINT16 w_rxSpdoIdx,
+                               const EPLS_t_FRM_HDR *ps_rxSpdoHeader,
+                               BOOLEAN o_timeSyncFailure)
+{
+  /* pointer to the Consumer SM structure */
+  const t_RX_CONS_SM *ps_consSm = &aps_ConsSm[B_INSTNUMidx][w_rxSpdoIdx];
+
+  if ((o_timeSyncFailure) ||
+    (ps_consSm->o_safeState))
+  {
+    #if (SPDO_cfg_CONNECTION_VALID_STATISTIC == EPLS_k_ENABLE)
+    /* increase the statistic counter in case a connection turns from valid to invalid */
+    if ( SHNF_aaulConnValidBit[B_INSTNUMidx][w_rxSpdoIdx / 32] & (0x00000001UL << (w_rxSpdoIdx % 32)))
+    {
+      SHNF_aaulConnValidStatistic[B_INSTNUMidx][w_rxSpdoIdx]++;
+    }
+    #endif
+    /* reset the connection valid bit */
+    SHNF_aaulConnValidBit[B_INSTNUMidx][w_rxSpdoIdx / 32] =
+    SHNF_aaulConnValidBit[B_INSTNUMidx][w_rxSpdoIdx / 32] & (~(0x00000001UL << (w_rxSpdoIdx % 32)));
+  }
+  else if ( NULL != ps_rxSpdoHeader)
+  {
+    if ( 0 == (ps_rxSpdoHeader->b_id & k_FRAME_BIT_CONN_VALID))
+    {
+      #if (SPDO_cfg_CONNECTION_VALID_STATISTIC == EPLS_k_ENABLE)
+      /* increase the statistic counter in case a connection turns from valid to invalid */
+      if ( SHNF_aaulConnValidBit[B_INSTNUMidx][w_rxSpdoIdx / 32] & (0x00000001UL << (w_rxSpdoIdx % 32)))
+      {
+        SHNF_aaulConnValidStatistic[B_INSTNUMidx][w_rxSpdoIdx]++;
+      }
+      #endif
+      /* reset the connection valid bit */
+      SHNF_aaulConnValidBit[B_INSTNUMidx][w_rxSpdoIdx / 32] =
+      SHNF_aaulConnValidBit[B_INSTNUMidx][w_rxSpdoIdx / 32] & (~(0x00000001UL << (w_rxSpdoIdx % 32)));
+    }
+    else
+    {
+      /* set the connection valid bit */
+      SHNF_aaulConnValidBit[B_INSTNUMidx][w_rxSpdoIdx / 32] =
+      SHNF_aaulConnValidBit[B_INSTNUMidx][w_rxSpdoIdx / 32] | (0x00000001UL << (w_rxSpdoIdx % 32));
+    }
+  }
+
+  SCFM_TACK_PATH();
+}
+#endif
+
+#if ((SPDO_cfg_40_BIT_CT_SUPPORT == EPLS_k_ENABLE) && (SPDO_cfg_EXTENDED_CT_BIT_FIELD == EPLS_k_ENABLE))
+/**
+* @brief This function updates the extended CT bit of a Rx SPDO. The bit is set, if the extended CT is known
+* to be used.
+*
+* @param        b_instNum              instance number (not checked, checked in SPDO_ConsSm() or SPDO_ConsSmResetRx()), valid range: 0..(EPLS_cfg_MAX_INSTANCES-1)
+*
+* @param        w_rxSpdoIdx            Rx SPDO index (not checked, checked in SPDO_ConsSm() or SPDO_ConsSmResetRx()), valid range: 0..(SPDO_cfg_MAX_NO_RX_SPDO-1)
+*/
+static void UpdateExtCtBit(BYTE_B_INSTNUM_ UINT16 w_rxSpdoIdx)
+{
+  /* pointer to the Consumer SM structure */
+  const t_RX_CONS_SM *ps_consSm = &aps_ConsSm[B_INSTNUMidx][w_rxSpdoIdx];
+
+  if ( ps_consSm->o_extCtUnknown ||
+      !ps_consSm->o_extCtUsed)
+  {
+    /* reset the extended CT bit */
+    SHNF_aaulExtCtBit[B_INSTNUMidx][w_rxSpdoIdx / 32] &= ~(0x00000001UL << (w_rxSpdoIdx % 32));
+  }
+  else
+  {
+    /* set the extended CT bit */
+    SHNF_aaulExtCtBit[B_INSTNUMidx][w_rxSpdoIdx / 32] |= (0x00000001UL << (w_rxSpdoIdx % 32));
+  }
+
+  SCFM_TACK_PATH();
+}
+#endif
+
+/**
+* @brief This function updates the deadline of a Rx SPDO in the deadline heap.
+*
+* The SCT is pending, if the Rx SPDO is not in the safe state. The timeout of the extended CT is pending,
+* if the extended CT is used and valid. The earlier one is the deadline, the Rx SPDO is removed from the heap
+* if neither is pending.
+*
+* @param        b_instNum              instance number (not checked, checked in SPDO_CheckRxTimeout() or SPDO_BuildTxSpdo() and SPDO_ProcessRxSpdo()), valid range: 0..(EPLS_cfg_MAX_INSTANCES-1)
+*
+* @param        w_rxSpdoIdx            Rx SPDO index (not checked, checked in SPDO_ConsSm()), valid range: 0..(SPDO_cfg_MAX_NO_RX_SPDO-1)
+*/
+static void Schedule(BYTE_B_INSTNUM_ UINT16 w_rxSpdoIdx)
+{
+  t_RX_SCT_HEAP *ps_heap = &as_SctHeap[B_INSTNUMidx];
+  t_RX_CONS_SM *ps_consSm = &aps_ConsSm[B_INSTNUMidx][w_rxSpdoIdx];
+  BOOLEAN o_pending = FALSE; /* TRUE if a deadline is pending */
+  UINT32 dw_deadline = 0UL; /* next deadline */
+  UINT32 dw_oldDeadline = ps_consSm->dw_deadline; /* deadline in the heap */
+#if (SPDO_cfg_40_BIT_CT_SUPPORT == EPLS_k_ENABLE)
+  UINT32 dw_extCtDeadline; /* timeout of the extended CT */
+#endif /* (SPDO_cfg_40_BIT_CT_SUPPORT == EPLS_k_ENABLE) */
+
+  /* if the SCT is running */
+  if (!ps_consSm->o_safeState)
+  {
+    dw_deadline = ps_consSm->dw_sct;
+    o_pending = TRUE;
+  }
+  /* no else : no SCT in the safe state */
+
+#if (SPDO_cfg_40_BIT_CT_SUPPORT == EPLS_k_ENABLE)
+  /* if the timeout of the extended CT is running */
+  if (ps_consSm->o_extCtUsed && ps_consSm->o_extCtValid)
+  {
+    dw_extCtDeadline = ps_consSm->dw_extCtLastReceived + SPDO_k_EXT_CT_MAX_TIMEOUT;
+    if (!o_pending || DEADLINE_BEFORE(dw_extCtDeadline, dw_deadline))
+    {
+      dw_deadline = dw_extCtDeadline;
+    }
+    o_pending = TRUE;
+  }
+  /* no else : no timeout of the extended CT */
+#endif /* (SPDO_cfg_40_BIT_CT_SUPPORT == EPLS_k_ENABLE) */
+
+  /* if no deadline is pending */
+  if (!o_pending)
+  {
+    SPDO_ConsSmUnschedule(B_INSTNUM_ w_rxSpdoIdx);
+  }
+  /* else if the Rx SPDO is not in the heap */
+  else if (ps_consSm->w_heapPos == k_NOT_SCHEDULED)
+  {
+    ps_consSm->dw_deadline = dw_deadline;
+    ps_consSm->w_heapPos = ps_heap->w_noEntries;
+    ps_heap->pw_rxSpdoIdx[ps_heap->w_noEntries] = w_rxSpdoIdx;
+    ps_heap->w_noEntries++;
+    HeapSiftUp(B_INSTNUM_ ps_consSm->w_heapPos);
+  }
+  /* else the deadline in the heap is updated */
+  else
+  {
+    ps_consSm->dw_deadline = dw_deadline;
+    if (DEADLINE_BEFORE(dw_deadline, dw_oldDeadline))
+    {
+      HeapSiftUp(B_INSTNUM_ ps_consSm->w_heapPos);
+    }
+    else
+    {
+      HeapSiftDown(B_INSTNUM_ ps_consSm->w_heapPos);
+    }
+  }
+
+  SCFM_TACK_PATH();
+}
+
+/**
+* @brief This function moves an entry of the deadline heap towards the root, until its parent has an earlier
+* deadline.
+*
+* @param        b_instNum              instance number (not checked, checked in SPDO_ConsSm()), valid range: 0..(EPLS_cfg_MAX_INSTANCES-1)
+*
+* @param        w_pos                  position of the entry (not checked, only called with valid position), valid range: 0..(w_noEntries-1)
+*/
+static void HeapSiftUp(BYTE_B_INSTNUM_ UINT16 w_pos)
+{
+  t_RX_SCT_HEAP *ps_heap = &as_SctHeap[B_INSTNUMidx];
+  UINT16 w_rxSpdoIdx = ps_heap->pw_rxSpdoIdx[w_pos]; /* Rx SPDO index of the entry */
+  UINT32 dw_deadline = aps_ConsSm[B_INSTNUMidx][w_rxSpdoIdx].dw_deadline;
+  UINT16 w_parent; /* position of the parent */
+  BOOLEAN o_done = FALSE; /* TRUE if the position is found */
+
+  while ((w_pos > 0U) && !o_done)
+  {
+    w_parent = (UINT16)((w_pos - 1U) / 2U);
+    /* if the entry is due before its parent, the parent moves down */
+    if (DEADLINE_BEFORE(dw_deadline, aps_ConsSm[B_INSTNUMidx]
+                        [ps_heap->pw_rxSpdoIdx[w_parent]].dw_deadline))
+    {
+      ps_heap->pw_rxSpdoIdx[w_pos] = ps_heap->pw_rxSpdoIdx[w_parent];
+      aps_ConsSm[B_INSTNUMidx][ps_heap->pw_rxSpdoIdx[w_pos]].w_heapPos = w_pos;
+      w_pos = w_parent;
+    }
+    else
+    {
+      o_done = TRUE;
+    }
+  }
+
+  ps_heap->pw_rxSpdoIdx[w_pos] = w_rxSpdoIdx;
+  aps_ConsSm[B_INSTNUMidx][w_rxSpdoIdx].w_heapPos = w_pos;
+}
+
+/**
+* @brief This function moves an entry of the deadline heap towards the leaves, until its children have later
+* deadlines.
+*
+* @param        b_instNum              instance number (not checked, checked in SPDO_ConsSm()), valid range: 0..(EPLS_cfg_MAX_INSTANCES-1)
+*
+* @param        w_pos                  position of the entry (not checked, only called with valid position), valid range: 0..(w_noEntries-1)
+*/
+static void HeapSiftDown(BYTE_B_INSTNUM_ UINT16 w_pos)
+{
+  t_RX_SCT_HEAP *ps_heap = &as_SctHeap[B_INSTNUMidx];
+  UINT16 w_rxSpdoIdx = ps_heap->pw_rxSpdoIdx[w_pos]; /* Rx SPDO index of the entry */
+  UINT32 dw_deadline = aps_ConsSm[B_INSTNUMidx][w_rxSpdoIdx].dw_deadline;
+  UINT32 dw_child; /* position of the child with the earlier deadline */
+  BOOLEAN o_done = FALSE; /* TRUE if the position is found */
+
+  while (!o_done)
+  {
+    dw_child = (2UL * w_pos) + 1UL;
+    /* if the entry has no child */
+    if (dw_child >= ps_heap->w_noEntries)
+    {
+      o_done = TRUE;
+    }
+    else
+    {
+      /* if the right child is due before the left one */
+      if (((dw_child + 1UL) < ps_heap->w_noEntries) &&
+          DEADLINE_BEFORE(
+            aps_ConsSm[B_INSTNUMidx][ps_heap->pw_rxSpdoIdx[dw_child + 1UL]].dw_deadline,
+            aps_ConsSm[B_INSTNUMidx][ps_heap->pw_rxSpdoIdx[dw_child]].dw_deadline))
+      {
+        dw_child++;
+      }
+
+      /* if the child is due before the entry, the child moves up */
+      if (DEADLINE_BEFORE(
+            aps_ConsSm[B_INSTNUMidx][ps_heap->pw_rxSpdoIdx[dw_child]].dw_deadline,
+            dw_deadline))
+      {
+        ps_heap->pw_rxSpdoIdx[w_pos] = ps_heap->pw_rxSpdoIdx[dw_child];
+        aps_ConsSm[B_INSTNUMidx][ps_heap->pw_rxSpdoIdx[w_pos]].w_heapPos = w_pos;
+        w_pos = (UINT16)dw_child;
+      }
+      else
+      {
+        o_done = TRUE;
+      }
+    }
+  }
+
+  ps_heap->pw_rxSpdoIdx[w_pos] = w_rxSpdoIdx;
+  aps_ConsSm[B_INSTNUMidx][w_rxSpdoIdx].w_heapPos = w_pos;
+}
+
 #else
   /* This file is compiled with different configuration (EPLScfg.h).
      If SPDO_cfg_MAX_NO_RX_SPDO is 0 then a compiler warning can be generated.
@@ -119,18 +119,42 @@
     t_MAPP_OBJ *po_this = &as_Obj[B_INSTNUMidx]; /* instance pointer */
     t_MAPP_PARAM *ps_rxSpdo = po_this->ps_mappPara + w_rxSpdoIdx; /* pointer to
                                               the Rx SPDO internal structure */
+    const t_MAPP_RUN *ps_run; /* pointer to a run of the mapping */
     UINT32 i; /* loop counter */
+#if (ENDIAN == BIG)
+    UINT32 j; /* loop counter */
+#endif
 
     /* if payload size is right */
     if (ps_rxSpdo->b_lenOfSpdo == b_payloadSize)
     {
       o_ret = TRUE;
-      /* loop from 0 to length of the SPDO */
-      for (i = 0U; i < ps_rxSpdo->b_lenOfSpdo; i++)
+      /* loop for all runs of the mapping */
+      for (i = 0U; i < ps_rxSpdo->b_noRun; i++)
       {
-        /* copy one Byte from the SPDO into the SOD */
-        *(ps_rxSpdo->apb_DataForSpdo[i]) = *ADD_OFFSET(pv_data,i);
+        ps_run = &ps_rxSpdo->as_run[i];
+#if (ENDIAN == BIG)
+        /* if the object is stored in reversed order */
+        if (ps_run->o_swap)
+        {
+          for (j = 0U; j < ps_run->b_len; j++)
+          {
+            *ADD_OFFSET(ps_run->pb_data, ps_run->b_len - j - 1U) =
+                *ADD_OFFSET(pv_data, ps_run->b_spdoOfs + j);
+          }
+        }
+        else
+#endif
+        {
+          /* copy the run from the SPDO into the SOD */
+          MEMCOPY(ps_run->pb_data, ADD_OFFSET(pv_data, ps_run->b_spdoOfs),
+                  ps_run->b_len);
+        }
       }
+#if (SPDO_cfg_PROCESS_IMAGE == EPLS_k_ENABLE)
+      /* the received data is published to the application */
+      SHNF_PublishRxImage(B_INSTNUM_ w_rxSpdoIdx, pv_data, b_payloadSize);
+#endif
     }
     /* else wrong payload size */
     else
@@ -160,6 +184,14 @@
     t_MAPP_PARAM *ps_rxSpdo = po_this->ps_mappPara + w_rxSpdoIdx; /* pointer to
                                               the Rx SPDO internal structure */
     UINT32 i; /* loop counter */
+#if (SPDO_cfg_PROCESS_IMAGE == EPLS_k_ENABLE)
+    UINT8 ab_image[SPDO_cfg_MAX_LEN_OF_SPDO]; /* default values in the layout
+                                                 of the SPDO */
+    const t_MAPP_RUN *ps_run; /* pointer to a run of the mapping */
+#if (ENDIAN == BIG)
+    UINT32 j; /* loop counter */
+#endif
+#endif
 
     /* loop from 0 to number of mapped objects */
     for (i=0U; i < ps_rxSpdo->b_noMappedObject; i++)
@@ -170,6 +202,33 @@
              ps_rxSpdo->as_mappedObject[i].b_dataLen);
     }
 
+#if (SPDO_cfg_PROCESS_IMAGE == EPLS_k_ENABLE)
+    /* loop for all runs of the mapping */
+    for (i = 0U; i < ps_rxSpdo->b_noRun; i++)
+    {
+      ps_run = &ps_rxSpdo->as_run[i];
+#if (ENDIAN == BIG)
+      /* if the object is stored in reversed order */
+      if (ps_run->o_swap)
+      {
+        for (j = 0U; j < ps_run->b_len; j++)
+        {
+          ab_image[ps_run->b_spdoOfs + j] =
+              *ADD_OFFSET(ps_run->pb_data, ps_run->b_len - j - 1U);
+        }
+      }
+      else
+#endif
+      {
+        /* copy the run from the SOD into the image */
+        MEMCOPY(&ab_image[ps_run->b_spdoOfs], ps_run->pb_data, ps_run->b_len);
+      }
+    }
+    /* the default values are published to the application */
+    SHNF_PublishRxImage(B_INSTNUM_ w_rxSpdoIdx, ab_image,
+                        ps_rxSpdo->b_lenOfSpdo);
+#endif
+
 #if (SPDO_cfg_CONNECTION_VALID_BIT_FIELD == EPLS_k_ENABLE)
     #if (SPDO_cfg_CONNECTION_VALID_STATISTIC == EPLS_k_ENABLE)
       /* increase the statistic counter in case a connection turns from valid to invalid */
@@ -62,11 +62,33 @@
 #define k_SIDX_NO_TRES          3U
 /** @} */
 
+/**
+ * @name Bit sets of the Tx SPDOs
+ * @{
+ */
+/** word of a Tx SPDO in a bit set */
+#define SET_WORD(w_txSpdoIdx)   ((w_txSpdoIdx) / 32U)
+/** bit of a Tx SPDO in its word of a bit set */
+#define SET_BIT(w_txSpdoIdx)    (0x00000001UL << ((w_txSpdoIdx) % 32U))
+/** @} */
+
+/**
+ * Macro to compare two timeouts, TRUE if timeout a expires before timeout b. Both are
+ * expected within 2^31 ticks of each other.
+ */
+#define TIMEOUT_BEFORE(a, b)    (((UINT32)((a) - (b))) >= 0x80000000UL)
+
 /**
  * State machine instances
  */
 STATIC t_TXSM_OBJ as_Obj[EPLS_cfg_MAX_INSTANCES] SAFE_NO_INIT_SEKTOR;
 
+/**
+ * Tx SPDO structures of all instances
+ */
+STATIC t_TX_SPDO as_TxSpdo[SPDO_SHARED_SIZE(SPDO_cfg_MAX_NO_TX_SPDO,
+                                            SPDO_cfg_MAX_NO_TX_SPDO_SDG)] SAFE_NO_INIT_SEKTOR;
+
 
 STATIC BOOLEAN SendTxSpdo(BYTE_B_INSTNUM_ UINT32 dw_ct, UINT16 w_txSpdoIdx,
                           UINT8 b_spdoId, UINT8 b_tr, UINT16 w_tAdr,
@@ -75,6 +97,11 @@ STATIC BOOLEAN SendTxSpdo(BYTE_B_INSTNUM_ UINT32 dw_ct, UINT16 w_txSpdoIdx,
 static BOOLEAN SetPtrToTxCommPara(BYTE_B_INSTNUM_ UINT16 w_index,
                                   UINT8 b_subIdx, void **ppv_internPointerAdr);
 
+static void CheckRefresh(BYTE_B_INSTNUM_ UINT32 dw_ct, UINT16 w_noTxSpdo);
+static void ReleaseDue(BYTE_B_INSTNUM_ UINT32 dw_ct, UINT16 w_txSpdoIdx);
+static void AddRefresh(t_TXSM_OBJ *po_this, UINT32 dw_timeout);
+static UINT8 LowestBit(UINT32 dw_bits);
+
 #if (SPDO_cfg_40_BIT_CT_SUPPORT == EPLS_k_ENABLE)
   STATIC BOOLEAN GetExtCtAllowed(BYTE_B_INSTNUM_ UINT16 const w_txSpdoIdx);
 #endif
@@ -90,7 +117,7 @@ static BOOLEAN SetPtrToTxCommPara(BYTE_B_INSTNUM_ UINT16 w_index,
    */
 void SPDO_ClearConnectedRxSpdo(BYTE_B_INSTNUM_ UINT16 const w_txSpdoIdx)
 {
-  t_VARIABLE_FOR_TX_SPDO  *po_this = &as_Obj[B_INSTNUMidx].as_txSpdo[w_txSpdoIdx].s_txVar;
+  t_VARIABLE_FOR_TX_SPDO  *po_this = &as_Obj[B_INSTNUMidx].ps_txSpdo[w_txSpdoIdx].s_txVar;
   (void)MEMSET((void*)&po_this->aps_consSm[0],0,sizeof(po_this->aps_consSm));
 }
 
@@ -107,7 +134,7 @@ void SPDO_ClearConnectedRxSpdo(BYTE_B_INSTNUM_ UINT16 const w_txSpdoIdx)
  */
 BOOLEAN SPDO_SyncOkConnect(BYTE_B_INSTNUM_ UINT16 const w_txSpdoIdx, t_RX_CONS_SM const * const ps_consSm)
 {
-  t_VARIABLE_FOR_TX_SPDO  *po_this = &as_Obj[B_INSTNUMidx].as_txSpdo[w_txSpdoIdx].s_txVar;
+  t_VARIABLE_FOR_TX_SPDO  *po_this = &as_Obj[B_INSTNUMidx].ps_txSpdo[w_txSpdoIdx].s_txVar;
   BOOLEAN         o_retVal = FALSE;
 #if (1 < SPDO_cfg_MAX_SYNC_RX_SPDO)
   UINT16          i;
@@ -151,12 +178,22 @@ void SPDO_InitTxSm(BYTE_B_INSTNUM)
   t_TXSM_OBJ *po_this = &as_Obj[B_INSTNUMidx]; /* instance pointer */
   UINT32 i; /* loop counter */
 
-  for(i = 0U; i < (UINT32)SPDO_cfg_MAX_NO_TX_SPDO; i++)
+  /* the main instance gets SPDO_cfg_MAX_NO_TX_SPDO Tx SPDOs, the others SPDO_cfg_MAX_NO_TX_SPDO_SDG */
+  po_this->ps_txSpdo = &as_TxSpdo[SPDO_SHARED_START(B_INSTNUMidx, SPDO_cfg_MAX_NO_TX_SPDO,
+                                                    SPDO_cfg_MAX_NO_TX_SPDO_SDG)];
+
+  for(i = 0U; i < (UINT32)SPDO_SHARED_NUM(B_INSTNUMidx, SPDO_cfg_MAX_NO_TX_SPDO,
+                                          SPDO_cfg_MAX_NO_TX_SPDO_SDG); i++)
   {
-    po_this->as_txSpdo[i].s_txCommPara.pw_sadr = ((UINT16 *)(NULL));
-    po_this->as_txSpdo[i].s_txCommPara.pw_refreshPrescale = ((UINT16 *)(NULL));
+    po_this->ps_txSpdo[i].s_txCommPara.pw_sadr = ((UINT16 *)(NULL));
+    po_this->ps_txSpdo[i].s_txCommPara.pw_refreshPrescale = ((UINT16 *)(NULL));
   }
 
+  (void)MEMSET((void *)po_this->adw_newData, 0, sizeof(po_this->adw_newData));
+  (void)MEMSET((void *)po_this->adw_due, 0, sizeof(po_this->adw_due));
+  po_this->dw_nextRefresh = 0UL;
+  po_this->o_refreshValid = FALSE;
+
   /* call the Control Flow Monitoring */
   SCFM_TACK_PATH();
 }
@@ -184,7 +221,7 @@ BOOLEAN SPDO_SetPtrToTxCommPara(BYTE_B_INSTNUM_ UINT16 w_txSpdoIdx,
   void *pv_noTres = NULL;
 
   /* pointer to the Tx communication parameter */
-  t_TX_COMM_PARAM *ps_txComm = &po_this->as_txSpdo[w_txSpdoIdx].s_txCommPara;
+  t_TX_COMM_PARAM *ps_txComm = &po_this->ps_txSpdo[w_txSpdoIdx].s_txCommPara;
 
   /* if SADR : 0x1C00-0x1FFE sub 1 is OK */
   if (SetPtrToTxCommPara(B_INSTNUM_ w_index, k_SIDX_TX_SADR,
@@ -225,10 +262,15 @@ void SPDO_ResetTxSm(BYTE_B_INSTNUM_ UINT32 dw_ct, UINT16 w_noTxSpdo)
   t_TX_SPDO *ps_txSpdo; /* pointer to the Tx SPDO internal structure */
   UINT16 w_txSpdoIdx; /* loop counter */
 
+  (void)MEMSET((void *)po_this->adw_newData, 0, sizeof(po_this->adw_newData));
+  (void)MEMSET((void *)po_this->adw_due, 0, sizeof(po_this->adw_due));
+  /* the refresh times are checked with the next SPDO_ProdSmDue() */
+  po_this->o_refreshValid = FALSE;
+
   /* loop for all tx SPDO state machine */
   for(w_txSpdoIdx = 0U; w_txSpdoIdx < w_noTxSpdo; w_txSpdoIdx++)
   {
-    ps_txSpdo = &po_this->as_txSpdo[w_txSpdoIdx];
+    ps_txSpdo = &po_this->ps_txSpdo[w_txSpdoIdx];
 
 #if ( SPDO_cfg_IMMEDIATE_DATA_ONLY_AFTER_TSYNC == EPLS_k_DISABLE )
     ps_txSpdo->s_txVar.e_sendingReqType = k_SENDING_FREE;
@@ -237,7 +279,7 @@ void SPDO_ResetTxSm(BYTE_B_INSTNUM_ UINT32 dw_ct, UINT16 w_noTxSpdo)
    /* s_txVar is initialized */
     ps_txSpdo->s_txVar.dw_timeoutDT = dw_ct; /* timeout is set to expired for
                                                 the first time */
-    ps_txSpdo->s_txVar.o_newData = TRUE;
+    SPDO_MarkTxData(B_INSTNUM_ w_txSpdoIdx);
 
     ps_txSpdo->s_txVar.o_lastCtChk = FALSE;
     ps_txSpdo->s_txVar.dw_lastCt = 0UL;
@@ -265,7 +307,7 @@ BOOLEAN SPDO_CheckTxCommPara(BYTE_B_INSTNUM_ UINT16 w_txSpdoIdx)
   BOOLEAN o_ret = FALSE; /* return value */
   t_TXSM_OBJ *po_this = &as_Obj[B_INSTNUMidx]; /* instance pointer */
   /* pointer to the Tx communication parameter */
-  t_TX_COMM_PARAM *ps_txComm = &po_this->as_txSpdo[w_txSpdoIdx].s_txCommPara;
+  t_TX_COMM_PARAM *ps_txComm = &po_this->ps_txSpdo[w_txSpdoIdx].s_txCommPara;
 
   /* if target address was inserted successful */
   if (SPDO_AddTAdr(B_INSTNUM_ w_txSpdoIdx, *ps_txComm->pw_sadr))
@@ -302,7 +344,7 @@ void SPDO_ProdSm(BYTE_B_INSTNUM_ UINT32 dw_ct, UINT16 w_txSpdoIdx,
   t_TXSM_OBJ *po_this = &as_Obj[B_INSTNUMidx]; /* instance pointer */
 
   /* if Tx SPDO is active */
-  if (*po_this->as_txSpdo[w_txSpdoIdx].s_txCommPara.pw_sadr != k_NOT_USED_ADR)
+  if (*po_this->ps_txSpdo[w_txSpdoIdx].s_txCommPara.pw_sadr != k_NOT_USED_ADR)
   {
     /* if the Data only sending request was accomplished */
     if (SPDO_SendTxSpdo(B_INSTNUM_ dw_ct, w_txSpdoIdx, k_SENDING_DATA_ONLY,
@@ -350,7 +392,7 @@ BOOLEAN SPDO_SendTxSpdo(BYTE_B_INSTNUM_  UINT32 dw_ct, UINT16 w_txSpdoIdx,
 {
   BOOLEAN o_ret = FALSE; /* return value */
   t_TXSM_OBJ *po_this = &as_Obj[B_INSTNUMidx]; /* instance pointer */
-  t_TX_SPDO *ps_txSpdo = &po_this->as_txSpdo[w_txSpdoIdx]; /* pointer to
+  t_TX_SPDO *ps_txSpdo = &po_this->ps_txSpdo[w_txSpdoIdx]; /* pointer to
                                               the Tx SPDO internal structure */
   t_VARIABLE_FOR_TX_SPDO *ps_txVar = &ps_txSpdo->s_txVar;
 
@@ -387,7 +429,8 @@ BOOLEAN SPDO_SendTxSpdo(BYTE_B_INSTNUM_  UINT32 dw_ct, UINT16 w_txSpdoIdx,
             {
               /* if Tx SPDO refresh time expired or new data is available */
               if ((EPLS_TIMEOUT(dw_ct, ps_txVar->dw_timeoutDT)) ||
-                  (ps_txVar->o_newData))
+                  ((po_this->adw_newData[SET_WORD(w_txSpdoIdx)] &
+                    SET_BIT(w_txSpdoIdx)) != 0UL))
               {
                 /* if TRequest transmission is requested */
                 if (e_sendingReqType == k_SENDING_TREQ)
@@ -430,7 +473,10 @@ BOOLEAN SPDO_SendTxSpdo(BYTE_B_INSTNUM_  UINT32 dw_ct, UINT16 w_txSpdoIdx,
               /* Tx Ct is stored */
               ps_txVar->dw_lastCt = dw_ct;
               /* new data flag is cleared */
-              ps_txVar->o_newData = FALSE;
+              po_this->adw_newData[SET_WORD(w_txSpdoIdx)] &= ~SET_BIT(w_txSpdoIdx);
+              /* the Tx SPDO is visited by the next SPDO_ProdSmDue(), to release
+                 the sending request and to take the new refresh time */
+              po_this->adw_due[SET_WORD(w_txSpdoIdx)] |= SET_BIT(w_txSpdoIdx);
               /* memorize that the first SPDO was sent and the dw_lastCt
                  has to be checked */
               ps_txVar->o_lastCtChk = TRUE;
@@ -494,10 +540,10 @@ BOOLEAN SPDO_TxSpdoIdxExists(BYTE_B_INSTNUM_ UINT16 w_txSpdoIdx)
   if (w_txSpdoIdx < (UINT16)SPDO_cfg_MAX_NO_TX_SPDO)
   {
     /* if the Tx SPDO is defined */
-    if (po_this->as_txSpdo[w_txSpdoIdx].s_txCommPara.pw_sadr != NULL)
+    if (po_this->ps_txSpdo[w_txSpdoIdx].s_txCommPara.pw_sadr != NULL)
     {
       /* if the Tx SPDO is configured */
-      if (*po_this->as_txSpdo[w_txSpdoIdx].s_txCommPara.pw_sadr !=
+      if (*po_this->ps_txSpdo[w_txSpdoIdx].s_txCommPara.pw_sadr !=
           k_NOT_USED_ADR)
       {
         o_ret = TRUE;
@@ -535,12 +581,10 @@ BOOLEAN SPDO_TxSpdoIdxExists(BYTE_B_INSTNUM_ UINT16 w_txSpdoIdx)
  */
 void SPDO_NewData(BYTE_B_INSTNUM_ UINT16 w_txSpdoIdx)
 {
-  t_TXSM_OBJ *po_this = &as_Obj[B_INSTNUMidx]; /* instance pointer */
-
   /* if Tx Spdo exists */
   if (SPDO_TxSpdoIdxExists(B_INSTNUM_ w_txSpdoIdx))
   {
-    po_this->as_txSpdo[w_txSpdoIdx].s_txVar.o_newData = TRUE;
+    SPDO_MarkTxData(B_INSTNUM_ w_txSpdoIdx);
   }
   /* no else : Tx Spdo does not exist, error was already signaled */
 
@@ -548,6 +592,106 @@ void SPDO_NewData(BYTE_B_INSTNUM_ UINT16 w_txSpdoIdx)
   SCFM_TACK_PATH();
 }
 
+/**
+ * @brief This function sets the new data flag for the given Tx SPDO, without any check.
+ *
+ * @param        b_instNum          instance number (not checked, checked in SPDO_TxDataChanged() or SOD_Write() or SPDO_BuildTxSpdo()) valid range: 0..(EPLS_cfg_MAX_INSTANCES-1)
+ *
+ * @param        w_txSpdoIdx        index in the internal array of the Tx SPDO structures (not checked, checked in SPDO_TxSpdoIdxExists() or created in SPDO_TxObjWritten()) valid range: 0..(SPDO_cfg_MAX_NO_TX_SPDO-1)
+ */
+void SPDO_MarkTxData(BYTE_B_INSTNUM_ UINT16 w_txSpdoIdx)
+{
+  t_TXSM_OBJ *po_this = &as_Obj[B_INSTNUMidx]; /* instance pointer */
+
+  po_this->adw_newData[SET_WORD(w_txSpdoIdx)] |= SET_BIT(w_txSpdoIdx);
+  po_this->adw_due[SET_WORD(w_txSpdoIdx)] |= SET_BIT(w_txSpdoIdx);
+}
+
+#if ((SPDO_cfg_PROCESS_IMAGE == EPLS_k_ENABLE) && \
+     (SPDO_cfg_TX_DATA_CHANGE_TRACKING == EPLS_k_ENABLE))
+/**
+ * @brief This function sets the new data flag for the Tx SPDOs, whose image was changed by the application.
+ *
+ * @param        b_instNum          instance number (not checked, checked in SPDO_BuildTxSpdo()) valid range: 0..(EPLS_cfg_MAX_INSTANCES-1)
+ */
+void SPDO_TakeTxImageChanges(BYTE_B_INSTNUM)
+{
+  t_TXSM_OBJ *po_this = &as_Obj[B_INSTNUMidx]; /* instance pointer */
+  UINT32 adw_changed[SPDO_k_TX_SET_WORDS]; /* Tx SPDOs with a changed image */
+  UINT16 w_word; /* loop counter */
+
+  SHNF_TakeChangedTxImages(B_INSTNUM_ adw_changed, SPDO_k_TX_SET_WORDS);
+
+  for (w_word = 0U; w_word < SPDO_k_TX_SET_WORDS; w_word++)
+  {
+    po_this->adw_newData[w_word] |= adw_changed[w_word];
+    po_this->adw_due[w_word] |= adw_changed[w_word];
+  }
+
+  /* call the Control Flow Monitoring */
+  SCFM_TACK_PATH();
+}
+#endif
+
+/**
+ * @brief This function calls the "SPDO Producer" state machine for the Tx SPDOs, which are due.
+ *
+ * A Tx SPDO is due, if new data is available, its refresh time expired or it was sent by the time
+ * synchronization since the last call. The other Tx SPDOs are not visited. The refresh times are only
+ * checked, when the earliest of them expired.
+ *
+ * @param        b_instNum               instance number (not checked, checked in SPDO_BuildTxSpdo()) valid range: 0..(EPLS_cfg_MAX_INSTANCES-1)
+ *
+ * @param        dw_ct                   consecutive time, internal timer value (not checked, any value allowed) valid range: (UINT32)
+ *
+ * @param        w_noTxSpdo              number of the Tx SPDOs to be processed (not checked, checked in SPDO_GetNoProcTxSpdo()) valid range: 0..SPDO_cfg_MAX_NO_TX_SPDO
+ *
+ * @retval       pw_noFreeFrm            number of the free frames to be sent (pointer not checked, checked in SPDO_BuildTxSpdo()) valid range: <> NULL
+ */
+void SPDO_ProdSmDue(BYTE_B_INSTNUM_ UINT32 dw_ct, UINT16 w_noTxSpdo,
+                    UINT16 *pw_noFreeFrm)
+{
+  t_TXSM_OBJ *po_this = &as_Obj[B_INSTNUMidx]; /* instance pointer */
+  UINT16 w_word; /* loop counter for the words of the bit set */
+  UINT16 w_txSpdoIdx; /* index of the Tx SPDO */
+  UINT32 dw_bits; /* due Tx SPDOs of the word */
+
+  /* if the earliest refresh time expired */
+  if ((!po_this->o_refreshValid) ||
+      (EPLS_TIMEOUT(dw_ct, po_this->dw_nextRefresh)))
+  {
+    CheckRefresh(B_INSTNUM_ dw_ct, w_noTxSpdo);
+  }
+  /* no else : no refresh time expired */
+
+  /* for all words with Tx SPDOs to be processed */
+  for (w_word = 0U; w_word < SET_WORD(w_noTxSpdo + 31U); w_word++)
+  {
+    dw_bits = po_this->adw_due[w_word];
+
+    /* if the word holds Tx SPDOs not to be processed */
+    if ((UINT16)(w_noTxSpdo - (w_word * 32U)) < 32U)
+    {
+      dw_bits &= SET_BIT(w_noTxSpdo) - 1UL;
+    }
+    /* no else : all Tx SPDOs of the word are processed */
+
+    /* in the order of the Tx SPDO index, as the free frames may run out */
+    while (dw_bits != 0UL)
+    {
+      w_txSpdoIdx = (UINT16)((w_word * 32U) + LowestBit(dw_bits));
+      dw_bits &= dw_bits - 1UL;
+
+      /* Check if Data only SPDO is to be sent */
+      SPDO_ProdSm(B_INSTNUM_ dw_ct, w_txSpdoIdx, pw_noFreeFrm);
+      ReleaseDue(B_INSTNUM_ dw_ct, w_txSpdoIdx);
+    }
+  }
+
+  /* call the Control Flow Monitoring */
+  SCFM_TACK_PATH();
+}
+
 #pragma CTC SKIP
 /**
 * @brief Returns a pointer to the internal object.
@@ -582,6 +726,113 @@ const t_TXSM_OBJ* SPDO_GetTxProdSmObj(BYTE_B_INSTNUM)
 }
 #pragma CTC ENDSKIP
 
+/**
+* @brief This function checks the refresh times of the Tx SPDOs not due.
+*
+* The Tx SPDOs with an expired refresh time become due, the earliest refresh time of the others is stored.
+*
+* @param        b_instNum               instance number (not checked, checked in SPDO_BuildTxSpdo()) valid range: 0..(EPLS_cfg_MAX_INSTANCES-1)
+* @param        dw_ct                   consecutive time, internal timer value (not checked, any value allowed) valid range: (UINT32)
+* @param        w_noTxSpdo              number of the Tx SPDOs to be processed (not checked, checked in SPDO_GetNoProcTxSpdo()) valid range: 0..SPDO_cfg_MAX_NO_TX_SPDO
+*/
+static void CheckRefresh(BYTE_B_INSTNUM_ UINT32 dw_ct, UINT16 w_noTxSpdo)
+{
+  t_TXSM_OBJ *po_this = &as_Obj[B_INSTNUMidx]; /* instance pointer */
+  const t_TX_SPDO *ps_txSpdo; /* pointer to the Tx SPDO internal structure */
+  UINT16 w_txSpdoIdx; /* loop counter */
+
+  po_this->o_refreshValid = FALSE;
+
+  for (w_txSpdoIdx = 0U; w_txSpdoIdx < w_noTxSpdo; w_txSpdoIdx++)
+  {
+    ps_txSpdo = &po_this->ps_txSpdo[w_txSpdoIdx];
+
+    /* if the Tx SPDO is active and not due */
+    if ((*ps_txSpdo->s_txCommPara.pw_sadr != k_NOT_USED_ADR) &&
+        ((po_this->adw_due[SET_WORD(w_txSpdoIdx)] & SET_BIT(w_txSpdoIdx)) == 0UL))
+    {
+      /* if Tx SPDO refresh time expired */
+      if (EPLS_TIMEOUT(dw_ct, ps_txSpdo->s_txVar.dw_timeoutDT))
+      {
+        po_this->adw_due[SET_WORD(w_txSpdoIdx)] |= SET_BIT(w_txSpdoIdx);
+      }
+      else
+      {
+        AddRefresh(po_this, ps_txSpdo->s_txVar.dw_timeoutDT);
+      }
+    }
+    /* no else : the Tx SPDO is not active or is already due */
+  }
+
+  /* call the Control Flow Monitoring */
+  SCFM_TACK_PATH();
+}
+
+/**
+* @brief This function removes a Tx SPDO from the due Tx SPDOs, if it has no new data and its refresh time did not expire.
+*
+* @param        b_instNum               instance number (not checked, checked in SPDO_BuildTxSpdo()) valid range: 0..(EPLS_cfg_MAX_INSTANCES-1)
+* @param        dw_ct                   consecutive time, internal timer value (not checked, any value allowed) valid range: (UINT32)
+* @param        w_txSpdoIdx             Tx SPDO index (not checked, checked in SPDO_ProdSmDue()) valid range: 0..(SPDO_cfg_MAX_NO_TX_SPDO-1)
+*/
+static void ReleaseDue(BYTE_B_INSTNUM_ UINT32 dw_ct, UINT16 w_txSpdoIdx)
+{
+  t_TXSM_OBJ *po_this = &as_Obj[B_INSTNUMidx]; /* instance pointer */
+  const t_TX_SPDO *ps_txSpdo = &po_this->ps_txSpdo[w_txSpdoIdx]; /* pointer to
+                                              the Tx SPDO internal structure */
+
+  /* if Tx SPDO is not active */
+  if (*ps_txSpdo->s_txCommPara.pw_sadr == k_NOT_USED_ADR)
+  {
+    po_this->adw_due[SET_WORD(w_txSpdoIdx)] &= ~SET_BIT(w_txSpdoIdx);
+  }
+  /* else if the Tx SPDO has no new data and the refresh time did not expire */
+  else if (((po_this->adw_newData[SET_WORD(w_txSpdoIdx)] & SET_BIT(w_txSpdoIdx)) == 0UL) &&
+           (!EPLS_TIMEOUT(dw_ct, ps_txSpdo->s_txVar.dw_timeoutDT)))
+  {
+    po_this->adw_due[SET_WORD(w_txSpdoIdx)] &= ~SET_BIT(w_txSpdoIdx);
+    AddRefresh(po_this, ps_txSpdo->s_txVar.dw_timeoutDT);
+  }
+  /* no else : the Tx SPDO was not sent, it stays due */
+}
+
+/**
+* @brief This function takes a refresh time into the earliest refresh time.
+*
+* @param        po_this                 instance pointer (not checked, only called with reference to struct) valid range: <> NULL
+* @param        dw_timeout              refresh timeout of a Tx SPDO not due (not checked, any value allowed) valid range: (UINT32)
+*/
+static void AddRefresh(t_TXSM_OBJ *po_this, UINT32 dw_timeout)
+{
+  /* if the earliest refresh time is not known or later */
+  if ((!po_this->o_refreshValid) ||
+      (TIMEOUT_BEFORE(dw_timeout, po_this->dw_nextRefresh)))
+  {
+    po_this->dw_nextRefresh = dw_timeout;
+    po_this->o_refreshValid = TRUE;
+  }
+  /* no else : an earlier refresh time is stored */
+}
+
+/**
+* @brief This function returns the position of the lowest set bit.
+*
+* @param        dw_bits                 bits (not checked, only called with value <> 0) valid range: <> 0
+*
+* @return       position of the lowest set bit 0..31
+*/
+static UINT8 LowestBit(UINT32 dw_bits)
+{
+  /* position of the bit by the upper 5 bits of its product with a de Bruijn sequence */
+  static const UINT8 ab_deBruijnPos[32] =
+  {
+     0U,  1U, 28U,  2U, 29U, 14U, 24U,  3U, 30U, 22U, 20U, 15U, 25U, 17U,  4U,  8U,
+    31U, 27U, 13U, 23U, 21U, 19U, 16U,  7U, 26U, 12U, 18U,  6U, 11U,  5U, 10U,  9U
+  };
+
+  return ab_deBruijnPos[(UINT32)((dw_bits & (~dw_bits + 1UL)) * 0x077CB531UL) >> 27];
+}
+
 
 /**
 * @brief This function sends a Tx SPDO.
@@ -620,7 +871,7 @@ STATIC BOOLEAN SendTxSpdo(BYTE_B_INSTNUM_ UINT32 dw_ct, UINT16 w_txSpdoIdx,
   /* openSAFETY domain number */
   s_txSpdoHeaderBuffer.w_sdn = SDN_GetSdn(B_INSTNUM);
   /* source address */
-  s_txSpdoHeaderBuffer.w_adr = *po_this->as_txSpdo[w_txSpdoIdx].
+  s_txSpdoHeaderBuffer.w_adr = *po_this->ps_txSpdo[w_txSpdoIdx].
                               s_txCommPara.pw_sadr;
   /* SPDO id is set */
   s_txSpdoHeaderBuffer.b_id = b_spdoId;
@@ -791,7 +1042,7 @@ static BOOLEAN SetPtrToTxCommPara(BYTE_B_INSTNUM_ UINT16 w_index,
 */
 STATIC BOOLEAN GetConnectionValid(BYTE_B_INSTNUM_ UINT16 const w_txSpdoIdx)
 {
-  t_VARIABLE_FOR_TX_SPDO  *po_this = &as_Obj[B_INSTNUMidx].as_txSpdo[w_txSpdoIdx].s_txVar;
+  t_VARIABLE_FOR_TX_SPDO  *po_this = &as_Obj[B_INSTNUMidx].ps_txSpdo[w_txSpdoIdx].s_txVar;
   BOOLEAN o_retVal = TRUE;
 #if (1 < SPDO_cfg_MAX_SYNC_RX_SPDO)
   UINT16 i;
@@ -837,7 +1088,7 @@ STATIC BOOLEAN GetConnectionValid(BYTE_B_INSTNUM_ UINT16 const w_txSpdoIdx)
 */
 STATIC BOOLEAN GetExtCtAllowed(BYTE_B_INSTNUM_ UINT16 const w_txSpdoIdx)
 {
-  t_VARIABLE_FOR_TX_SPDO  *po_this = &as_Obj[B_INSTNUMidx].as_txSpdo[w_txSpdoIdx].s_txVar;
+  t_VARIABLE_FOR_TX_SPDO  *po_this = &as_Obj[B_INSTNUMidx].ps_txSpdo[w_txSpdoIdx].s_txVar;
   BOOLEAN o_retVal = TRUE;
 #if (1 < SPDO_cfg_MAX_SYNC_RX_SPDO)
   UINT16 i;
@@ -37,6 +37,30 @@
  */
 static t_TX_SYNC_PROD_SM_OBJ as_Obj[EPLS_cfg_MAX_INSTANCES] SAFE_NO_INIT_SEKTOR;
 
+/**
+ * Time synchronization producer state machines of all instances
+ */
+static t_TX_SYNC_PROD_SM as_TxSyncProdSm[SPDO_SHARED_SIZE(SPDO_cfg_MAX_NO_TX_SPDO,
+                                                          SPDO_cfg_MAX_NO_TX_SPDO_SDG)] SAFE_NO_INIT_SEKTOR;
+
+/**
+ * @brief This function initializes the pointer to the time synchronization producer state machines of the instance.
+ *
+ * The main instance gets the first SPDO_cfg_MAX_NO_TX_SPDO state machines, every other instance
+ * SPDO_cfg_MAX_NO_TX_SPDO_SDG state machines.
+ *
+ * @param        b_instNum          instance number (not checked, checked in SSC_InitAll()), valid range: 0..(EPLS_cfg_MAX_INSTANCES-1)
+ */
+void SPDO_InitTxSyncProd(BYTE_B_INSTNUM)
+{
+  as_Obj[B_INSTNUMidx].ps_txSyncProdSm =
+      &as_TxSyncProdSm[SPDO_SHARED_START(B_INSTNUMidx, SPDO_cfg_MAX_NO_TX_SPDO,
+                                         SPDO_cfg_MAX_NO_TX_SPDO_SDG)];
+
+  /* call the Control Flow Monitoring */
+  SCFM_TACK_PATH();
+}
+
 /**
  * @brief This function resets the given SPDO time synchronization producer state machine.
  *
@@ -50,7 +74,7 @@ void SPDO_TimeSyncProdSmReset(BYTE_B_INSTNUM_ UINT16 w_txSpdoIdx)
   t_TX_SYNC_PROD_SM *ps_txSyncProdSm; /* pointer to the Tx SPDO internal
                                           structure */
 
-  ps_txSyncProdSm = &po_this->as_txSyncProdSm[w_txSpdoIdx];
+  ps_txSyncProdSm = &po_this->ps_txSyncProdSm[w_txSpdoIdx];
 
   ps_txSyncProdSm->o_waitForTReq = TRUE;
   ps_txSyncProdSm->b_echoTR = 0U;
@@ -79,7 +103,7 @@ void SPDO_TimeSyncProdSmNoTresSet(BYTE_B_INSTNUM_ UINT16 w_txSpdoIdx,
 {
   t_TX_SYNC_PROD_SM_OBJ *po_this = &as_Obj[B_INSTNUMidx]; /* instance pointer */
 
-  po_this->as_txSyncProdSm[w_txSpdoIdx].pb_noTRes = pb_noTres;
+  po_this->ps_txSyncProdSm[w_txSpdoIdx].pb_noTRes = pb_noTres;
 
   /* call the Control Flow Monitoring */
   SCFM_TACK_PATH();
@@ -114,7 +138,7 @@ void SPDO_TimeSyncProdSm(BYTE_B_INSTNUM_ UINT32 dw_ct, UINT16 w_txSpdoIdx,
   t_TX_SYNC_PROD_SM_OBJ *po_this = &as_Obj[B_INSTNUMidx]; /* instance pointer */
 
   /* pointer to the Tx SPDO internal structure */
-  t_TX_SYNC_PROD_SM *ps_txSyncProdSm = &po_this->as_txSyncProdSm[w_txSpdoIdx];
+  t_TX_SYNC_PROD_SM *ps_txSyncProdSm = &po_this->ps_txSyncProdSm[w_txSpdoIdx];
   t_SENDING_REQ_TYPE e_sendingReqType; /* sending request type */
 
   /* if the state machine is waiting for TRequest */
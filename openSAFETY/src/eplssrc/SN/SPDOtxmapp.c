@@ -90,6 +90,47 @@
  */
 #define TX_SPDO
 
+#if (SPDO_cfg_TX_DATA_CHANGE_TRACKING == EPLS_k_ENABLE)
+/**
+ * Type definition for a run of a Tx SPDO in the index of the mapped data.
+ */
+typedef struct
+{
+    /** Address of the first byte of the run in the SOD */
+    PTR_TYPE dw_adr;
+    /** Number of bytes of the run */
+    UINT8    b_len;
+    /** Index of the Tx SPDO */
+    UINT16   w_txSpdoIdx;
+}t_RUN_REF;
+
+/**
+ * Index of the data mapped into the Tx SPDOs, the runs of all Tx SPDOs sorted by their address.
+ *
+ * It is built with the first write access to a mappable object, after a mapping was activated.
+ */
+typedef struct
+{
+    /** FALSE if a mapping was activated since the index was built */
+    BOOLEAN   o_valid;
+    /** Length of the longest run */
+    UINT8     b_maxLen;
+    /** Number of runs */
+    UINT16    w_noRef;
+    /** Runs of all Tx SPDOs, the part of the instance in as_RunRef */
+    t_RUN_REF *ps_runRef;
+}t_RUN_INDEX;
+
+/** variable containing the index of the mapped data for every instance */
+static t_RUN_INDEX as_RunIndex[EPLS_cfg_MAX_INSTANCES] SAFE_NO_INIT_SEKTOR;
+
+/** variable containing the runs of the indices of all instances */
+static t_RUN_REF as_RunRef[SPDO_SHARED_SIZE(SPDO_cfg_MAX_NO_SPDO, SPDO_cfg_MAX_NO_SPDO_SDG) *
+                           SPDO_cfg_MAX_TX_SPDO_MAPP_ENTRIES] SAFE_NO_INIT_SEKTOR;
+
+static void BuildRunIndex(BYTE_B_INSTNUM);
+#endif
+
 #include "SPDOmappcom.cin"
 
 /**
@@ -110,7 +151,11 @@ UINT8 *SPDO_TxMappingProcess(BYTE_B_INSTNUM_ UINT16 w_txSpdoIdx, UINT8 *pb_len)
   t_MAPP_PARAM *ps_txSpdo = po_this->ps_mappPara + w_txSpdoIdx; /* pointer to
                                               the Tx SPDO internal structure */
   UINT8 *pb_payloadData; /* temporary pointer to set the payload data */
+  const t_MAPP_RUN *ps_run; /* pointer to a run of the mapping */
   UINT32 i; /* loop counter */
+#if (ENDIAN == BIG)
+  UINT32 j; /* loop counter */
+#endif
 
   /* if there are objects  mapped */
   if (ps_txSpdo->b_noMappedObject != 0U)
@@ -128,11 +173,59 @@ UINT8 *SPDO_TxMappingProcess(BYTE_B_INSTNUM_ UINT16 w_txSpdoIdx, UINT8 *pb_len)
       /* number of payload data */
       *pb_len = ps_txSpdo->b_lenOfSpdo;
     
-      /* loop from 0 to length of the SPDO */
-      for (i = 0U; i < ps_txSpdo->b_lenOfSpdo; i++)
+#if (SPDO_cfg_PROCESS_IMAGE == EPLS_k_ENABLE)
+      /* if the application published new data, it is taken into the SOD */
+      if (SHNF_FetchTxImage(B_INSTNUM_ w_txSpdoIdx, pb_payloadData,
+                            ps_txSpdo->b_lenOfSpdo))
+      {
+        /* loop for all runs of the mapping */
+        for (i = 0U; i < ps_txSpdo->b_noRun; i++)
+        {
+          ps_run = &ps_txSpdo->as_run[i];
+#if (ENDIAN == BIG)
+          /* if the object is stored in reversed order */
+          if (ps_run->o_swap)
+          {
+            for (j = 0U; j < ps_run->b_len; j++)
+            {
+              *ADD_OFFSET(ps_run->pb_data, ps_run->b_len - j - 1U) =
+                  *ADD_OFFSET(pb_payloadData, ps_run->b_spdoOfs + j);
+            }
+          }
+          else
+#endif
+          {
+            /* copy the run from the SPDO into the SOD */
+            MEMCOPY(ps_run->pb_data, ADD_OFFSET(pb_payloadData, ps_run->b_spdoOfs),
+                    ps_run->b_len);
+          }
+        }
+      }
+      else
+#endif
       {
-        /* copy one Byte from the pointer byte array into the SPDO */
-        *ADD_OFFSET(pb_payloadData, i) = *(ps_txSpdo->apb_DataForSpdo[i]);
+        /* loop for all runs of the mapping */
+        for (i = 0U; i < ps_txSpdo->b_noRun; i++)
+        {
+          ps_run = &ps_txSpdo->as_run[i];
+#if (ENDIAN == BIG)
+          /* if the object is stored in reversed order */
+          if (ps_run->o_swap)
+          {
+            for (j = 0U; j < ps_run->b_len; j++)
+            {
+              *ADD_OFFSET(pb_payloadData, ps_run->b_spdoOfs + j) =
+                  *ADD_OFFSET(ps_run->pb_data, ps_run->b_len - j - 1U);
+            }
+          }
+          else
+#endif
+          {
+            /* copy the run from the SOD into the SPDO */
+            MEMCOPY(ADD_OFFSET(pb_payloadData, ps_run->b_spdoOfs), ps_run->pb_data,
+                    ps_run->b_len);
+          }
+        }
       }
     }
     /* no else : error */
@@ -153,4 +246,131 @@ UINT8 *SPDO_TxMappingProcess(BYTE_B_INSTNUM_ UINT16 w_txSpdoIdx, UINT8 *pb_len)
   return pb_ret;
 }
 
+#if (SPDO_cfg_TX_DATA_CHANGE_TRACKING == EPLS_k_ENABLE)
+/**
+* @brief This function is called by the SOD, if the data of a mappable object is changed.
+*
+* The Tx SPDOs mapping any of the written bytes are signaled as after SPDO_TxDataChanged(). The runs are
+* searched in the index of the mapped data, so the cost does not depend on the number of Tx SPDOs.
+*
+* @param        b_instNum        instance number (not checked, checked in SOD_Write()), valid range: 0..(EPLS_cfg_MAX_INSTANCES-1)
+*
+* @param        pv_data          pointer to the first written byte in the SOD (not checked, any value allowed)
+*
+* @param        dw_len           number of the written bytes (not checked, any value allowed), valid range: (UINT32)
+*/
+void SPDO_TxObjWritten(BYTE_B_INSTNUM_ const void *pv_data, UINT32 dw_len)
+{
+  t_RUN_INDEX *ps_index = &as_RunIndex[B_INSTNUMidx]; /* index of the instance */
+  const t_RUN_REF *ps_ref; /* pointer to a run */
+  PTR_TYPE dw_start = (PTR_TYPE)pv_data; /* first written byte */ /*lint !e923 */
+  PTR_TYPE dw_end = dw_start + dw_len; /* byte after the written bytes */
+  UINT16 w_low = 0U; /* lower bound of the search */
+  UINT16 w_high; /* upper bound of the search */
+  UINT16 w_mid; /* middle of the search */
+  BOOLEAN o_done = FALSE; /* TRUE if no earlier run can reach the written bytes */
+
+  /* if a mapping was activated since the index was built */
+  if (!ps_index->o_valid)
+  {
+    BuildRunIndex(B_INSTNUM);
+  }
+  /* no else : the index is valid */
+
+  /* search the first run starting behind the written bytes */
+  w_high = ps_index->w_noRef;
+  while (w_low < w_high)
+  {
+    w_mid = (UINT16)(w_low + ((w_high - w_low) / 2U));
+
+    if (ps_index->ps_runRef[w_mid].dw_adr < dw_end)
+    {
+      w_low = (UINT16)(w_mid + 1U);
+    }
+    else
+    {
+      w_high = w_mid;
+    }
+  }
+
+  /* the runs starting before, as long as they can reach the written bytes */
+  while ((w_low > 0U) && !o_done)
+  {
+    w_low--;
+    ps_ref = &ps_index->ps_runRef[w_low];
+
+    /* if this and all earlier runs end before the written bytes */
+    if ((ps_ref->dw_adr + ps_index->b_maxLen) <= dw_start)
+    {
+      o_done = TRUE;
+    }
+    /* else if the run overlaps the written bytes */
+    else if ((ps_ref->dw_adr + ps_ref->b_len) > dw_start)
+    {
+      SPDO_MarkTxData(B_INSTNUM_ ps_ref->w_txSpdoIdx);
+    }
+    /* no else : the run ends before the written bytes */
+  }
+
+  /* call the Control Flow Monitoring */
+  SCFM_TACK_PATH();
+}
+
+/**
+* @brief This function builds the index of the data mapped into the Tx SPDOs.
+*
+* @param        b_instNum        instance number (not checked, checked in SOD_Write()), valid range: 0..(EPLS_cfg_MAX_INSTANCES-1)
+*/
+static void BuildRunIndex(BYTE_B_INSTNUM)
+{
+  const t_MAPP_OBJ *po_this = &as_Obj[B_INSTNUMidx]; /* instance pointer */
+  t_RUN_INDEX *ps_index = &as_RunIndex[B_INSTNUMidx]; /* index of the instance */
+  const t_MAPP_PARAM *ps_txSpdo; /* pointer to the Tx SPDO internal structure */
+  t_RUN_REF s_ref; /* run to be inserted */
+  UINT16 w_txSpdoIdx; /* loop counter */
+  UINT16 w_pos; /* position of the run to be inserted */
+  UINT8 b_run; /* loop counter */
+
+  ps_index->w_noRef = 0U;
+  ps_index->b_maxLen = 0U;
+
+  /* for all Tx SPDOs */
+  for (w_txSpdoIdx = 0U; w_txSpdoIdx < po_this->w_noSpdo; w_txSpdoIdx++)
+  {
+    ps_txSpdo = po_this->ps_mappPara + w_txSpdoIdx;
+
+    /* for all runs of the active mapping */
+    for (b_run = 0U; b_run < ps_txSpdo->b_noRun; b_run++)
+    {
+      s_ref.dw_adr = (PTR_TYPE)ps_txSpdo->as_run[b_run].pb_data; /*lint !e923 */
+      s_ref.b_len = ps_txSpdo->as_run[b_run].b_len;
+      s_ref.w_txSpdoIdx = w_txSpdoIdx;
+
+      /* the run is inserted in the order of the address, the runs are mostly
+         in the order of the SOD already */
+      w_pos = ps_index->w_noRef;
+      while ((w_pos > 0U) && (ps_index->ps_runRef[w_pos - 1U].dw_adr > s_ref.dw_adr))
+      {
+        ps_index->ps_runRef[w_pos] = ps_index->ps_runRef[w_pos - 1U];
+        w_pos--;
+      }
+      ps_index->ps_runRef[w_pos] = s_ref;
+      ps_index->w_noRef++;
+
+      /* if the run is the longest */
+      if (s_ref.b_len > ps_index->b_maxLen)
+      {
+        ps_index->b_maxLen = s_ref.b_len;
+      }
+      /* no else : a longer run exists */
+    }
+  }
+
+  ps_index->o_valid = TRUE;
+
+  /* call the Control Flow Monitoring */
+  SCFM_TACK_PATH();
+}
+#endif
+
 /** @} */
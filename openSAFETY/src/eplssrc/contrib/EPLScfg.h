@@ -171,9 +171,9 @@
  * Define to enable or disable the using of the Lookup table for the SPDO number assignment.
  *
  * If the look-up table is enabled then the SPDO filtering works faster but it needs always
- * 2 Byte * 1024 memory. If the look-up table is disabled then a linear search table is used
- * to filter the SPDO frames and the filtering works slower because of linear searching. This
- * linear search table needs 4 Bytes per SADR configured in the SPDO communication parameters.
+ * 2 Byte * 1024 memory. If the look-up table is disabled then a table sorted by the SADR is
+ * used to filter the SPDO frames, it is searched binary. This table needs 4 Bytes per SPDO of
+ * the instance, the instances other than the main instance only get the _SDG number of SPDOs.
  *
  * Allowed values: EPLS_k_ENABLE, EPLS_k_DISABLE
  */
@@ -244,6 +244,22 @@
  */
 #define SPDO_cfg_CONNECTION_VALID_STATISTIC		EPLS_k_ENABLE
 
+/**
+ * The data of the SPDOs is published to the application in a double buffered
+ * process image, which is provided by the SHNF
+ *
+ * Allowed values: EPLS_k_ENABLE, EPLS_k_DISABLE
+ */
+#define SPDO_cfg_PROCESS_IMAGE					EPLS_k_DISABLE
+
+/**
+ * Writes to objects mapped into a Tx SPDO mark the Tx SPDO as changed, it is
+ * sent with the next SPDO_BuildTxSpdo() as after SPDO_TxDataChanged()
+ *
+ * Allowed values: EPLS_k_ENABLE, EPLS_k_DISABLE
+ */
+#define SPDO_cfg_TX_DATA_CHANGE_TRACKING		EPLS_k_DISABLE
+
 /**
  * Maximum number of the Rx SPDOs.
  *
@@ -1,5 +1,17 @@
 /*
  * \file datalogger.c
+ *
+ * The DATA_LOGGER macros do not format on the calling thread. The caller captures
+ * the format pointer, the arguments and a timestamp into a fixed size record of a
+ * lock-free ring (any number of producers, see DataLoggerLog). A background thread,
+ * started with the first message, formats the records and writes them with buffered
+ * I/O. If the ring is full, the message is dropped and counted per level.
+ *
+ * String arguments are copied into the record, as the caller may free them before
+ * the record is formatted. Formats have to be string literals, as only the pointer
+ * is stored.
+ *
+ * On windows, the messages are formatted and printed on the calling thread.
  */
 
 #if defined(_WIN32)
@@ -10,6 +22,9 @@
 #include <stdarg.h>
 #include <stdlib.h>
 #include <string.h>
+#include <stddef.h>
+#include <time.h>
+#include <pthread.h>
 #endif
 
 #include <stdio.h>
@@ -17,27 +32,30 @@
 
 #include <datalogger.h>
 
+/* Size of the buffers the synchronous functions format into */
+#define DATA_LOGGER_LINE_SIZE 512
+
 uint32_t DataLoggerDebug(char * format, ...)
 {
 #ifdef DATA_LOGGER_PRINT_DEBUG
     int ret;
-    char szBuffer[512];
+    char szBuffer[DATA_LOGGER_LINE_SIZE];
     va_list args;
 
     /* Start with the first argument on the stack */
     va_start(args, format);
 
-    /* parse the string into the return Buffer */
-    ret = vsprintf(szBuffer, format, args);
+    /* parse the string into the return Buffer, truncated to its size */
+    ret = vsnprintf(szBuffer, sizeof(szBuffer), format, args);
 
     /* close variable arguments handling */
     va_end(args);
 
     /* print the string to file */
-    DataLoggerFile(DATA_LOGGER_OUTPUT, "%s", szBuffer);
+    DataLoggerFile(DATA_LOGGER_FILE, "%s", szBuffer);
 
     /* print the string to screen */
-    DataLoggerStdOut(DATA_LOGGER_OUTPUT, "%s", szBuffer);
+    DataLoggerStdOut("%s", szBuffer);
 
     return ret;
 #else
@@ -48,19 +66,19 @@ uint32_t DataLoggerDebug(char * format, ...)
 uint32_t DataLoggerFile(char * szFilename, char  * format, ...)
 {
     int ret;
-    char szBuffer[512];
+    char szBuffer[DATA_LOGGER_LINE_SIZE];
     va_list args;
     FILE * fileOutput;
 
-    /* Trying to open the file for writing */
-    if ( ( fileOutput = fopen ( szFilename, "w" ) ) != 0 )
+    /* Trying to open the file for appending */
+    if ( ( fileOutput = fopen ( szFilename, "a" ) ) == NULL )
         return -1;
 
     /* Start with the first argument on the stack */
     va_start(args, format);
 
-    /* parse the string into the return Buffer */
-    ret = vsprintf(szBuffer, format, args);
+    /* parse the string into the return Buffer, truncated to its size */
+    ret = vsnprintf(szBuffer, sizeof(szBuffer), format, args);
 
     /* close variable arguments handling */
     va_end(args);
@@ -78,14 +96,14 @@ uint32_t DataLoggerFile(char * szFilename, char  * format, ...)
 uint32_t DataLoggerStdOut(char  * format, ...)
 {
     int ret;
-    char szBuffer[512];
+    char szBuffer[DATA_LOGGER_LINE_SIZE];
     va_list args;
 
     /* Start with the first argument on the stack */
     va_start(args, format);
 
-    /* parse the string into the return Buffer */
-    ret = vsprintf(szBuffer, format, args);
+    /* parse the string into the return Buffer, truncated to its size */
+    ret = vsnprintf(szBuffer, sizeof(szBuffer), format, args);
 
     /* close variable arguments handling */
     va_end(args);
@@ -96,3 +114,646 @@ uint32_t DataLoggerStdOut(char  * format, ...)
     return ret;
 }
 
+#if defined(_WIN32)
+
+void DataLoggerLog(uint8_t b_level, const char * format, ...)
+{
+    char szBuffer[DATA_LOGGER_LINE_SIZE];
+    va_list args;
+
+    (void)b_level;
+
+    va_start(args, format);
+    (void)vsnprintf(szBuffer, sizeof(szBuffer), format, args);
+    va_end(args);
+
+    printf ( "%s", szBuffer );
+#ifdef DATA_LOGGER_OUTPUT_TO_FILE
+    DataLoggerFile(DATA_LOGGER_FILE, "%s", szBuffer);
+#endif
+}
+
+void DataLoggerFlush(void)
+{
+    fflush ( stdout );
+}
+
+uint32_t DataLoggerDropped(uint8_t b_level)
+{
+    (void)b_level;
+    return 0;
+}
+
+#else /* defined(_WIN32) */
+
+#if ( DATA_LOGGER_RING_SIZE & ( DATA_LOGGER_RING_SIZE - 1 ) ) != 0
+#error DATA_LOGGER_RING_SIZE has to be a power of two
+#endif
+
+#define DATA_LOGGER_RING_MASK ( DATA_LOGGER_RING_SIZE - 1 )
+
+/* Number of levels with a drop counter, DATA_LOGGER_LEVEL_ERROR .. DEBUG */
+#define DATA_LOGGER_NUM_LEVELS 3
+
+/* Time the writer sleeps at most without being woken, in milli seconds */
+#define DATA_LOGGER_IDLE_MS 10
+
+/* Class of a conversion, telling how its argument is passed and stored */
+typedef enum
+{
+    k_CONV_NONE,     /* no argument, e.g. %% */
+    k_CONV_SIGNED,   /* d, i */
+    k_CONV_UNSIGNED, /* u, o, x, X */
+    k_CONV_CHAR,     /* c */
+    k_CONV_DOUBLE,   /* f, e, g, a */
+    k_CONV_STRING,   /* s, copied into the record */
+    k_CONV_POINTER,  /* p */
+    k_CONV_COUNT     /* n, the pointer is consumed but nothing is stored */
+} t_CONV_CLASS;
+
+/* A parsed conversion specification */
+typedef struct
+{
+    t_CONV_CLASS e_class;
+    char c_conversion;      /* the conversion character */
+    char ac_length[3];      /* the length modifier, e.g. "l", "hh" */
+    uint8_t b_numStars;     /* number of '*' of the width and precision */
+    uint16_t w_length;      /* number of characters from the '%' */
+} t_CONVERSION;
+
+/* An argument of a record */
+typedef union
+{
+    int64_t ll_signed;
+    uint64_t ull_unsigned;
+    double d_double;
+    const void * pv_pointer;
+} t_LOG_ARG;
+
+/* A record of the ring */
+typedef struct
+{
+    /* sequence number of the slot, minus the index of the slot (zero is valid) */
+    volatile uint32_t dw_seq;
+    uint8_t b_level;
+    uint8_t b_numArgs;
+    uint16_t w_stringsUsed;
+    const char * pc_format;
+    uint64_t ddw_timestampNs;
+    t_LOG_ARG as_args[DATA_LOGGER_MAX_ARGS];
+    char ac_strings[DATA_LOGGER_STRING_SPACE];
+} t_LOG_RECORD;
+
+/* The ring and its positions */
+static t_LOG_RECORD as_ring[DATA_LOGGER_RING_SIZE];
+static volatile uint32_t dw_enqueuePos;
+static uint32_t dw_dequeuePos;
+/* Position up to which the records have been written and flushed */
+static volatile uint32_t dw_flushedPos;
+
+/* Messages dropped per level, as the ring was full */
+static volatile uint32_t adw_dropped[DATA_LOGGER_NUM_LEVELS];
+/* Drops already reported by the writer */
+static uint32_t adw_droppedReported[DATA_LOGGER_NUM_LEVELS];
+
+/* The writer thread */
+static pthread_once_t s_writerOnce = PTHREAD_ONCE_INIT;
+static pthread_t s_writerThread;
+static int i_writerRunning;
+static pthread_mutex_t s_writerMutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t s_writerCond = PTHREAD_COND_INITIALIZER;
+static volatile uint32_t dw_writerSleeping;
+static volatile uint32_t dw_writerStop;
+
+static FILE * ps_logFile;
+
+/**
+ * \brief Parses the conversion specification starting at the '%'
+ */
+static void ParseConversion(const char * pc_spec, t_CONVERSION * ps_conv)
+{
+    const char * pc = pc_spec + 1;
+    uint8_t b_len = 0;
+
+    ps_conv->b_numStars = 0;
+
+    /* flags */
+    while ( *pc != '\0' && strchr ( "-+ #0'", *pc ) != NULL )
+        pc++;
+    /* width */
+    if ( *pc == '*' )
+    {
+        ps_conv->b_numStars++;
+        pc++;
+    }
+    while ( *pc >= '0' && *pc <= '9' )
+        pc++;
+    /* precision */
+    if ( *pc == '.' )
+    {
+        pc++;
+        if ( *pc == '*' )
+        {
+            ps_conv->b_numStars++;
+            pc++;
+        }
+        while ( *pc >= '0' && *pc <= '9' )
+            pc++;
+    }
+    /* length modifier */
+    while ( b_len < 2 && *pc != '\0' && strchr ( "hlLqjzt", *pc ) != NULL )
+        ps_conv->ac_length[b_len++] = *pc++;
+    ps_conv->ac_length[b_len] = '\0';
+
+    ps_conv->c_conversion = *pc;
+    switch ( *pc )
+    {
+        case 'd': case 'i':
+            ps_conv->e_class = k_CONV_SIGNED;
+            break;
+        case 'u': case 'o': case 'x': case 'X':
+            ps_conv->e_class = k_CONV_UNSIGNED;
+            break;
+        case 'c':
+            ps_conv->e_class = k_CONV_CHAR;
+            break;
+        case 'f': case 'F': case 'e': case 'E': case 'g': case 'G': case 'a': case 'A':
+            ps_conv->e_class = k_CONV_DOUBLE;
+            break;
+        case 's':
+            ps_conv->e_class = k_CONV_STRING;
+            break;
+        case 'p':
+            ps_conv->e_class = k_CONV_POINTER;
+            break;
+        case 'n':
+            ps_conv->e_class = k_CONV_COUNT;
+            break;
+        default:
+            /* %% and unknown conversions take no argument */
+            ps_conv->e_class = k_CONV_NONE;
+            break;
+    }
+
+    ps_conv->w_length = (uint16_t)( pc - pc_spec ) + ( *pc != '\0' ? 1 : 0 );
+}
+
+/**
+ * \brief Reads an integer argument as given by the length modifier
+ */
+static void CaptureInteger(const t_CONVERSION * ps_conv, va_list * pargs, t_LOG_ARG * ps_arg)
+{
+    const char * pc_len = ps_conv->ac_length;
+    int o_signed = ( ps_conv->e_class == k_CONV_SIGNED );
+
+    if ( strcmp ( pc_len, "ll" ) == 0 || strcmp ( pc_len, "q" ) == 0 )
+    {
+        if ( o_signed ) ps_arg->ll_signed = va_arg ( *pargs, long long );
+        else ps_arg->ull_unsigned = va_arg ( *pargs, unsigned long long );
+    }
+    else if ( strcmp ( pc_len, "l" ) == 0 )
+    {
+        if ( o_signed ) ps_arg->ll_signed = va_arg ( *pargs, long );
+        else ps_arg->ull_unsigned = va_arg ( *pargs, unsigned long );
+    }
+    else if ( strcmp ( pc_len, "j" ) == 0 )
+    {
+        if ( o_signed ) ps_arg->ll_signed = va_arg ( *pargs, intmax_t );
+        else ps_arg->ull_unsigned = va_arg ( *pargs, uintmax_t );
+    }
+    else if ( strcmp ( pc_len, "z" ) == 0 )
+    {
+        ps_arg->ull_unsigned = va_arg ( *pargs, size_t );
+    }
+    else if ( strcmp ( pc_len, "t" ) == 0 )
+    {
+        ps_arg->ll_signed = va_arg ( *pargs, ptrdiff_t );
+    }
+    else if ( strcmp ( pc_len, "hh" ) == 0 )
+    {
+        /* char and short are promoted to int, and converted back as printf does */
+        if ( o_signed ) ps_arg->ll_signed = (signed char)va_arg ( *pargs, int );
+        else ps_arg->ull_unsigned = (unsigned char)va_arg ( *pargs, unsigned int );
+    }
+    else if ( strcmp ( pc_len, "h" ) == 0 )
+    {
+        if ( o_signed ) ps_arg->ll_signed = (short)va_arg ( *pargs, int );
+        else ps_arg->ull_unsigned = (unsigned short)va_arg ( *pargs, unsigned int );
+    }
+    else
+    {
+        if ( o_signed ) ps_arg->ll_signed = va_arg ( *pargs, int );
+        else ps_arg->ull_unsigned = va_arg ( *pargs, unsigned int );
+    }
+}
+
+/**
+ * \brief Captures the arguments of the format into the record
+ */
+static void CaptureArguments(t_LOG_RECORD * ps_record, const char * format, va_list * pargs)
+{
+    t_CONVERSION s_conv;
+    const char * pc;
+    const char * pc_string;
+    size_t i_stringLength;
+    uint8_t b_star;
+
+    ps_record->b_numArgs = 0;
+    ps_record->w_stringsUsed = 0;
+
+    for ( pc = format; *pc != '\0'; pc++ )
+    {
+        if ( *pc != '%' )
+            continue;
+
+        ParseConversion ( pc, &s_conv );
+        pc += s_conv.w_length - 1;
+
+        /* the count is not written, but its arguments are skipped to keep the
+           following ones in place */
+        if ( s_conv.e_class == k_CONV_COUNT )
+        {
+            for ( b_star = 0; b_star < s_conv.b_numStars; b_star++ )
+                (void)va_arg ( *pargs, int );
+            (void)va_arg ( *pargs, void * );
+            continue;
+        }
+
+        /* the remaining arguments are not captured, the writer prints the rest of
+           the format unformatted */
+        if ( ( ps_record->b_numArgs + s_conv.b_numStars + 1 ) > DATA_LOGGER_MAX_ARGS )
+            break;
+
+        for ( b_star = 0; b_star < s_conv.b_numStars; b_star++ )
+            ps_record->as_args[ps_record->b_numArgs++].ll_signed = va_arg ( *pargs, int );
+
+        switch ( s_conv.e_class )
+        {
+            case k_CONV_SIGNED:
+            case k_CONV_UNSIGNED:
+                CaptureInteger ( &s_conv, pargs, &ps_record->as_args[ps_record->b_numArgs++] );
+                break;
+            case k_CONV_CHAR:
+                ps_record->as_args[ps_record->b_numArgs++].ll_signed = va_arg ( *pargs, int );
+                break;
+            case k_CONV_DOUBLE:
+                if ( strcmp ( s_conv.ac_length, "L" ) == 0 )
+                    ps_record->as_args[ps_record->b_numArgs++].d_double = (double)va_arg ( *pargs, long double );
+                else
+                    ps_record->as_args[ps_record->b_numArgs++].d_double = va_arg ( *pargs, double );
+                break;
+            case k_CONV_POINTER:
+                ps_record->as_args[ps_record->b_numArgs++].pv_pointer = va_arg ( *pargs, void * );
+                break;
+            case k_CONV_STRING:
+                pc_string = va_arg ( *pargs, const char * );
+                if ( pc_string == NULL )
+                    pc_string = "(null)";
+                /* the space is used up, the string is printed empty by the
+                   terminator of the last one */
+                if ( ps_record->w_stringsUsed >= DATA_LOGGER_STRING_SPACE )
+                {
+                    ps_record->as_args[ps_record->b_numArgs++].ull_unsigned = DATA_LOGGER_STRING_SPACE - 1;
+                    break;
+                }
+                /* copied, truncated to the space left in the record */
+                i_stringLength = strlen ( pc_string );
+                if ( i_stringLength > (size_t)( DATA_LOGGER_STRING_SPACE - 1 - ps_record->w_stringsUsed ) )
+                    i_stringLength = (size_t)( DATA_LOGGER_STRING_SPACE - 1 - ps_record->w_stringsUsed );
+                memcpy ( &ps_record->ac_strings[ps_record->w_stringsUsed], pc_string, i_stringLength );
+                ps_record->ac_strings[ps_record->w_stringsUsed + i_stringLength] = '\0';
+                ps_record->as_args[ps_record->b_numArgs++].ull_unsigned = ps_record->w_stringsUsed;
+                ps_record->w_stringsUsed += (uint16_t)( i_stringLength + 1 );
+                break;
+            default:
+                break;
+        }
+    }
+}
+
+/**
+ * \brief Formats a record, the arguments are passed with canonical types
+ */
+static void FormatRecord(const t_LOG_RECORD * ps_record, FILE * ps_out)
+{
+    t_CONVERSION s_conv;
+    char ac_spec[64];
+    const char * pc;
+    const char * pc_literal;
+    const t_LOG_ARG * ps_arg;
+    uint8_t b_arg = 0;
+    uint16_t w_spec;
+    uint16_t i;
+
+#ifdef DATA_LOGGER_TIMESTAMPS
+    fprintf ( ps_out, "[%6llu.%06llu] ", (unsigned long long)( ps_record->ddw_timestampNs / 1000000000ULL ),
+              (unsigned long long)( ( ps_record->ddw_timestampNs / 1000ULL ) % 1000000ULL ) );
+#endif
+
+    pc_literal = ps_record->pc_format;
+    for ( pc = ps_record->pc_format; *pc != '\0'; pc++ )
+    {
+        if ( *pc != '%' )
+            continue;
+
+        fwrite ( pc_literal, 1, (size_t)( pc - pc_literal ), ps_out );
+
+        ParseConversion ( pc, &s_conv );
+        if ( s_conv.e_class == k_CONV_NONE || s_conv.e_class == k_CONV_COUNT )
+        {
+            if ( s_conv.c_conversion == '%' )
+                fputc ( '%', ps_out );
+            pc += s_conv.w_length - 1;
+            pc_literal = pc + 1;
+            continue;
+        }
+        if ( ( b_arg + s_conv.b_numStars + 1 ) > ps_record->b_numArgs )
+        {
+            /* not captured, print the rest as is */
+            pc_literal = pc;
+            break;
+        }
+
+        /* the specification with the stars replaced and a canonical length modifier */
+        w_spec = 0;
+        for ( i = 0; i < s_conv.w_length - 1 && w_spec < sizeof(ac_spec) - 16; i++ )
+        {
+            if ( pc[i] == '*' )
+                w_spec += (uint16_t)snprintf ( &ac_spec[w_spec], sizeof(ac_spec) - w_spec, "%d",
+                                               (int)ps_record->as_args[b_arg++].ll_signed );
+            else if ( strchr ( "hlLqjzt", pc[i] ) == NULL )
+                ac_spec[w_spec++] = pc[i];
+        }
+        if ( s_conv.e_class == k_CONV_SIGNED || s_conv.e_class == k_CONV_UNSIGNED )
+        {
+            ac_spec[w_spec++] = 'l';
+            ac_spec[w_spec++] = 'l';
+        }
+        ac_spec[w_spec++] = s_conv.c_conversion;
+        ac_spec[w_spec] = '\0';
+
+        ps_arg = &ps_record->as_args[b_arg++];
+        switch ( s_conv.e_class )
+        {
+            case k_CONV_SIGNED:
+                fprintf ( ps_out, ac_spec, (long long)ps_arg->ll_signed );
+                break;
+            case k_CONV_UNSIGNED:
+                fprintf ( ps_out, ac_spec, (unsigned long long)ps_arg->ull_unsigned );
+                break;
+            case k_CONV_CHAR:
+                fprintf ( ps_out, ac_spec, (int)ps_arg->ll_signed );
+                break;
+            case k_CONV_DOUBLE:
+                fprintf ( ps_out, ac_spec, ps_arg->d_double );
+                break;
+            case k_CONV_POINTER:
+                fprintf ( ps_out, ac_spec, ps_arg->pv_pointer );
+                break;
+            case k_CONV_STRING:
+                fprintf ( ps_out, ac_spec, &ps_record->ac_strings[ps_arg->ull_unsigned] );
+                break;
+            default:
+                break;
+        }
+
+        pc += s_conv.w_length - 1;
+        pc_literal = pc + 1;
+    }
+
+    fputs ( pc_literal, ps_out );
+}
+
+/**
+ * \brief Writes a record to the screen and, if configured, to the file
+ */
+static void WriteRecord(const t_LOG_RECORD * ps_record)
+{
+    FormatRecord ( ps_record, stdout );
+    if ( ps_logFile != NULL )
+        FormatRecord ( ps_record, ps_logFile );
+}
+
+/**
+ * \brief Reports the messages dropped since the last report
+ */
+static void ReportDropped(void)
+{
+    static const char * const apc_levels[DATA_LOGGER_NUM_LEVELS] = { "error", "info", "debug" };
+    uint32_t dw_dropped;
+    int i;
+
+    for ( i = 0; i < DATA_LOGGER_NUM_LEVELS; i++ )
+    {
+        dw_dropped = __atomic_load_n ( &adw_dropped[i], __ATOMIC_RELAXED );
+        if ( dw_dropped != adw_droppedReported[i] )
+        {
+            fprintf ( stdout, "DataLogger: %u %s messages dropped, the ring is full\n",
+                      dw_dropped - adw_droppedReported[i], apc_levels[i] );
+            adw_droppedReported[i] = dw_dropped;
+        }
+    }
+}
+
+/**
+ * \brief Moves the records of the ring to the output, returns the number written
+ */
+static uint32_t DrainRing(void)
+{
+    t_LOG_RECORD * ps_record;
+    uint32_t dw_idx;
+    uint32_t dw_written = 0;
+
+    for ( ;; )
+    {
+        dw_idx = dw_dequeuePos & DATA_LOGGER_RING_MASK;
+        ps_record = &as_ring[dw_idx];
+        if ( __atomic_load_n ( &ps_record->dw_seq, __ATOMIC_ACQUIRE ) + dw_idx != dw_dequeuePos + 1 )
+            break;
+
+        WriteRecord ( ps_record );
+
+        __atomic_store_n ( &ps_record->dw_seq, dw_dequeuePos + DATA_LOGGER_RING_SIZE - dw_idx, __ATOMIC_RELEASE );
+        dw_dequeuePos++;
+        dw_written++;
+    }
+
+    return dw_written;
+}
+
+/**
+ * \brief The writer thread, formatting the records in the background
+ */
+static void * WriterThread(void * pv_arg)
+{
+    struct timespec s_deadline;
+    uint32_t dw_idx;
+
+    (void)pv_arg;
+
+    for ( ;; )
+    {
+        if ( DrainRing() > 0 )
+            continue;
+
+        ReportDropped();
+        fflush ( stdout );
+        if ( ps_logFile != NULL )
+            fflush ( ps_logFile );
+        __atomic_store_n ( &dw_flushedPos, dw_dequeuePos, __ATOMIC_RELEASE );
+
+        if ( __atomic_load_n ( &dw_writerStop, __ATOMIC_ACQUIRE ) )
+            break;
+
+        /* announce the sleep and check again, under the mutex the producers signal with */
+        pthread_mutex_lock ( &s_writerMutex );
+        __atomic_store_n ( &dw_writerSleeping, 1, __ATOMIC_SEQ_CST );
+        dw_idx = dw_dequeuePos & DATA_LOGGER_RING_MASK;
+        if ( __atomic_load_n ( &as_ring[dw_idx].dw_seq, __ATOMIC_SEQ_CST ) + dw_idx != dw_dequeuePos + 1 &&
+             ! __atomic_load_n ( &dw_writerStop, __ATOMIC_ACQUIRE ) )
+        {
+            clock_gettime ( CLOCK_REALTIME, &s_deadline );
+            s_deadline.tv_nsec += DATA_LOGGER_IDLE_MS * 1000000L;
+            if ( s_deadline.tv_nsec >= 1000000000L )
+            {
+                s_deadline.tv_sec++;
+                s_deadline.tv_nsec -= 1000000000L;
+            }
+            pthread_cond_timedwait ( &s_writerCond, &s_writerMutex, &s_deadline );
+        }
+        __atomic_store_n ( &dw_writerSleeping, 0, __ATOMIC_SEQ_CST );
+        pthread_mutex_unlock ( &s_writerMutex );
+    }
+
+    return NULL;
+}
+
+/**
+ * \brief Stops the writer at exit, after all records have been written
+ */
+static void StopWriter(void)
+{
+    __atomic_store_n ( &dw_writerStop, 1, __ATOMIC_RELEASE );
+    pthread_mutex_lock ( &s_writerMutex );
+    pthread_cond_signal ( &s_writerCond );
+    pthread_mutex_unlock ( &s_writerMutex );
+    pthread_join ( s_writerThread, NULL );
+
+    if ( ps_logFile != NULL )
+        fclose ( ps_logFile );
+    ps_logFile = NULL;
+}
+
+/**
+ * \brief Starts the writer with the first message
+ */
+static void StartWriter(void)
+{
+#ifdef DATA_LOGGER_OUTPUT_TO_FILE
+    ps_logFile = fopen ( DATA_LOGGER_FILE, "a" );
+#endif
+
+    if ( pthread_create ( &s_writerThread, NULL, WriterThread, NULL ) == 0 )
+    {
+        i_writerRunning = 1;
+        atexit ( StopWriter );
+    }
+}
+
+void DataLoggerLog(uint8_t b_level, const char * format, ...)
+{
+    t_LOG_RECORD * ps_record;
+    struct timespec s_now;
+    uint32_t dw_pos;
+    uint32_t dw_idx;
+    int32_t l_diff;
+    va_list args;
+
+    pthread_once ( &s_writerOnce, StartWriter );
+
+    /* without the writer, print on the calling thread */
+    if ( ! i_writerRunning )
+    {
+        va_start ( args, format );
+        vprintf ( format, args );
+        va_end ( args );
+        return;
+    }
+
+    /* claim a record */
+    dw_pos = __atomic_load_n ( &dw_enqueuePos, __ATOMIC_RELAXED );
+    for ( ;; )
+    {
+        dw_idx = dw_pos & DATA_LOGGER_RING_MASK;
+        ps_record = &as_ring[dw_idx];
+        l_diff = (int32_t)( __atomic_load_n ( &ps_record->dw_seq, __ATOMIC_ACQUIRE ) + dw_idx - dw_pos );
+        if ( l_diff == 0 )
+        {
+            if ( __atomic_compare_exchange_n ( &dw_enqueuePos, &dw_pos, dw_pos + 1, 1,
+                                               __ATOMIC_RELAXED, __ATOMIC_RELAXED ) )
+                break;
+        }
+        else if ( l_diff < 0 )
+        {
+            /* the ring is full */
+            if ( b_level >= DATA_LOGGER_LEVEL_ERROR && b_level <= DATA_LOGGER_LEVEL_DEBUG )
+                __atomic_fetch_add ( &adw_dropped[b_level - DATA_LOGGER_LEVEL_ERROR], 1, __ATOMIC_RELAXED );
+            return;
+        }
+        else
+        {
+            dw_pos = __atomic_load_n ( &dw_enqueuePos, __ATOMIC_RELAXED );
+        }
+    }
+
+    clock_gettime ( CLOCK_MONOTONIC, &s_now );
+    ps_record->ddw_timestampNs = (uint64_t)s_now.tv_sec * 1000000000ULL + (uint64_t)s_now.tv_nsec;
+    ps_record->b_level = b_level;
+    ps_record->pc_format = format;
+
+    va_start ( args, format );
+    CaptureArguments ( ps_record, format, &args );
+    va_end ( args );
+
+    __atomic_store_n ( &ps_record->dw_seq, dw_pos + 1 - dw_idx, __ATOMIC_SEQ_CST );
+
+    /* wake the writer, if it sleeps */
+    if ( __atomic_load_n ( &dw_writerSleeping, __ATOMIC_SEQ_CST ) )
+    {
+        pthread_mutex_lock ( &s_writerMutex );
+        pthread_cond_signal ( &s_writerCond );
+        pthread_mutex_unlock ( &s_writerMutex );
+    }
+}
+
+void DataLoggerFlush(void)
+{
+    struct timespec s_wait = { 0, 1000000L };
+    uint32_t dw_pos;
+
+    if ( ! i_writerRunning )
+    {
+        fflush ( stdout );
+        return;
+    }
+
+    /* wait until the writer wrote and flushed all records enqueued so far */
+    dw_pos = __atomic_load_n ( &dw_enqueuePos, __ATOMIC_ACQUIRE );
+    while ( (int32_t)( __atomic_load_n ( &dw_flushedPos, __ATOMIC_ACQUIRE ) - dw_pos ) < 0 )
+    {
+        pthread_mutex_lock ( &s_writerMutex );
+        pthread_cond_signal ( &s_writerCond );
+        pthread_mutex_unlock ( &s_writerMutex );
+        nanosleep ( &s_wait, NULL );
+    }
+}
+
+uint32_t DataLoggerDropped(uint8_t b_level)
+{
+    if ( b_level < DATA_LOGGER_LEVEL_ERROR || b_level > DATA_LOGGER_LEVEL_DEBUG )
+        return 0;
+
+    return __atomic_load_n ( &adw_dropped[b_level - DATA_LOGGER_LEVEL_ERROR], __ATOMIC_RELAXED );
+}
+
+#endif /* defined(_WIN32) */
@@ -85,31 +85,95 @@ DATALOGGER_EXPORT uint32_t DataLoggerFile(char * szFilename, char  * format, ...
  */
 DATALOGGER_EXPORT uint32_t DataLoggerStdOut(char  * format, ...);
 
+/**
+ * \brief DataLogger function behind the DATA_LOGGER macros. The format pointer, the
+ * arguments and a timestamp are stored in a ring, and formatted and written by a
+ * background thread. String arguments are copied, at most DATA_LOGGER_STRING_SPACE
+ * bytes per message. If the ring is full, the message is dropped and counted.
+ *
+ * \param b_level the level of the message, DATA_LOGGER_LEVEL_ERROR .. DEBUG
+ * \param format the format parameter for the output string, has to be a literal
+ */
+DATALOGGER_EXPORT void DataLoggerLog(uint8_t b_level, const char * format, ...);
+
+/**
+ * \brief DataLogger function waiting until all messages logged so far are written.
+ */
+DATALOGGER_EXPORT void DataLoggerFlush(void);
+
+/**
+ * \brief DataLogger function returning the number of messages dropped, as the ring
+ * was full.
+ *
+ * \param b_level the level of the messages
+ *
+ * \return the number of dropped messages
+ */
+DATALOGGER_EXPORT uint32_t DataLoggerDropped(uint8_t b_level);
+
 /** \brief Definitions for the output method */
 #define DATA_LOGGER_OUTPUT
 #undef DATA_LOGGER_OUTPUT_TO_FILE
 #undef DATA_LOGGER_PRINT_DEBUG
+#undef DATA_LOGGER_TIMESTAMPS
+
+/** \brief File the messages are appended to, with DATA_LOGGER_OUTPUT_TO_FILE */
+#define DATA_LOGGER_FILE "debug.log"
+
+/** \brief Number of records in the ring, has to be a power of two */
+#define DATA_LOGGER_RING_SIZE 1024
+/** \brief Maximum number of arguments of a message, including '*' widths */
+#define DATA_LOGGER_MAX_ARGS 8
+/** \brief Bytes per message for the copies of string arguments */
+#define DATA_LOGGER_STRING_SPACE 128
+
+/** \brief Levels of the messages. Messages above DATA_LOGGER_LEVEL are removed at
+ * compile time */
+#define DATA_LOGGER_LEVEL_NONE   0
+#define DATA_LOGGER_LEVEL_ERROR  1
+#define DATA_LOGGER_LEVEL_INFO   2
+#define DATA_LOGGER_LEVEL_DEBUG  3
+
+#ifndef DATA_LOGGER_LEVEL
+#ifndef DATA_LOGGER_OUTPUT
+#define DATA_LOGGER_LEVEL DATA_LOGGER_LEVEL_NONE
+#elif defined(DATA_LOGGER_PRINT_DEBUG)
+#define DATA_LOGGER_LEVEL DATA_LOGGER_LEVEL_DEBUG
+#else
+#define DATA_LOGGER_LEVEL DATA_LOGGER_LEVEL_INFO
+#endif
+#endif
 
-#ifdef DATA_LOGGER_OUTPUT
-#ifdef DATA_LOGGER_OUTPUT_TO_FILE
-#define DATA_LOGGER_OUTPUT "debug.log"
-#define DATA_LOGGER(fmt)            { DataLoggerStdOut(fmt); DataLoggerFile(fmt); }
-#define DATA_LOGGER1(fmt,a)         { DataLoggerStdOut(fmt,a); DataLoggerFile(fmt,a); }
-#define DATA_LOGGER2(fmt,a,b)       { DataLoggerStdOut(fmt,a,b); DataLoggerFile(fmt,a,b); }
-#define DATA_LOGGER3(fmt,a,b,c)     { DataLoggerStdOut(fmt,a,b,c); DataLoggerFile(fmt,a,b,c); }
-#define DATA_LOGGER4(fmt,a,b,c,d)   { DataLoggerStdOut(fmt,a,b,c,d); DataLoggerFile(fmt,a,b,c,d); }
+#if ( DATA_LOGGER_LEVEL >= DATA_LOGGER_LEVEL_ERROR )
+/** \brief Error data logger for a single string */
+#define DATA_LOGGER_ERROR(fmt)          DataLoggerLog(DATA_LOGGER_LEVEL_ERROR, fmt)
+/** \brief Error data logger for a single string and one argument */
+#define DATA_LOGGER_ERROR1(fmt,a)       DataLoggerLog(DATA_LOGGER_LEVEL_ERROR, fmt, a)
+/** \brief Error data logger for a single string and two arguments */
+#define DATA_LOGGER_ERROR2(fmt,a,b)     DataLoggerLog(DATA_LOGGER_LEVEL_ERROR, fmt, a, b)
+/** \brief Error data logger for a single string and three arguments */
+#define DATA_LOGGER_ERROR3(fmt,a,b,c)   DataLoggerLog(DATA_LOGGER_LEVEL_ERROR, fmt, a, b, c)
+/** \brief Error data logger for a single string and four arguments  */
+#define DATA_LOGGER_ERROR4(fmt,a,b,c,d) DataLoggerLog(DATA_LOGGER_LEVEL_ERROR, fmt, a, b, c, d)
 #else
+#define DATA_LOGGER_ERROR(fmt)
+#define DATA_LOGGER_ERROR1(fmt,a)
+#define DATA_LOGGER_ERROR2(fmt,a,b)
+#define DATA_LOGGER_ERROR3(fmt,a,b,c)
+#define DATA_LOGGER_ERROR4(fmt,a,b,c,d)
+#endif
+
+#if ( DATA_LOGGER_LEVEL >= DATA_LOGGER_LEVEL_INFO )
 /** \brief Data logger for a single string */
-#define DATA_LOGGER(fmt)            DataLoggerStdOut(fmt)
+#define DATA_LOGGER(fmt)            DataLoggerLog(DATA_LOGGER_LEVEL_INFO, fmt)
 /** \brief Data logger for a single string and one argument */
-#define DATA_LOGGER1(fmt,a)         DataLoggerStdOut(fmt,a)
+#define DATA_LOGGER1(fmt,a)         DataLoggerLog(DATA_LOGGER_LEVEL_INFO, fmt, a)
 /** \brief Data logger for a single string and two arguments */
-#define DATA_LOGGER2(fmt,a,b)       DataLoggerStdOut(fmt,a,b)
+#define DATA_LOGGER2(fmt,a,b)       DataLoggerLog(DATA_LOGGER_LEVEL_INFO, fmt, a, b)
 /** \brief Data logger for a single string and three arguments */
-#define DATA_LOGGER3(fmt,a,b,c)     DataLoggerStdOut(fmt,a,b,c)
+#define DATA_LOGGER3(fmt,a,b,c)     DataLoggerLog(DATA_LOGGER_LEVEL_INFO, fmt, a, b, c)
 /** \brief Data logger for a single string and four arguments  */
-#define DATA_LOGGER4(fmt,a,b,c,d)   DataLoggerStdOut(fmt,a,b,c,d)
-#endif
+#define DATA_LOGGER4(fmt,a,b,c,d)   DataLoggerLog(DATA_LOGGER_LEVEL_INFO, fmt, a, b, c, d)
 #else
 /** \brief Data logger for a single string */
 #define DATA_LOGGER(fmt)
@@ -123,17 +187,17 @@ DATALOGGER_EXPORT uint32_t DataLoggerStdOut(char  * format, ...);
 #define DATA_LOGGER4(fmt,a,b,c,d)
 #endif
 
-#ifdef DATA_LOGGER_PRINT_DEBUG
+#if ( DATA_LOGGER_LEVEL >= DATA_LOGGER_LEVEL_DEBUG )
 /** \brief Debug data logger for a single string */
-#define DATA_LOGGER_DEBUG(fmt)          DATA_LOGGER(fmt)
+#define DATA_LOGGER_DEBUG(fmt)          DataLoggerLog(DATA_LOGGER_LEVEL_DEBUG, fmt)
 /** \brief Debug data logger for a single string and one argument */
-#define DATA_LOGGER_DEBUG1(fmt,a)       DATA_LOGGER1(fmt,a)
+#define DATA_LOGGER_DEBUG1(fmt,a)       DataLoggerLog(DATA_LOGGER_LEVEL_DEBUG, fmt, a)
 /** \brief Debug data logger for a single string and two arguments */
-#define DATA_LOGGER_DEBUG2(fmt,a,b)     DATA_LOGGER2(fmt,a,b)
+#define DATA_LOGGER_DEBUG2(fmt,a,b)     DataLoggerLog(DATA_LOGGER_LEVEL_DEBUG, fmt, a, b)
 /** \brief Debug data logger for a single string and three arguments */
-#define DATA_LOGGER_DEBUG3(fmt,a,b,c)   DATA_LOGGER3(fmt,a,b,c)
+#define DATA_LOGGER_DEBUG3(fmt,a,b,c)   DataLoggerLog(DATA_LOGGER_LEVEL_DEBUG, fmt, a, b, c)
 /** \brief Debug data logger for a single string and four arguments  */
-#define DATA_LOGGER_DEBUG4(fmt,a,b,c,d) DATA_LOGGER4(fmt,a,b,c,d)
+#define DATA_LOGGER_DEBUG4(fmt,a,b,c,d) DataLoggerLog(DATA_LOGGER_LEVEL_DEBUG, fmt, a, b, c, d)
 #else
 /** \brief Debug data logger for a single string */
 #define DATA_LOGGER_DEBUG(fmt)
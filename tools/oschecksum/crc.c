@@ -4,11 +4,364 @@
  */
 
 #include <stdio.h>
+#include <string.h>
 
 #include <oschecksum/crc.h>
 
 #include <config.h>
 
+#include <crc16_BAAD_slice.h>
+#include <crc16_AC9A_slice.h>
+#include <crc16_755B_slice.h>
+#include <crc16_5935_slice.h>
+#include <crc32_slice.h>
+#include <crc32_PNG_slice.h>
+
+/*
+ * The table driven functions process 8 bytes per step with the slice-by-8 tables
+ * created by tablecreate. On x86 CPUs supporting PCLMULQDQ, buffers of at least
+ * CRC_CLMUL_MIN_LEN bytes are folded in blocks of 16 bytes by carry-less
+ * multiplication first, and only the last block and the remainder are passed to
+ * the tables. All paths are bit-exact with the bitwise calculators.
+ */
+#if ( defined(__GNUC__) && ( defined(__x86_64__) || defined(__i386__) ) ) || \
+    ( defined(_MSC_VER) && ( defined(_M_X64) || defined(_M_IX86) ) )
+#define CRC_CLMUL_SUPPORT
+#endif
+
+/** \brief Minimum length of a buffer to be folded by carry-less multiplication */
+#define CRC_CLMUL_MIN_LEN 48
+
+#ifdef CRC_CLMUL_SUPPORT
+
+#include <emmintrin.h>
+#include <tmmintrin.h>
+#include <wmmintrin.h>
+
+#if defined(__GNUC__)
+#include <cpuid.h>
+#define CRC_CLMUL_TARGET __attribute__((target("sse2,ssse3,pclmul")))
+#else
+#include <intrin.h>
+#define CRC_CLMUL_TARGET
+#endif
+
+/** \brief 0 - not detected yet, 1 - the CPU has no PCLMULQDQ, 2 - PCLMULQDQ is used, 3 - disabled */
+static volatile uint8_t clmulState = 0;
+
+/**
+ * \brief Detects PCLMULQDQ and SSSE3 by CPUID
+ * \return 2 if both are available, 1 otherwise
+ */
+static uint8_t crcClmulDetect(void)
+{
+    unsigned int ecx = 0;
+#if defined(__GNUC__)
+    unsigned int eax, ebx, edx;
+
+    if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx))
+        return 1;
+#else
+    int info[4];
+
+    __cpuid(info, 1);
+    ecx = (unsigned int) info[2];
+#endif
+    /* bit 1 PCLMULQDQ, bit 9 SSSE3 */
+    return ((ecx & 0x202U) == 0x202U) ? 2 : 1;
+}
+
+/**
+ * \brief Tells, if the carry-less multiply path is to be used for a buffer
+ * \param len the length of the buffer
+ * \return 1 if the path is to be used, 0 otherwise
+ */
+static uint8_t crcUseClmul(uint32_t len)
+{
+    if (len < CRC_CLMUL_MIN_LEN)
+        return 0;
+    if (clmulState == 0)
+        clmulState = crcClmulDetect();
+    return (clmulState == 2);
+}
+
+/**
+ * \brief Folds a 128 bit block by the given constants and adds the next block
+ */
+#define CRC_FOLD(acc, k, next) \
+    _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128((acc), (k), 0x00), \
+                                _mm_clmulepi64_si128((acc), (k), 0x11)), (next))
+
+/**
+ * \brief Folds a buffer of at least 16 bytes into 16 bytes by carry-less multiplication
+ *
+ * Not reflected CRCs are folded with the bytes in big-endian order (x^127 in the most
+ * significant bit of the first byte), reflected CRCs with the bytes as loaded. The
+ * folded block leaves the CRC unchanged, if it replaces the folded bytes of the
+ * buffer: the CRC over the block with an initial value of 0, continued over the
+ * remaining bytes, is the CRC of the buffer.
+ *
+ * \param len the length of the buffer, the number of bytes not folded on return
+ * \param pBuffer the buffer, the first byte not folded on return
+ * \param initTop initial value, aligned to the upper 32 bits of the CRC register
+ * \param fold the folding constants of the polynom, see tablecreate
+ * \param reflected 1 for a reflected CRC
+ * \param block the folded block
+ */
+static CRC_CLMUL_TARGET void crcFoldClmul(uint32_t * len, const uint8_t ** pBuffer, uint32_t initTop,
+                const uint64_t * fold, uint8_t reflected, uint8_t block[16])
+{
+    const __m128i swap = _mm_set_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+    const uint8_t * p = *pBuffer;
+    uint32_t n = *len;
+    __m128i k128, k512, acc0, acc1, acc2, acc3;
+
+    /* the constants for the high half of a block go to the lane it is multiplied with */
+    if (reflected)
+    {
+        k128 = _mm_set_epi64x((long long) fold[0], (long long) fold[1]);
+        k512 = _mm_set_epi64x((long long) fold[2], (long long) fold[3]);
+    }
+    else
+    {
+        k128 = _mm_set_epi64x((long long) fold[1], (long long) fold[0]);
+        k512 = _mm_set_epi64x((long long) fold[3], (long long) fold[2]);
+    }
+
+#define CRC_LOAD(ptr) ( reflected ? _mm_loadu_si128((const __m128i *)(ptr)) \
+                                  : _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(ptr)), swap) )
+
+    acc0 = CRC_LOAD(p);
+    if (reflected)
+        acc0 = _mm_xor_si128(acc0, _mm_cvtsi32_si128((int) initTop));
+    else
+        acc0 = _mm_xor_si128(acc0, _mm_slli_si128(_mm_cvtsi32_si128((int) initTop), 12));
+
+    /* four independent blocks per step, 64 bytes apart */
+    if (n >= 128)
+    {
+        acc1 = CRC_LOAD(p + 16);
+        acc2 = CRC_LOAD(p + 32);
+        acc3 = CRC_LOAD(p + 48);
+        p += 64;
+        n -= 64;
+        while (n >= 64)
+        {
+            acc0 = CRC_FOLD(acc0, k512, CRC_LOAD(p));
+            acc1 = CRC_FOLD(acc1, k512, CRC_LOAD(p + 16));
+            acc2 = CRC_FOLD(acc2, k512, CRC_LOAD(p + 32));
+            acc3 = CRC_FOLD(acc3, k512, CRC_LOAD(p + 48));
+            p += 64;
+            n -= 64;
+        }
+        acc0 = CRC_FOLD(acc0, k128, acc1);
+        acc0 = CRC_FOLD(acc0, k128, acc2);
+        acc0 = CRC_FOLD(acc0, k128, acc3);
+    }
+    else
+    {
+        p += 16;
+        n -= 16;
+    }
+
+    while (n >= 16)
+    {
+        acc0 = CRC_FOLD(acc0, k128, CRC_LOAD(p));
+        p += 16;
+        n -= 16;
+    }
+
+#undef CRC_LOAD
+
+    if (!reflected)
+        acc0 = _mm_shuffle_epi8(acc0, swap);
+    _mm_storeu_si128((__m128i *) block, acc0);
+
+    *pBuffer = p;
+    *len = n;
+}
+
+#endif /* CRC_CLMUL_SUPPORT */
+
+uint8_t crcClmulEnable(uint8_t enable)
+{
+#ifdef CRC_CLMUL_SUPPORT
+    uint8_t detected = crcClmulDetect();
+
+    clmulState = (enable && (detected == 2)) ? 2 : (enable ? 1 : 3);
+    return (clmulState == 2);
+#else
+    enable = enable;
+    return 0;
+#endif
+}
+
+/**
+ * \brief Calculates a not reflected CRC16 with slice-by-8 tables, 8 and 4 bytes per step
+ */
+#define CRC16_SLICE8_STEP(crc, p, table) \
+    ( (table)[7][(p)[0] ^ ((crc) >> 8)] ^ (table)[6][(p)[1] ^ ((crc) & 0xFF)] ^ \
+      (table)[5][(p)[2]] ^ (table)[4][(p)[3]] ^ (table)[3][(p)[4]] ^ \
+      (table)[2][(p)[5]] ^ (table)[1][(p)[6]] ^ (table)[0][(p)[7]] )
+
+static uint16_t crc16Slice8(uint32_t len, const uint8_t * pBuffer, uint16_t crc,
+                const uint16_t table[8][256])
+{
+    while (len >= 8)
+    {
+        crc = CRC16_SLICE8_STEP(crc, pBuffer, table);
+        pBuffer += 8;
+        len -= 8;
+    }
+    if (len >= 4)
+    {
+        crc = table[3][pBuffer[0] ^ (crc >> 8)] ^ table[2][pBuffer[1] ^ (crc & 0xFF)] ^
+              table[1][pBuffer[2]] ^ table[0][pBuffer[3]];
+        pBuffer += 4;
+        len -= 4;
+    }
+    while (len-- > 0)
+        crc = (uint16_t)(crc << 8) ^ table[0][(*pBuffer++) ^ (crc >> 8)];
+
+    return crc;
+}
+
+/**
+ * \brief Calculates the not reflected CRC16s of two buffers, each a header followed by
+ * payload data of the same length, and compares the payload data in the same pass
+ *
+ * The two CRCs do not depend on each other, the table lookups of both are interleaved
+ * in every 8 byte step.
+ *
+ * \return 1 if the payload data of both buffers is identical, 0 otherwise
+ */
+static uint8_t crc16Slice8Dual(uint32_t hdrLen1, const uint8_t * pBuffer1, uint32_t hdrLen2,
+                const uint8_t * pBuffer2, uint32_t dataLen, uint16_t * pCRC1, uint16_t * pCRC2,
+                const uint16_t table[8][256])
+{
+    uint16_t crc1 = crc16Slice8(hdrLen1, pBuffer1, *pCRC1, table);
+    uint16_t crc2 = crc16Slice8(hdrLen2, pBuffer2, *pCRC2, table);
+    uint64_t data1, data2, diff = 0;
+
+    pBuffer1 += hdrLen1;
+    pBuffer2 += hdrLen2;
+    while (dataLen >= 8)
+    {
+        memcpy(&data1, pBuffer1, sizeof(data1));
+        memcpy(&data2, pBuffer2, sizeof(data2));
+        diff |= data1 ^ data2;
+        crc1 = CRC16_SLICE8_STEP(crc1, pBuffer1, table);
+        crc2 = CRC16_SLICE8_STEP(crc2, pBuffer2, table);
+        pBuffer1 += 8;
+        pBuffer2 += 8;
+        dataLen -= 8;
+    }
+    while (dataLen-- > 0)
+    {
+        diff |= (uint64_t)(*pBuffer1 ^ *pBuffer2);
+        crc1 = (uint16_t)(crc1 << 8) ^ table[0][(*pBuffer1++) ^ (crc1 >> 8)];
+        crc2 = (uint16_t)(crc2 << 8) ^ table[0][(*pBuffer2++) ^ (crc2 >> 8)];
+    }
+
+    *pCRC1 = crc1;
+    *pCRC2 = crc2;
+    return (diff == 0);
+}
+
+/**
+ * \brief Calculates a not reflected CRC32 with slice-by-8 tables, 8 and 4 bytes per step
+ */
+static uint32_t crc32Slice8(uint32_t len, const uint8_t * pBuffer, uint32_t crc,
+                const uint32_t table[8][256])
+{
+    while (len >= 8)
+    {
+        crc = table[7][pBuffer[0] ^ (crc >> 24)] ^ table[6][pBuffer[1] ^ ((crc >> 16) & 0xFF)] ^
+              table[5][pBuffer[2] ^ ((crc >> 8) & 0xFF)] ^ table[4][pBuffer[3] ^ (crc & 0xFF)] ^
+              table[3][pBuffer[4]] ^ table[2][pBuffer[5]] ^ table[1][pBuffer[6]] ^ table[0][pBuffer[7]];
+        pBuffer += 8;
+        len -= 8;
+    }
+    if (len >= 4)
+    {
+        crc = table[3][pBuffer[0] ^ (crc >> 24)] ^ table[2][pBuffer[1] ^ ((crc >> 16) & 0xFF)] ^
+              table[1][pBuffer[2] ^ ((crc >> 8) & 0xFF)] ^ table[0][pBuffer[3] ^ (crc & 0xFF)];
+        pBuffer += 4;
+        len -= 4;
+    }
+    while (len-- > 0)
+        crc = (crc << 8) ^ table[0][(*pBuffer++) ^ (crc >> 24)];
+
+    return crc;
+}
+
+/**
+ * \brief Calculates a reflected CRC32 with slice-by-8 tables, 8 and 4 bytes per step
+ */
+static uint32_t crc32Slice8Reflected(uint32_t len, const uint8_t * pBuffer, uint32_t crc,
+                const uint32_t table[8][256])
+{
+    while (len >= 8)
+    {
+        crc = table[7][pBuffer[0] ^ (crc & 0xFF)] ^ table[6][pBuffer[1] ^ ((crc >> 8) & 0xFF)] ^
+              table[5][pBuffer[2] ^ ((crc >> 16) & 0xFF)] ^ table[4][pBuffer[3] ^ (crc >> 24)] ^
+              table[3][pBuffer[4]] ^ table[2][pBuffer[5]] ^ table[1][pBuffer[6]] ^ table[0][pBuffer[7]];
+        pBuffer += 8;
+        len -= 8;
+    }
+    if (len >= 4)
+    {
+        crc = table[3][pBuffer[0] ^ (crc & 0xFF)] ^ table[2][pBuffer[1] ^ ((crc >> 8) & 0xFF)] ^
+              table[1][pBuffer[2] ^ ((crc >> 16) & 0xFF)] ^ table[0][pBuffer[3] ^ (crc >> 24)];
+        pBuffer += 4;
+        len -= 4;
+    }
+    while (len-- > 0)
+        crc = table[0][((*pBuffer++) ^ crc) & 0xFF] ^ (crc >> 8);
+
+    return crc;
+}
+
+/**
+ * \brief Calculates a not reflected CRC16, by carry-less multiplication if available
+ */
+static uint16_t crc16Engine(uint32_t len, const uint8_t * pBuffer, uint16_t crc,
+                const uint16_t table[8][256], const uint64_t * fold)
+{
+#ifdef CRC_CLMUL_SUPPORT
+    uint8_t block[16];
+
+    if (crcUseClmul(len))
+    {
+        crcFoldClmul(&len, &pBuffer, (uint32_t) crc << 16, fold, 0, block);
+        crc = crc16Slice8(sizeof(block), block, 0, table);
+    }
+#else
+    fold = fold;
+#endif
+    return crc16Slice8(len, pBuffer, crc, table);
+}
+
+/**
+ * \brief Calculates a not reflected CRC32, by carry-less multiplication if available
+ */
+static uint32_t crc32Engine(uint32_t len, const uint8_t * pBuffer, uint32_t crc,
+                const uint32_t table[8][256], const uint64_t * fold)
+{
+#ifdef CRC_CLMUL_SUPPORT
+    uint8_t block[16];
+
+    if (crcUseClmul(len))
+    {
+        crcFoldClmul(&len, &pBuffer, crc, fold, 0, block);
+        crc = crc32Slice8(sizeof(block), block, 0, table);
+    }
+#else
+    fold = fold;
+#endif
+    return crc32Slice8(len, pBuffer, crc, table);
+}
+
 uint32_t crc32ChecksumCalculator(uint32_t len, const uint8_t * pBuffer,
                 uint32_t initCRC)
 {
@@ -17,7 +370,7 @@ uint32_t crc32ChecksumCalculator(uint32_t len, const uint8_t * pBuffer,
     while (len-- > 0)
     {
         /* shift left by ( ( sizeof (crc ) * 2 ) - 8 ) */
-        crc ^= (*pBuffer) << 24;
+        crc ^= (uint32_t)(*pBuffer) << 24;
         for (k = 0; k < 8; k++)
         {
             //printf ( "Bit: %02d ; CRC: 0x%04X \n", k, crc, (crc & 0x8000), ((data >> k) & 0x01));
@@ -26,22 +379,14 @@ uint32_t crc32ChecksumCalculator(uint32_t len, const uint8_t * pBuffer,
             else
                 crc = (crc << 1);
         }
+        pBuffer++;
     }
     return crc;
 }
 
 uint32_t crc32Checksum(uint32_t len, const uint8_t * pBuffer, uint32_t initCRC)
 {
-    uint32_t crc = initCRC;
-
-    while (len-- > 0)
-    {
-        uint32_t ulTab = PrecompiledCRC32[(*pBuffer) ^ (crc >> 24)];
-        crc = (crc << 8) ^ ulTab;
-        pBuffer++;
-    }
-
-    return crc;
+    return crc32Engine(len, pBuffer, initCRC, SliceTable_CRC32, FoldConstants_CRC32);
 }
 
 uint32_t crc32ChecksumPNG_Calculator(uint32_t len, const uint8_t * pBuffer, uint32_t initCRC)
@@ -68,13 +413,17 @@ uint32_t crc32ChecksumPNG(uint32_t len, const uint8_t * pBuffer, uint32_t initCR
 {
     //initial value has to be 0, as the algorithm first of all inverts the crc value
     uint32_t crc = initCRC ^ 0xffffffff;
+#ifdef CRC_CLMUL_SUPPORT
+    uint8_t block[16];
 
-    while (len-- > 0)
+    if (crcUseClmul(len))
     {
-        crc = PrecompiledCRC32PNG[ ( crc ^ *pBuffer ) & 0xff ] ^ ( crc >> 8 );
-        //next byte
-        pBuffer++;
+        crcFoldClmul(&len, &pBuffer, crc, FoldConstants_CRC32_PNG, 1, block);
+        crc = crc32Slice8Reflected(sizeof(block), block, 0, SliceTable_CRC32_PNG);
     }
+#endif
+
+    crc = crc32Slice8Reflected(len, pBuffer, crc, SliceTable_CRC32_PNG);
 
     //another inversion will retrieve the crc
     return crc ^ 0xffffffff;
@@ -119,36 +468,31 @@ uint16_t crc16ChecksumCalculator(uint32_t len, const uint8_t * pBuffer,
 uint16_t crc16ChecksumPoly(uint32_t len, const uint8_t * pBuffer,
                 uint16_t initCRC, uint16_t Polynom)
 {
-    uint16_t crc = initCRC;
-    uint16_t ulTab = 0;
-
-    while (len-- > 0)
+    switch (Polynom)
     {
-        switch (Polynom)
-        {
-        case (CRC16_POLY_AC9A):
+    case (CRC16_POLY_AC9A):
 #ifndef CRC_ROTATED_ENABLE
-            ulTab = PrecompiledCRC16_AC9A[(*pBuffer++) ^ (crc >> 8)];
+        return crc16Engine(len, pBuffer, initCRC, SliceTable_CRC16_AC9A, FoldConstants_CRC16_AC9A);
 #else
-            ulTab = PrecompiledCRC16_5935[(*pBuffer++) ^ (crc >> 8)];
+        return crc16Engine(len, pBuffer, initCRC, SliceTable_CRC16_5935, FoldConstants_CRC16_5935);
 #endif
-            crc = (crc << 8) ^ ulTab;
-            break;
 
-        case (CRC16_POLY_BAAD):
+    case (CRC16_POLY_BAAD):
 #ifndef CRC_ROTATED_ENABLE
-            ulTab = PrecompiledCRC16_BAAD[(*pBuffer++) ^ (crc >> 8)];
+        return crc16Engine(len, pBuffer, initCRC, SliceTable_CRC16_BAAD, FoldConstants_CRC16_BAAD);
 #else
-            ulTab = PrecompiledCRC16_755B[(*pBuffer++) ^ (crc >> 8)];
+        return crc16Engine(len, pBuffer, initCRC, SliceTable_CRC16_755B, FoldConstants_CRC16_755B);
 #endif
-            crc = (crc << 8) ^ ulTab;
-            break;
-        default:
-            return (uint16_t) 0;
-        }
-    }
 
-    return crc;
+    case (CRC16_POLY_755B):
+        return crc16Engine(len, pBuffer, initCRC, SliceTable_CRC16_755B, FoldConstants_CRC16_755B);
+
+    case (CRC16_POLY_5935):
+        return crc16Engine(len, pBuffer, initCRC, SliceTable_CRC16_5935, FoldConstants_CRC16_5935);
+
+    default:
+        return (len > 0) ? (uint16_t) 0 : initCRC;
+    }
 }
 
 uint16_t crc16Checksum_AC9A(uint32_t len, const uint8_t * pBuffer,
@@ -162,6 +506,16 @@ uint16_t crc16Checksum(uint32_t len, const uint8_t * pBuffer, uint16_t initCRC)
     return crc16ChecksumPoly(len, pBuffer, initCRC, CRC16_POLY_BAAD);
 }
 
+uint8_t crc16ChecksumDual(uint32_t hdrLen1, const uint8_t * pBuffer1, uint32_t hdrLen2,
+                const uint8_t * pBuffer2, uint32_t dataLen, uint16_t * pCRC1, uint16_t * pCRC2)
+{
+#ifndef CRC_ROTATED_ENABLE
+    return crc16Slice8Dual(hdrLen1, pBuffer1, hdrLen2, pBuffer2, dataLen, pCRC1, pCRC2, SliceTable_CRC16_BAAD);
+#else
+    return crc16Slice8Dual(hdrLen1, pBuffer1, hdrLen2, pBuffer2, dataLen, pCRC1, pCRC2, SliceTable_CRC16_755B);
+#endif
+}
+
 uint8_t crc8ChecksumCalculator(uint32_t len, const uint8_t * pBuffer,
                 uint8_t initCRC)
 {
@@ -195,3 +549,25 @@ uint8_t crc8Checksum(uint32_t len, const uint8_t * pBuffer, uint8_t initCRC)
 
     return crc;
 }
+
+uint8_t crc8ChecksumDual(uint32_t hdrLen1, const uint8_t * pBuffer1, uint32_t hdrLen2,
+                const uint8_t * pBuffer2, uint32_t dataLen, uint8_t * pCRC1, uint8_t * pCRC2)
+{
+    uint8_t crc1 = crc8Checksum(hdrLen1, pBuffer1, *pCRC1);
+    uint8_t crc2 = crc8Checksum(hdrLen2, pBuffer2, *pCRC2);
+    uint8_t diff = 0;
+
+    /* short payload data, both CRCs and the comparison are done byte by byte */
+    pBuffer1 += hdrLen1;
+    pBuffer2 += hdrLen2;
+    while (dataLen-- > 0)
+    {
+        diff |= (uint8_t)(*pBuffer1 ^ *pBuffer2);
+        crc1 = PrecompiledCRC8[(*pBuffer1++) ^ crc1];
+        crc2 = PrecompiledCRC8[(*pBuffer2++) ^ crc2];
+    }
+
+    *pCRC1 = crc1;
+    *pCRC2 = crc2;
+    return (diff == 0);
+}
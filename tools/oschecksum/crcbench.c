@@ -0,0 +1,328 @@
+/**
+ * \file crcbench.c
+ * \addtogroup Tools
+ * \{
+ * \addtogroup oschecksum
+ * \{
+ * \addtogroup crcbench CrcBench
+ * This small utility checks the table driven CRC16 and CRC32 functions of the checksum library against
+ * the byte-wise table algorithm and the bitwise calculators, and measures their throughput. It has to be
+ * built explicitly via the Makefile option "crcbench" and will not be part of the default build.
+ * \{
+ * \details
+ * \{
+ * This source code is free software; you can redistribute it and/or modify it
+ * under the terms of the BSD license (according to License.txt).
+ * \}
+ * \version 1.0
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+
+#include <oschecksum/crc.h>
+
+#include <config.h>
+
+/** \brief Size of the test buffer, the largest length checked and measured */
+#define BENCH_BUFFER_SIZE 65536
+
+/** \brief Largest length checked against the byte-wise algorithm for every length */
+#define CHECK_MAX_LEN 1100
+
+/** \brief Minimum time of a measurement in clock ticks */
+#define BENCH_MIN_TICKS ( CLOCKS_PER_SEC / 5 )
+
+/** \brief The CRC types checked and measured */
+enum eCRC_TYPE
+{
+        CRC16_BAAD,     /**< CRC16, polynom 0xBAAD */
+        CRC16_AC9A,     /**< CRC16, polynom 0xAC9A */
+        CRC16_755B,     /**< CRC16, polynom 0x755B */
+        CRC16_5935,     /**< CRC16, polynom 0x5935 */
+        CRC32,          /**< CRC32, polynom 0x1EDC6F41 */
+        CRC32_PNG,      /**< CRC32, PNG polynom */
+        CRC_TYPES
+};
+
+/** \brief Names of the CRC types */
+static const char * const typeNames[CRC_TYPES] =
+{
+        "CRC16 0xBAAD", "CRC16 0xAC9A", "CRC16 0x755B", "CRC16 0x5935", "CRC32", "CRC32 PNG"
+};
+
+/** \brief Polynoms of the CRC16 types */
+static const uint16_t crc16Polys[] = { CRC16_POLY_BAAD, CRC16_POLY_AC9A, CRC16_POLY_755B, CRC16_POLY_5935 };
+
+/** \brief Lengths measured, the length of an SPDO sub frame, an SSDO frame and of SOD areas */
+static const uint32_t benchLengths[] = { 11, 32, 64, 254, 1024, BENCH_BUFFER_SIZE };
+
+/** \brief The test buffer */
+static uint8_t buffer[BENCH_BUFFER_SIZE + 16];
+
+/**
+ * \brief Returns the byte table of a CRC16 polynom, as used by the library before the slice-by-8 engine
+ * \param poly the polynom
+ * \return the table
+ */
+static const uint16_t * crc16ByteTable ( uint16_t poly )
+{
+        switch ( poly )
+        {
+#ifndef CRC_ROTATED_ENABLE
+        case CRC16_POLY_BAAD: return PrecompiledCRC16_BAAD;
+        case CRC16_POLY_AC9A: return PrecompiledCRC16_AC9A;
+#else
+        case CRC16_POLY_BAAD: return PrecompiledCRC16_755B;
+        case CRC16_POLY_AC9A: return PrecompiledCRC16_5935;
+#endif
+        case CRC16_POLY_755B: return PrecompiledCRC16_755B;
+        default: return PrecompiledCRC16_5935;
+        }
+}
+
+/**
+ * \brief Calculates a CRC byte by byte with the precompiled tables, the reference for the table driven functions
+ * \param type the CRC type
+ * \param len the length of the buffer
+ * \param pBuffer the buffer
+ * \param initCRC the initial value
+ * \return the CRC
+ */
+static uint32_t crcByteWise ( enum eCRC_TYPE type, uint32_t len, const uint8_t * pBuffer, uint32_t initCRC )
+{
+        const uint16_t * table16;
+        uint32_t crc = initCRC;
+
+        if ( type == CRC32 )
+        {
+                while ( len-- > 0 )
+                        crc = ( crc << 8 ) ^ PrecompiledCRC32[(*pBuffer++) ^ ( crc >> 24 )];
+        }
+        else if ( type == CRC32_PNG )
+        {
+                crc ^= 0xffffffff;
+                while ( len-- > 0 )
+                        crc = PrecompiledCRC32PNG[( crc ^ *pBuffer++ ) & 0xff] ^ ( crc >> 8 );
+                crc ^= 0xffffffff;
+        }
+        else
+        {
+                table16 = crc16ByteTable ( crc16Polys[type] );
+                while ( len-- > 0 )
+                        crc = ( ( crc << 8 ) & 0xffff ) ^ table16[(*pBuffer++) ^ ( crc >> 8 )];
+        }
+        return crc;
+}
+
+/**
+ * \brief Calculates a CRC bit by bit with the calculators, PNG is not available bitwise
+ * \param type the CRC type
+ * \param len the length of the buffer
+ * \param pBuffer the buffer
+ * \param initCRC the initial value
+ * \return the CRC
+ */
+static uint32_t crcBitWise ( enum eCRC_TYPE type, uint32_t len, const uint8_t * pBuffer, uint32_t initCRC )
+{
+        if ( type == CRC32 )
+                return crc32ChecksumCalculator ( len, pBuffer, initCRC );
+        if ( type == CRC32_PNG )
+                return crcByteWise ( type, len, pBuffer, initCRC );
+        return crc16ChecksumCalculatorPoly ( len, pBuffer, (uint16_t) initCRC, crc16Polys[type] );
+}
+
+/**
+ * \brief Calculates a CRC with the table driven function of the library
+ * \param type the CRC type
+ * \param len the length of the buffer
+ * \param pBuffer the buffer
+ * \param initCRC the initial value
+ * \return the CRC
+ */
+static uint32_t crcLibrary ( enum eCRC_TYPE type, uint32_t len, const uint8_t * pBuffer, uint32_t initCRC )
+{
+        if ( type == CRC32 )
+                return crc32Checksum ( len, pBuffer, initCRC );
+        if ( type == CRC32_PNG )
+                return crc32ChecksumPNG ( len, pBuffer, initCRC );
+        return crc16ChecksumPoly ( len, pBuffer, (uint16_t) initCRC, crc16Polys[type] );
+}
+
+/**
+ * \brief Checks the library against the byte-wise algorithm for every length up to CHECK_MAX_LEN,
+ * random initial values and all alignments
+ * \param type the CRC type
+ * \return the number of mismatches
+ */
+static uint32_t checkType ( enum eCRC_TYPE type )
+{
+        uint32_t len, init, expected, result;
+        uint32_t errors = 0;
+        const uint8_t * pBuffer;
+
+        for ( len = 0; len <= CHECK_MAX_LEN; len++ )
+        {
+                pBuffer = buffer + ( len % 16 );
+                init = ( (uint32_t) rand() << 16 ) ^ (uint32_t) rand();
+                if ( type < CRC32 )
+                        init &= 0xffff;
+                if ( len % 3 == 0 )
+                        init = 0;
+
+                expected = crcByteWise ( type, len, pBuffer, init );
+                result = crcLibrary ( type, len, pBuffer, init );
+                if ( result != expected )
+                {
+                        if ( errors == 0 )
+                                printf ( "  %s length %lu init 0x%08lX : 0x%08lX expected 0x%08lX\n", typeNames[type],
+                                         (unsigned long) len, (unsigned long) init, (unsigned long) result, (unsigned long) expected );
+                        errors++;
+                }
+
+                /* the bitwise calculators use the polynom given, not the rotated one */
+                if ( ( type != CRC16_BAAD ) && ( type != CRC16_AC9A ) && ( len <= 300 ) &&
+                     ( crcBitWise ( type, len, pBuffer, init ) != expected ) )
+                {
+                        if ( errors == 0 )
+                                printf ( "  %s length %lu : bitwise calculator differs\n", typeNames[type], (unsigned long) len );
+                        errors++;
+                }
+        }
+
+        return errors;
+}
+
+/**
+ * \brief Checks the dual sub frame functions against the single buffer functions and the comparison of
+ * the payload data, for every payload data length of an openSAFETY frame, with and without a difference
+ * \return the number of mismatches
+ */
+static uint32_t checkDual ( void )
+{
+        uint32_t len, flip;
+        uint32_t errors = 0;
+        uint8_t sub1[4 + 254], sub2[5 + 254];
+        uint8_t crc8a, crc8b, ident;
+        uint16_t crc16a, crc16b;
+
+        for ( len = 0; len <= 254; len++ )
+        {
+                for ( flip = 0; flip < 2; flip++ )
+                {
+                        memcpy ( sub1, buffer, 4 + len );
+                        memcpy ( sub2, buffer + 1024, 5 );
+                        memcpy ( sub2 + 5, sub1 + 4, len );
+                        if ( flip && len )
+                                sub2[5 + ( (uint32_t) rand() % len )] ^= 0x10;
+
+                        crc8a = crc8b = 0;
+                        ident = crc8ChecksumDual ( 4, sub1, 5, sub2, len, &crc8a, &crc8b );
+                        crc16a = crc16b = 0;
+                        if ( ( crc8a != crc8Checksum ( 4 + len, sub1, 0 ) ) ||
+                             ( crc8b != crc8Checksum ( 5 + len, sub2, 0 ) ) ||
+                             ( ident != ( memcmp ( sub1 + 4, sub2 + 5, len ) == 0 ) ) ||
+                             ( crc16ChecksumDual ( 4, sub1, 5, sub2, len, &crc16a, &crc16b ) != ident ) ||
+                             ( crc16a != crc16Checksum ( 4 + len, sub1, 0 ) ) ||
+                             ( crc16b != crc16Checksum ( 5 + len, sub2, 0 ) ) )
+                        {
+                                if ( errors == 0 )
+                                        printf ( "  Dual sub frame length %lu : differs\n", (unsigned long) len );
+                                errors++;
+                        }
+                }
+        }
+
+        return errors;
+}
+
+/**
+ * \brief Measures a CRC function
+ * \param type the CRC type
+ * \param func the function
+ * \param len the length of the buffer
+ * \return the throughput in MB/s
+ */
+static double measure ( enum eCRC_TYPE type, uint32_t ( * func ) ( enum eCRC_TYPE, uint32_t, const uint8_t *, uint32_t ),
+                        uint32_t len )
+{
+        volatile uint32_t sink = 0;
+        uint32_t rounds = 1, i;
+        clock_t start, ticks;
+
+        for ( ;; )
+        {
+                start = clock();
+                for ( i = 0; i < rounds; i++ )
+                        sink ^= func ( type, len, buffer, i & 0xffff );
+                ticks = clock() - start;
+                if ( ticks >= BENCH_MIN_TICKS )
+                        break;
+                rounds *= 2;
+        }
+
+        return ( (double) len * rounds ) / ( (double) ticks / CLOCKS_PER_SEC ) / 1e6;
+}
+
+/**
+ * \brief CrcBench checks the table driven CRC functions and prints their throughput in MB/s
+ * \param argc number of arguments given
+ * \param argv arguments given, "-c" only checks
+ * \return 1 if a CRC differs, 0 otherwise
+ */
+int main (int argc, char ** argv)
+{
+        uint32_t errors = 0;
+        uint8_t clmul;
+        int type;
+        size_t l;
+
+        srand ( 0x0AFE );
+        for ( l = 0; l < sizeof(buffer); l++ )
+                buffer[l] = (uint8_t) rand();
+
+        for ( clmul = 0; clmul < 2; clmul++ )
+        {
+                if ( crcClmulEnable ( clmul ) != clmul )
+                {
+                        printf ( "Carry-less multiplication not available\n" );
+                        continue;
+                }
+                printf ( "Checking %s\n", clmul ? "carry-less multiplication" : "slice-by-8" );
+                for ( type = 0; type < CRC_TYPES; type++ )
+                        errors += checkType ( (enum eCRC_TYPE) type );
+        }
+        errors += checkDual();
+        printf ( "%s\n\n", errors ? "FAILED" : "All CRCs are bit-exact" );
+
+        if ( errors || ( ( argc > 1 ) && ( strcmp ( argv[1], "-c" ) == 0 ) ) )
+                return errors ? 1 : 0;
+
+        printf ( "%-13s %8s %10s %10s %10s %10s\n", "[MB/s]", "length", "bitwise", "bytewise", "slice-by-8", "clmul" );
+        for ( type = 0; type < CRC_TYPES; type++ )
+        {
+                for ( l = 0; l < sizeof(benchLengths) / sizeof(benchLengths[0]); l++ )
+                {
+                        printf ( "%-13s %8lu", typeNames[type], (unsigned long) benchLengths[l] );
+                        printf ( " %10.1f", measure ( (enum eCRC_TYPE) type, crcBitWise, benchLengths[l] ) );
+                        printf ( " %10.1f", measure ( (enum eCRC_TYPE) type, crcByteWise, benchLengths[l] ) );
+                        crcClmulEnable ( 0 );
+                        printf ( " %10.1f", measure ( (enum eCRC_TYPE) type, crcLibrary, benchLengths[l] ) );
+                        if ( crcClmulEnable ( 1 ) )
+                                printf ( " %10.1f\n", measure ( (enum eCRC_TYPE) type, crcLibrary, benchLengths[l] ) );
+                        else
+                                printf ( " %10s\n", "-" );
+                }
+        }
+
+        return 0;
+}
+
+/**
+ * \}
+ * \}
+ * \}
+ */
@@ -165,6 +165,24 @@ OSCHECKSUM_EXPORT uint16_t crc16Checksum(uint32_t len, const uint8_t * pBuffer,
  */
 OSCHECKSUM_EXPORT uint16_t crc16Checksum_AC9A(uint32_t len, const uint8_t * pBuffer, uint16_t initCRC);
 
+/**
+ * \brief Calculates the CRC16 checksums of two buffers, each made of a header followed by payload data
+ * of the same length, and compares the payload data of both buffers in the same pass. This is the check
+ * of an openSAFETY frame, carrying its payload data in both sub frames.
+ *
+ * \param hdrLen1 the length of the header of the first buffer
+ * \param pBuffer1 a pointer to the first buffer, hdrLen1 + dataLen bytes long
+ * \param hdrLen2 the length of the header of the second buffer
+ * \param pBuffer2 a pointer to the second buffer, hdrLen2 + dataLen bytes long
+ * \param dataLen the length of the payload data
+ * \param pCRC1 initial value for the CRC of the first buffer, returns its CRC16 checksum
+ * \param pCRC2 initial value for the CRC of the second buffer, returns its CRC16 checksum
+ *
+ * \return 1 if the payload data of both buffers is identical, 0 otherwise
+ */
+OSCHECKSUM_EXPORT uint8_t crc16ChecksumDual(uint32_t hdrLen1, const uint8_t * pBuffer1, uint32_t hdrLen2,
+                const uint8_t * pBuffer2, uint32_t dataLen, uint16_t * pCRC1, uint16_t * pCRC2);
+
 /**
  * \brief Calculates a CRC16 checksum for the given buffer
  *
@@ -194,6 +212,16 @@ OSCHECKSUM_EXPORT uint16_t crc16ChecksumCalculator_AC9A(uint32_t len, const uint
  */
 OSCHECKSUM_EXPORT uint16_t crc16SanityCheck(void);
 
+/**
+ * \brief Enables or disables the carry-less multiply path of the table driven CRC16 and CRC32
+ * functions. It is enabled by default, if the CPU supports it. The results do not depend on it.
+ *
+ * \param enable 1 to use the carry-less multiply path if supported, 0 to use the slice-by-8 tables only
+ *
+ * \return 1 if the carry-less multiply path is in use, 0 otherwise
+ */
+OSCHECKSUM_EXPORT uint8_t crcClmulEnable(uint8_t enable);
+
 /**
  * \brief Calculates a CRC8 checksum for the given buffer using the precompiled table
  *
@@ -216,6 +244,17 @@ OSCHECKSUM_EXPORT uint8_t crc8Checksum(uint32_t len, const uint8_t * pBuffer, ui
  */
 OSCHECKSUM_EXPORT uint8_t crc8ChecksumCalculator(uint32_t len, const uint8_t * pBuffer, uint8_t initCRC);
 
+/**
+ * \brief Calculates the CRC8 checksums of two buffers, each made of a header followed by payload data
+ * of the same length, and compares the payload data of both buffers in the same pass
+ *
+ * \see crc16ChecksumDual
+ *
+ * \return 1 if the payload data of both buffers is identical, 0 otherwise
+ */
+OSCHECKSUM_EXPORT uint8_t crc8ChecksumDual(uint32_t hdrLen1, const uint8_t * pBuffer1, uint32_t hdrLen2,
+                const uint8_t * pBuffer2, uint32_t dataLen, uint8_t * pCRC1, uint8_t * pCRC2);
+
 /**
  * \brief CRC8 Algorithm sanity check
  *
@@ -0,0 +1,312 @@
+/**
+ * \file crc16_5935_slice.h
+ * Precompiled slice-by-8 tables and folding constants for CRC16_5935, created by tablecreate
+ * \addtogroup Tools
+ * \{
+ * \addtogroup oschecksum
+ * \{
+ */
+
+#ifndef CRC16_5935_SLICE_H_
+#define CRC16_5935_SLICE_H_
+
+#include <stdint.h>
+
+/**
+ * \brief Precompiled slice-by-8 tables, table n holds the CRC of a byte followed by n zero bytes
+ * \see crcSlice8
+ */
+static const uint16_t SliceTable_CRC16_5935[8][256] =
+{
+    {
+        0x0000,    0x5935,    0xB26A,    0xEB5F,    0x3DE1,    0x64D4,    0x8F8B,    0xD6BE,
+        0x7BC2,    0x22F7,    0xC9A8,    0x909D,    0x4623,    0x1F16,    0xF449,    0xAD7C,
+        0xF784,    0xAEB1,    0x45EE,    0x1CDB,    0xCA65,    0x9350,    0x780F,    0x213A,
+        0x8C46,    0xD573,    0x3E2C,    0x6719,    0xB1A7,    0xE892,    0x03CD,    0x5AF8,
+        0xB63D,    0xEF08,    0x0457,    0x5D62,    0x8BDC,    0xD2E9,    0x39B6,    0x6083,
+        0xCDFF,    0x94CA,    0x7F95,    0x26A0,    0xF01E,    0xA92B,    0x4274,    0x1B41,
+        0x41B9,    0x188C,    0xF3D3,    0xAAE6,    0x7C58,    0x256D,    0xCE32,    0x9707,
+        0x3A7B,    0x634E,    0x8811,    0xD124,    0x079A,    0x5EAF,    0xB5F0,    0xECC5,
+        0x354F,    0x6C7A,    0x8725,    0xDE10,    0x08AE,    0x519B,    0xBAC4,    0xE3F1,
+        0x4E8D,    0x17B8,    0xFCE7,    0xA5D2,    0x736C,    0x2A59,    0xC106,    0x9833,
+        0xC2CB,    0x9BFE,    0x70A1,    0x2994,    0xFF2A,    0xA61F,    0x4D40,    0x1475,
+        0xB909,    0xE03C,    0x0B63,    0x5256,    0x84E8,    0xDDDD,    0x3682,    0x6FB7,
+        0x8372,    0xDA47,    0x3118,    0x682D,    0xBE93,    0xE7A6,    0x0CF9,    0x55CC,
+        0xF8B0,    0xA185,    0x4ADA,    0x13EF,    0xC551,    0x9C64,    0x773B,    0x2E0E,
+        0x74F6,    0x2DC3,    0xC69C,    0x9FA9,    0x4917,    0x1022,    0xFB7D,    0xA248,
+        0x0F34,    0x5601,    0xBD5E,    0xE46B,    0x32D5,    0x6BE0,    0x80BF,    0xD98A,
+        0x6A9E,    0x33AB,    0xD8F4,    0x81C1,    0x577F,    0x0E4A,    0xE515,    0xBC20,
+        0x115C,    0x4869,    0xA336,    0xFA03,    0x2CBD,    0x7588,    0x9ED7,    0xC7E2,
+        0x9D1A,    0xC42F,    0x2F70,    0x7645,    0xA0FB,    0xF9CE,    0x1291,    0x4BA4,
+        0xE6D8,    0xBFED,    0x54B2,    0x0D87,    0xDB39,    0x820C,    0x6953,    0x3066,
+        0xDCA3,    0x8596,    0x6EC9,    0x37FC,    0xE142,    0xB877,    0x5328,    0x0A1D,
+        0xA761,    0xFE54,    0x150B,    0x4C3E,    0x9A80,    0xC3B5,    0x28EA,    0x71DF,
+        0x2B27,    0x7212,    0x994D,    0xC078,    0x16C6,    0x4FF3,    0xA4AC,    0xFD99,
+        0x50E5,    0x09D0,    0xE28F,    0xBBBA,    0x6D04,    0x3431,    0xDF6E,    0x865B,
+        0x5FD1,    0x06E4,    0xEDBB,    0xB48E,    0x6230,    0x3B05,    0xD05A,    0x896F,
+        0x2413,    0x7D26,    0x9679,    0xCF4C,    0x19F2,    0x40C7,    0xAB98,    0xF2AD,
+        0xA855,    0xF160,    0x1A3F,    0x430A,    0x95B4,    0xCC81,    0x27DE,    0x7EEB,
+        0xD397,    0x8AA2,    0x61FD,    0x38C8,    0xEE76,    0xB743,    0x5C1C,    0x0529,
+        0xE9EC,    0xB0D9,    0x5B86,    0x02B3,    0xD40D,    0x8D38,    0x6667,    0x3F52,
+        0x922E,    0xCB1B,    0x2044,    0x7971,    0xAFCF,    0xF6FA,    0x1DA5,    0x4490,
+        0x1E68,    0x475D,    0xAC02,    0xF537,    0x2389,    0x7ABC,    0x91E3,    0xC8D6,
+        0x65AA,    0x3C9F,    0xD7C0,    0x8EF5,    0x584B,    0x017E,    0xEA21,    0xB314,
+    },
+    {
+        0x0000,    0xD53C,    0xF34D,    0x2671,    0xBFAF,    0x6A93,    0x4CE2,    0x99DE,
+        0x266B,    0xF357,    0xD526,    0x001A,    0x99C4,    0x4CF8,    0x6A89,    0xBFB5,
+        0x4CD6,    0x99EA,    0xBF9B,    0x6AA7,    0xF379,    0x2645,    0x0034,    0xD508,
+        0x6ABD,    0xBF81,    0x99F0,    0x4CCC,    0xD512,    0x002E,    0x265F,    0xF363,
+        0x99AC,    0x4C90,    0x6AE1,    0xBFDD,    0x2603,    0xF33F,    0xD54E,    0x0072,
+        0xBFC7,    0x6AFB,    0x4C8A,    0x99B6,    0x0068,    0xD554,    0xF325,    0x2619,
+        0xD57A,    0x0046,    0x2637,    0xF30B,    0x6AD5,    0xBFE9,    0x9998,    0x4CA4,
+        0xF311,    0x262D,    0x005C,    0xD560,    0x4CBE,    0x9982,    0xBFF3,    0x6ACF,
+        0x6A6D,    0xBF51,    0x9920,    0x4C1C,    0xD5C2,    0x00FE,    0x268F,    0xF3B3,
+        0x4C06,    0x993A,    0xBF4B,    0x6A77,    0xF3A9,    0x2695,    0x00E4,    0xD5D8,
+        0x26BB,    0xF387,    0xD5F6,    0x00CA,    0x9914,    0x4C28,    0x6A59,    0xBF65,
+        0x00D0,    0xD5EC,    0xF39D,    0x26A1,    0xBF7F,    0x6A43,    0x4C32,    0x990E,
+        0xF3C1,    0x26FD,    0x008C,    0xD5B0,    0x4C6E,    0x9952,    0xBF23,    0x6A1F,
+        0xD5AA,    0x0096,    0x26E7,    0xF3DB,    0x6A05,    0xBF39,    0x9948,    0x4C74,
+        0xBF17,    0x6A2B,    0x4C5A,    0x9966,    0x00B8,    0xD584,    0xF3F5,    0x26C9,
+        0x997C,    0x4C40,    0x6A31,    0xBF0D,    0x26D3,    0xF3EF,    0xD59E,    0x00A2,
+        0xD4DA,    0x01E6,    0x2797,    0xF2AB,    0x6B75,    0xBE49,    0x9838,    0x4D04,
+        0xF2B1,    0x278D,    0x01FC,    0xD4C0,    0x4D1E,    0x9822,    0xBE53,    0x6B6F,
+        0x980C,    0x4D30,    0x6B41,    0xBE7D,    0x27A3,    0xF29F,    0xD4EE,    0x01D2,
+        0xBE67,    0x6B5B,    0x4D2A,    0x9816,    0x01C8,    0xD4F4,    0xF285,    0x27B9,
+        0x4D76,    0x984A,    0xBE3B,    0x6B07,    0xF2D9,    0x27E5,    0x0194,    0xD4A8,
+        0x6B1D,    0xBE21,    0x9850,    0x4D6C,    0xD4B2,    0x018E,    0x27FF,    0xF2C3,
+        0x01A0,    0xD49C,    0xF2ED,    0x27D1,    0xBE0F,    0x6B33,    0x4D42,    0x987E,
+        0x27CB,    0xF2F7,    0xD486,    0x01BA,    0x9864,    0x4D58,    0x6B29,    0xBE15,
+        0xBEB7,    0x6B8B,    0x4DFA,    0x98C6,    0x0118,    0xD424,    0xF255,    0x2769,
+        0x98DC,    0x4DE0,    0x6B91,    0xBEAD,    0x2773,    0xF24F,    0xD43E,    0x0102,
+        0xF261,    0x275D,    0x012C,    0xD410,    0x4DCE,    0x98F2,    0xBE83,    0x6BBF,
+        0xD40A,    0x0136,    0x2747,    0xF27B,    0x6BA5,    0xBE99,    0x98E8,    0x4DD4,
+        0x271B,    0xF227,    0xD456,    0x016A,    0x98B4,    0x4D88,    0x6BF9,    0xBEC5,
+        0x0170,    0xD44C,    0xF23D,    0x2701,    0xBEDF,    0x6BE3,    0x4D92,    0x98AE,
+        0x6BCD,    0xBEF1,    0x9880,    0x4DBC,    0xD462,    0x015E,    0x272F,    0xF213,
+        0x4DA6,    0x989A,    0xBEEB,    0x6BD7,    0xF209,    0x2735,    0x0144,    0xD478,
+    },
+    {
+        0x0000,    0xF081,    0xB837,    0x48B6,    0x295B,    0xD9DA,    0x916C,    0x61ED,
+        0x52B6,    0xA237,    0xEA81,    0x1A00,    0x7BED,    0x8B6C,    0xC3DA,    0x335B,
+        0xA56C,    0x55ED,    0x1D5B,    0xEDDA,    0x8C37,    0x7CB6,    0x3400,    0xC481,
+        0xF7DA,    0x075B,    0x4FED,    0xBF6C,    0xDE81,    0x2E00,    0x66B6,    0x9637,
+        0x13ED,    0xE36C,    0xABDA,    0x5B5B,    0x3AB6,    0xCA37,    0x8281,    0x7200,
+        0x415B,    0xB1DA,    0xF96C,    0x09ED,    0x6800,    0x9881,    0xD037,    0x20B6,
+        0xB681,    0x4600,    0x0EB6,    0xFE37,    0x9FDA,    0x6F5B,    0x27ED,    0xD76C,
+        0xE437,    0x14B6,    0x5C00,    0xAC81,    0xCD6C,    0x3DED,    0x755B,    0x85DA,
+        0x27DA,    0xD75B,    0x9FED,    0x6F6C,    0x0E81,    0xFE00,    0xB6B6,    0x4637,
+        0x756C,    0x85ED,    0xCD5B,    0x3DDA,    0x5C37,    0xACB6,    0xE400,    0x1481,
+        0x82B6,    0x7237,    0x3A81,    0xCA00,    0xABED,    0x5B6C,    0x13DA,    0xE35B,
+        0xD000,    0x2081,    0x6837,    0x98B6,    0xF95B,    0x09DA,    0x416C,    0xB1ED,
+        0x3437,    0xC4B6,    0x8C00,    0x7C81,    0x1D6C,    0xEDED,    0xA55B,    0x55DA,
+        0x6681,    0x9600,    0xDEB6,    0x2E37,    0x4FDA,    0xBF5B,    0xF7ED,    0x076C,
+        0x915B,    0x61DA,    0x296C,    0xD9ED,    0xB800,    0x4881,    0x0037,    0xF0B6,
+        0xC3ED,    0x336C,    0x7BDA,    0x8B5B,    0xEAB6,    0x1A37,    0x5281,    0xA200,
+        0x4FB4,    0xBF35,    0xF783,    0x0702,    0x66EF,    0x966E,    0xDED8,    0x2E59,
+        0x1D02,    0xED83,    0xA535,    0x55B4,    0x3459,    0xC4D8,    0x8C6E,    0x7CEF,
+        0xEAD8,    0x1A59,    0x52EF,    0xA26E,    0xC383,    0x3302,    0x7BB4,    0x8B35,
+        0xB86E,    0x48EF,    0x0059,    0xF0D8,    0x9135,    0x61B4,    0x2902,    0xD983,
+        0x5C59,    0xACD8,    0xE46E,    0x14EF,    0x7502,    0x8583,    0xCD35,    0x3DB4,
+        0x0EEF,    0xFE6E,    0xB6D8,    0x4659,    0x27B4,    0xD735,    0x9F83,    0x6F02,
+        0xF935,    0x09B4,    0x4102,    0xB183,    0xD06E,    0x20EF,    0x6859,    0x98D8,
+        0xAB83,    0x5B02,    0x13B4,    0xE335,    0x82D8,    0x7259,    0x3AEF,    0xCA6E,
+        0x686E,    0x98EF,    0xD059,    0x20D8,    0x4135,    0xB1B4,    0xF902,    0x0983,
+        0x3AD8,    0xCA59,    0x82EF,    0x726E,    0x1383,    0xE302,    0xABB4,    0x5B35,
+        0xCD02,    0x3D83,    0x7535,    0x85B4,    0xE459,    0x14D8,    0x5C6E,    0xACEF,
+        0x9FB4,    0x6F35,    0x2783,    0xD702,    0xB6EF,    0x466E,    0x0ED8,    0xFE59,
+        0x7B83,    0x8B02,    0xC3B4,    0x3335,    0x52D8,    0xA259,    0xEAEF,    0x1A6E,
+        0x2935,    0xD9B4,    0x9102,    0x6183,    0x006E,    0xF0EF,    0xB859,    0x48D8,
+        0xDEEF,    0x2E6E,    0x66D8,    0x9659,    0xF7B4,    0x0735,    0x4F83,    0xBF02,
+        0x8C59,    0x7CD8,    0x346E,    0xC4EF,    0xA502,    0x5583,    0x1D35,    0xEDB4,
+    },
+    {
+        0x0000,    0x9F68,    0x67E5,    0xF88D,    0xCFCA,    0x50A2,    0xA82F,    0x3747,
+        0xC6A1,    0x59C9,    0xA144,    0x3E2C,    0x096B,    0x9603,    0x6E8E,    0xF1E6,
+        0xD477,    0x4B1F,    0xB392,    0x2CFA,    0x1BBD,    0x84D5,    0x7C58,    0xE330,
+        0x12D6,    0x8DBE,    0x7533,    0xEA5B,    0xDD1C,    0x4274,    0xBAF9,    0x2591,
+        0xF1DB,    0x6EB3,    0x963E,    0x0956,    0x3E11,    0xA179,    0x59F4,    0xC69C,
+        0x377A,    0xA812,    0x509F,    0xCFF7,    0xF8B0,    0x67D8,    0x9F55,    0x003D,
+        0x25AC,    0xBAC4,    0x4249,    0xDD21,    0xEA66,    0x750E,    0x8D83,    0x12EB,
+        0xE30D,    0x7C65,    0x84E8,    0x1B80,    0x2CC7,    0xB3AF,    0x4B22,    0xD44A,
+        0xBA83,    0x25EB,    0xDD66,    0x420E,    0x7549,    0xEA21,    0x12AC,    0x8DC4,
+        0x7C22,    0xE34A,    0x1BC7,    0x84AF,    0xB3E8,    0x2C80,    0xD40D,    0x4B65,
+        0x6EF4,    0xF19C,    0x0911,    0x9679,    0xA13E,    0x3E56,    0xC6DB,    0x59B3,
+        0xA855,    0x373D,    0xCFB0,    0x50D8,    0x679F,    0xF8F7,    0x007A,    0x9F12,
+        0x4B58,    0xD430,    0x2CBD,    0xB3D5,    0x8492,    0x1BFA,    0xE377,    0x7C1F,
+        0x8DF9,    0x1291,    0xEA1C,    0x7574,    0x4233,    0xDD5B,    0x25D6,    0xBABE,
+        0x9F2F,    0x0047,    0xF8CA,    0x67A2,    0x50E5,    0xCF8D,    0x3700,    0xA868,
+        0x598E,    0xC6E6,    0x3E6B,    0xA103,    0x9644,    0x092C,    0xF1A1,    0x6EC9,
+        0x2C33,    0xB35B,    0x4BD6,    0xD4BE,    0xE3F9,    0x7C91,    0x841C,    0x1B74,
+        0xEA92,    0x75FA,    0x8D77,    0x121F,    0x2558,    0xBA30,    0x42BD,    0xDDD5,
+        0xF844,    0x672C,    0x9FA1,    0x00C9,    0x378E,    0xA8E6,    0x506B,    0xCF03,
+        0x3EE5,    0xA18D,    0x5900,    0xC668,    0xF12F,    0x6E47,    0x96CA,    0x09A2,
+        0xDDE8,    0x4280,    0xBA0D,    0x2565,    0x1222,    0x8D4A,    0x75C7,    0xEAAF,
+        0x1B49,    0x8421,    0x7CAC,    0xE3C4,    0xD483,    0x4BEB,    0xB366,    0x2C0E,
+        0x099F,    0x96F7,    0x6E7A,    0xF112,    0xC655,    0x593D,    0xA1B0,    0x3ED8,
+        0xCF3E,    0x5056,    0xA8DB,    0x37B3,    0x00F4,    0x9F9C,    0x6711,    0xF879,
+        0x96B0,    0x09D8,    0xF155,    0x6E3D,    0x597A,    0xC612,    0x3E9F,    0xA1F7,
+        0x5011,    0xCF79,    0x37F4,    0xA89C,    0x9FDB,    0x00B3,    0xF83E,    0x6756,
+        0x42C7,    0xDDAF,    0x2522,    0xBA4A,    0x8D0D,    0x1265,    0xEAE8,    0x7580,
+        0x8466,    0x1B0E,    0xE383,    0x7CEB,    0x4BAC,    0xD4C4,    0x2C49,    0xB321,
+        0x676B,    0xF803,    0x008E,    0x9FE6,    0xA8A1,    0x37C9,    0xCF44,    0x502C,
+        0xA1CA,    0x3EA2,    0xC62F,    0x5947,    0x6E00,    0xF168,    0x09E5,    0x968D,
+        0xB31C,    0x2C74,    0xD4F9,    0x4B91,    0x7CD6,    0xE3BE,    0x1B33,    0x845B,
+        0x75BD,    0xEAD5,    0x1258,    0x8D30,    0xBA77,    0x251F,    0xDD92,    0x42FA,
+    },
+    {
+        0x0000,    0x5866,    0xB0CC,    0xE8AA,    0x38AD,    0x60CB,    0x8861,    0xD007,
+        0x715A,    0x293C,    0xC196,    0x99F0,    0x49F7,    0x1191,    0xF93B,    0xA15D,
+        0xE2B4,    0xBAD2,    0x5278,    0x0A1E,    0xDA19,    0x827F,    0x6AD5,    0x32B3,
+        0x93EE,    0xCB88,    0x2322,    0x7B44,    0xAB43,    0xF325,    0x1B8F,    0x43E9,
+        0x9C5D,    0xC43B,    0x2C91,    0x74F7,    0xA4F0,    0xFC96,    0x143C,    0x4C5A,
+        0xED07,    0xB561,    0x5DCB,    0x05AD,    0xD5AA,    0x8DCC,    0x6566,    0x3D00,
+        0x7EE9,    0x268F,    0xCE25,    0x9643,    0x4644,    0x1E22,    0xF688,    0xAEEE,
+        0x0FB3,    0x57D5,    0xBF7F,    0xE719,    0x371E,    0x6F78,    0x87D2,    0xDFB4,
+        0x618F,    0x39E9,    0xD143,    0x8925,    0x5922,    0x0144,    0xE9EE,    0xB188,
+        0x10D5,    0x48B3,    0xA019,    0xF87F,    0x2878,    0x701E,    0x98B4,    0xC0D2,
+        0x833B,    0xDB5D,    0x33F7,    0x6B91,    0xBB96,    0xE3F0,    0x0B5A,    0x533C,
+        0xF261,    0xAA07,    0x42AD,    0x1ACB,    0xCACC,    0x92AA,    0x7A00,    0x2266,
+        0xFDD2,    0xA5B4,    0x4D1E,    0x1578,    0xC57F,    0x9D19,    0x75B3,    0x2DD5,
+        0x8C88,    0xD4EE,    0x3C44,    0x6422,    0xB425,    0xEC43,    0x04E9,    0x5C8F,
+        0x1F66,    0x4700,    0xAFAA,    0xF7CC,    0x27CB,    0x7FAD,    0x9707,    0xCF61,
+        0x6E3C,    0x365A,    0xDEF0,    0x8696,    0x5691,    0x0EF7,    0xE65D,    0xBE3B,
+        0xC31E,    0x9B78,    0x73D2,    0x2BB4,    0xFBB3,    0xA3D5,    0x4B7F,    0x1319,
+        0xB244,    0xEA22,    0x0288,    0x5AEE,    0x8AE9,    0xD28F,    0x3A25,    0x6243,
+        0x21AA,    0x79CC,    0x9166,    0xC900,    0x1907,    0x4161,    0xA9CB,    0xF1AD,
+        0x50F0,    0x0896,    0xE03C,    0xB85A,    0x685D,    0x303B,    0xD891,    0x80F7,
+        0x5F43,    0x0725,    0xEF8F,    0xB7E9,    0x67EE,    0x3F88,    0xD722,    0x8F44,
+        0x2E19,    0x767F,    0x9ED5,    0xC6B3,    0x16B4,    0x4ED2,    0xA678,    0xFE1E,
+        0xBDF7,    0xE591,    0x0D3B,    0x555D,    0x855A,    0xDD3C,    0x3596,    0x6DF0,
+        0xCCAD,    0x94CB,    0x7C61,    0x2407,    0xF400,    0xAC66,    0x44CC,    0x1CAA,
+        0xA291,    0xFAF7,    0x125D,    0x4A3B,    0x9A3C,    0xC25A,    0x2AF0,    0x7296,
+        0xD3CB,    0x8BAD,    0x6307,    0x3B61,    0xEB66,    0xB300,    0x5BAA,    0x03CC,
+        0x4025,    0x1843,    0xF0E9,    0xA88F,    0x7888,    0x20EE,    0xC844,    0x9022,
+        0x317F,    0x6919,    0x81B3,    0xD9D5,    0x09D2,    0x51B4,    0xB91E,    0xE178,
+        0x3ECC,    0x66AA,    0x8E00,    0xD666,    0x0661,    0x5E07,    0xB6AD,    0xEECB,
+        0x4F96,    0x17F0,    0xFF5A,    0xA73C,    0x773B,    0x2F5D,    0xC7F7,    0x9F91,
+        0xDC78,    0x841E,    0x6CB4,    0x34D2,    0xE4D5,    0xBCB3,    0x5419,    0x0C7F,
+        0xAD22,    0xF544,    0x1DEE,    0x4588,    0x958F,    0xCDE9,    0x2543,    0x7D25,
+    },
+    {
+        0x0000,    0xDF09,    0xE727,    0x382E,    0x977B,    0x4872,    0x705C,    0xAF55,
+        0x77C3,    0xA8CA,    0x90E4,    0x4FED,    0xE0B8,    0x3FB1,    0x079F,    0xD896,
+        0xEF86,    0x308F,    0x08A1,    0xD7A8,    0x78FD,    0xA7F4,    0x9FDA,    0x40D3,
+        0x9845,    0x474C,    0x7F62,    0xA06B,    0x0F3E,    0xD037,    0xE819,    0x3710,
+        0x8639,    0x5930,    0x611E,    0xBE17,    0x1142,    0xCE4B,    0xF665,    0x296C,
+        0xF1FA,    0x2EF3,    0x16DD,    0xC9D4,    0x6681,    0xB988,    0x81A6,    0x5EAF,
+        0x69BF,    0xB6B6,    0x8E98,    0x5191,    0xFEC4,    0x21CD,    0x19E3,    0xC6EA,
+        0x1E7C,    0xC175,    0xF95B,    0x2652,    0x8907,    0x560E,    0x6E20,    0xB129,
+        0x5547,    0x8A4E,    0xB260,    0x6D69,    0xC23C,    0x1D35,    0x251B,    0xFA12,
+        0x2284,    0xFD8D,    0xC5A3,    0x1AAA,    0xB5FF,    0x6AF6,    0x52D8,    0x8DD1,
+        0xBAC1,    0x65C8,    0x5DE6,    0x82EF,    0x2DBA,    0xF2B3,    0xCA9D,    0x1594,
+        0xCD02,    0x120B,    0x2A25,    0xF52C,    0x5A79,    0x8570,    0xBD5E,    0x6257,
+        0xD37E,    0x0C77,    0x3459,    0xEB50,    0x4405,    0x9B0C,    0xA322,    0x7C2B,
+        0xA4BD,    0x7BB4,    0x439A,    0x9C93,    0x33C6,    0xECCF,    0xD4E1,    0x0BE8,
+        0x3CF8,    0xE3F1,    0xDBDF,    0x04D6,    0xAB83,    0x748A,    0x4CA4,    0x93AD,
+        0x4B3B,    0x9432,    0xAC1C,    0x7315,    0xDC40,    0x0349,    0x3B67,    0xE46E,
+        0xAA8E,    0x7587,    0x4DA9,    0x92A0,    0x3DF5,    0xE2FC,    0xDAD2,    0x05DB,
+        0xDD4D,    0x0244,    0x3A6A,    0xE563,    0x4A36,    0x953F,    0xAD11,    0x7218,
+        0x4508,    0x9A01,    0xA22F,    0x7D26,    0xD273,    0x0D7A,    0x3554,    0xEA5D,
+        0x32CB,    0xEDC2,    0xD5EC,    0x0AE5,    0xA5B0,    0x7AB9,    0x4297,    0x9D9E,
+        0x2CB7,    0xF3BE,    0xCB90,    0x1499,    0xBBCC,    0x64C5,    0x5CEB,    0x83E2,
+        0x5B74,    0x847D,    0xBC53,    0x635A,    0xCC0F,    0x1306,    0x2B28,    0xF421,
+        0xC331,    0x1C38,    0x2416,    0xFB1F,    0x544A,    0x8B43,    0xB36D,    0x6C64,
+        0xB4F2,    0x6BFB,    0x53D5,    0x8CDC,    0x2389,    0xFC80,    0xC4AE,    0x1BA7,
+        0xFFC9,    0x20C0,    0x18EE,    0xC7E7,    0x68B2,    0xB7BB,    0x8F95,    0x509C,
+        0x880A,    0x5703,    0x6F2D,    0xB024,    0x1F71,    0xC078,    0xF856,    0x275F,
+        0x104F,    0xCF46,    0xF768,    0x2861,    0x8734,    0x583D,    0x6013,    0xBF1A,
+        0x678C,    0xB885,    0x80AB,    0x5FA2,    0xF0F7,    0x2FFE,    0x17D0,    0xC8D9,
+        0x79F0,    0xA6F9,    0x9ED7,    0x41DE,    0xEE8B,    0x3182,    0x09AC,    0xD6A5,
+        0x0E33,    0xD13A,    0xE914,    0x361D,    0x9948,    0x4641,    0x7E6F,    0xA166,
+        0x9676,    0x497F,    0x7151,    0xAE58,    0x010D,    0xDE04,    0xE62A,    0x3923,
+        0xE1B5,    0x3EBC,    0x0692,    0xD99B,    0x76CE,    0xA9C7,    0x91E9,    0x4EE0,
+    },
+    {
+        0x0000,    0x0C29,    0x1852,    0x147B,    0x30A4,    0x3C8D,    0x28F6,    0x24DF,
+        0x6148,    0x6D61,    0x791A,    0x7533,    0x51EC,    0x5DC5,    0x49BE,    0x4597,
+        0xC290,    0xCEB9,    0xDAC2,    0xD6EB,    0xF234,    0xFE1D,    0xEA66,    0xE64F,
+        0xA3D8,    0xAFF1,    0xBB8A,    0xB7A3,    0x937C,    0x9F55,    0x8B2E,    0x8707,
+        0xDC15,    0xD03C,    0xC447,    0xC86E,    0xECB1,    0xE098,    0xF4E3,    0xF8CA,
+        0xBD5D,    0xB174,    0xA50F,    0xA926,    0x8DF9,    0x81D0,    0x95AB,    0x9982,
+        0x1E85,    0x12AC,    0x06D7,    0x0AFE,    0x2E21,    0x2208,    0x3673,    0x3A5A,
+        0x7FCD,    0x73E4,    0x679F,    0x6BB6,    0x4F69,    0x4340,    0x573B,    0x5B12,
+        0xE11F,    0xED36,    0xF94D,    0xF564,    0xD1BB,    0xDD92,    0xC9E9,    0xC5C0,
+        0x8057,    0x8C7E,    0x9805,    0x942C,    0xB0F3,    0xBCDA,    0xA8A1,    0xA488,
+        0x238F,    0x2FA6,    0x3BDD,    0x37F4,    0x132B,    0x1F02,    0x0B79,    0x0750,
+        0x42C7,    0x4EEE,    0x5A95,    0x56BC,    0x7263,    0x7E4A,    0x6A31,    0x6618,
+        0x3D0A,    0x3123,    0x2558,    0x2971,    0x0DAE,    0x0187,    0x15FC,    0x19D5,
+        0x5C42,    0x506B,    0x4410,    0x4839,    0x6CE6,    0x60CF,    0x74B4,    0x789D,
+        0xFF9A,    0xF3B3,    0xE7C8,    0xEBE1,    0xCF3E,    0xC317,    0xD76C,    0xDB45,
+        0x9ED2,    0x92FB,    0x8680,    0x8AA9,    0xAE76,    0xA25F,    0xB624,    0xBA0D,
+        0x9B0B,    0x9722,    0x8359,    0x8F70,    0xABAF,    0xA786,    0xB3FD,    0xBFD4,
+        0xFA43,    0xF66A,    0xE211,    0xEE38,    0xCAE7,    0xC6CE,    0xD2B5,    0xDE9C,
+        0x599B,    0x55B2,    0x41C9,    0x4DE0,    0x693F,    0x6516,    0x716D,    0x7D44,
+        0x38D3,    0x34FA,    0x2081,    0x2CA8,    0x0877,    0x045E,    0x1025,    0x1C0C,
+        0x471E,    0x4B37,    0x5F4C,    0x5365,    0x77BA,    0x7B93,    0x6FE8,    0x63C1,
+        0x2656,    0x2A7F,    0x3E04,    0x322D,    0x16F2,    0x1ADB,    0x0EA0,    0x0289,
+        0x858E,    0x89A7,    0x9DDC,    0x91F5,    0xB52A,    0xB903,    0xAD78,    0xA151,
+        0xE4C6,    0xE8EF,    0xFC94,    0xF0BD,    0xD462,    0xD84B,    0xCC30,    0xC019,
+        0x7A14,    0x763D,    0x6246,    0x6E6F,    0x4AB0,    0x4699,    0x52E2,    0x5ECB,
+        0x1B5C,    0x1775,    0x030E,    0x0F27,    0x2BF8,    0x27D1,    0x33AA,    0x3F83,
+        0xB884,    0xB4AD,    0xA0D6,    0xACFF,    0x8820,    0x8409,    0x9072,    0x9C5B,
+        0xD9CC,    0xD5E5,    0xC19E,    0xCDB7,    0xE968,    0xE541,    0xF13A,    0xFD13,
+        0xA601,    0xAA28,    0xBE53,    0xB27A,    0x96A5,    0x9A8C,    0x8EF7,    0x82DE,
+        0xC749,    0xCB60,    0xDF1B,    0xD332,    0xF7ED,    0xFBC4,    0xEFBF,    0xE396,
+        0x6491,    0x68B8,    0x7CC3,    0x70EA,    0x5435,    0x581C,    0x4C67,    0x404E,
+        0x05D9,    0x09F0,    0x1D8B,    0x11A2,    0x357D,    0x3954,    0x2D2F,    0x2106,
+    },
+    {
+        0x0000,    0x6F23,    0xDE46,    0xB165,    0xE5B9,    0x8A9A,    0x3BFF,    0x54DC,
+        0x9247,    0xFD64,    0x4C01,    0x2322,    0x77FE,    0x18DD,    0xA9B8,    0xC69B,
+        0x7DBB,    0x1298,    0xA3FD,    0xCCDE,    0x9802,    0xF721,    0x4644,    0x2967,
+        0xEFFC,    0x80DF,    0x31BA,    0x5E99,    0x0A45,    0x6566,    0xD403,    0xBB20,
+        0xFB76,    0x9455,    0x2530,    0x4A13,    0x1ECF,    0x71EC,    0xC089,    0xAFAA,
+        0x6931,    0x0612,    0xB777,    0xD854,    0x8C88,    0xE3AB,    0x52CE,    0x3DED,
+        0x86CD,    0xE9EE,    0x588B,    0x37A8,    0x6374,    0x0C57,    0xBD32,    0xD211,
+        0x148A,    0x7BA9,    0xCACC,    0xA5EF,    0xF133,    0x9E10,    0x2F75,    0x4056,
+        0xAFD9,    0xC0FA,    0x719F,    0x1EBC,    0x4A60,    0x2543,    0x9426,    0xFB05,
+        0x3D9E,    0x52BD,    0xE3D8,    0x8CFB,    0xD827,    0xB704,    0x0661,    0x6942,
+        0xD262,    0xBD41,    0x0C24,    0x6307,    0x37DB,    0x58F8,    0xE99D,    0x86BE,
+        0x4025,    0x2F06,    0x9E63,    0xF140,    0xA59C,    0xCABF,    0x7BDA,    0x14F9,
+        0x54AF,    0x3B8C,    0x8AE9,    0xE5CA,    0xB116,    0xDE35,    0x6F50,    0x0073,
+        0xC6E8,    0xA9CB,    0x18AE,    0x778D,    0x2351,    0x4C72,    0xFD17,    0x9234,
+        0x2914,    0x4637,    0xF752,    0x9871,    0xCCAD,    0xA38E,    0x12EB,    0x7DC8,
+        0xBB53,    0xD470,    0x6515,    0x0A36,    0x5EEA,    0x31C9,    0x80AC,    0xEF8F,
+        0x0687,    0x69A4,    0xD8C1,    0xB7E2,    0xE33E,    0x8C1D,    0x3D78,    0x525B,
+        0x94C0,    0xFBE3,    0x4A86,    0x25A5,    0x7179,    0x1E5A,    0xAF3F,    0xC01C,
+        0x7B3C,    0x141F,    0xA57A,    0xCA59,    0x9E85,    0xF1A6,    0x40C3,    0x2FE0,
+        0xE97B,    0x8658,    0x373D,    0x581E,    0x0CC2,    0x63E1,    0xD284,    0xBDA7,
+        0xFDF1,    0x92D2,    0x23B7,    0x4C94,    0x1848,    0x776B,    0xC60E,    0xA92D,
+        0x6FB6,    0x0095,    0xB1F0,    0xDED3,    0x8A0F,    0xE52C,    0x5449,    0x3B6A,
+        0x804A,    0xEF69,    0x5E0C,    0x312F,    0x65F3,    0x0AD0,    0xBBB5,    0xD496,
+        0x120D,    0x7D2E,    0xCC4B,    0xA368,    0xF7B4,    0x9897,    0x29F2,    0x46D1,
+        0xA95E,    0xC67D,    0x7718,    0x183B,    0x4CE7,    0x23C4,    0x92A1,    0xFD82,
+        0x3B19,    0x543A,    0xE55F,    0x8A7C,    0xDEA0,    0xB183,    0x00E6,    0x6FC5,
+        0xD4E5,    0xBBC6,    0x0AA3,    0x6580,    0x315C,    0x5E7F,    0xEF1A,    0x8039,
+        0x46A2,    0x2981,    0x98E4,    0xF7C7,    0xA31B,    0xCC38,    0x7D5D,    0x127E,
+        0x5228,    0x3D0B,    0x8C6E,    0xE34D,    0xB791,    0xD8B2,    0x69D7,    0x06F4,
+        0xC06F,    0xAF4C,    0x1E29,    0x710A,    0x25D6,    0x4AF5,    0xFB90,    0x94B3,
+        0x2F93,    0x40B0,    0xF1D5,    0x9EF6,    0xCA2A,    0xA509,    0x146C,    0x7B4F,
+        0xBDD4,    0xD2F7,    0x6392,    0x0CB1,    0x586D,    0x374E,    0x862B,    0xE908,
+    },
+};
+
+/**
+ * \brief Folding constants x^128, x^192, x^512 and x^576 mod P of the carry-less multiply path
+ * \see crcFoldClmul
+ */
+static const uint64_t FoldConstants_CRC16_5935[4] =
+{
+        0x55D90000ULL,
+        0x8D1D0000ULL,
+        0xEC1D0000ULL,
+        0xBA830000ULL,
+};
+
+#endif /* CRC16_5935_SLICE_H_ */
+
+/**
+ * \}
+ * \}
+ */
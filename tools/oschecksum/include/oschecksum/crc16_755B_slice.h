@@ -0,0 +1,312 @@
+/**
+ * \file crc16_755B_slice.h
+ * Precompiled slice-by-8 tables and folding constants for CRC16_755B, created by tablecreate
+ * \addtogroup Tools
+ * \{
+ * \addtogroup oschecksum
+ * \{
+ */
+
+#ifndef CRC16_755B_SLICE_H_
+#define CRC16_755B_SLICE_H_
+
+#include <stdint.h>
+
+/**
+ * \brief Precompiled slice-by-8 tables, table n holds the CRC of a byte followed by n zero bytes
+ * \see crcSlice8
+ */
+static const uint16_t SliceTable_CRC16_755B[8][256] =
+{
+    {
+        0x0000,    0x755B,    0xEAB6,    0x9FED,    0xA037,    0xD56C,    0x4A81,    0x3FDA,
+        0x3535,    0x406E,    0xDF83,    0xAAD8,    0x9502,    0xE059,    0x7FB4,    0x0AEF,
+        0x6A6A,    0x1F31,    0x80DC,    0xF587,    0xCA5D,    0xBF06,    0x20EB,    0x55B0,
+        0x5F5F,    0x2A04,    0xB5E9,    0xC0B2,    0xFF68,    0x8A33,    0x15DE,    0x6085,
+        0xD4D4,    0xA18F,    0x3E62,    0x4B39,    0x74E3,    0x01B8,    0x9E55,    0xEB0E,
+        0xE1E1,    0x94BA,    0x0B57,    0x7E0C,    0x41D6,    0x348D,    0xAB60,    0xDE3B,
+        0xBEBE,    0xCBE5,    0x5408,    0x2153,    0x1E89,    0x6BD2,    0xF43F,    0x8164,
+        0x8B8B,    0xFED0,    0x613D,    0x1466,    0x2BBC,    0x5EE7,    0xC10A,    0xB451,
+        0xDCF3,    0xA9A8,    0x3645,    0x431E,    0x7CC4,    0x099F,    0x9672,    0xE329,
+        0xE9C6,    0x9C9D,    0x0370,    0x762B,    0x49F1,    0x3CAA,    0xA347,    0xD61C,
+        0xB699,    0xC3C2,    0x5C2F,    0x2974,    0x16AE,    0x63F5,    0xFC18,    0x8943,
+        0x83AC,    0xF6F7,    0x691A,    0x1C41,    0x239B,    0x56C0,    0xC92D,    0xBC76,
+        0x0827,    0x7D7C,    0xE291,    0x97CA,    0xA810,    0xDD4B,    0x42A6,    0x37FD,
+        0x3D12,    0x4849,    0xD7A4,    0xA2FF,    0x9D25,    0xE87E,    0x7793,    0x02C8,
+        0x624D,    0x1716,    0x88FB,    0xFDA0,    0xC27A,    0xB721,    0x28CC,    0x5D97,
+        0x5778,    0x2223,    0xBDCE,    0xC895,    0xF74F,    0x8214,    0x1DF9,    0x68A2,
+        0xCCBD,    0xB9E6,    0x260B,    0x5350,    0x6C8A,    0x19D1,    0x863C,    0xF367,
+        0xF988,    0x8CD3,    0x133E,    0x6665,    0x59BF,    0x2CE4,    0xB309,    0xC652,
+        0xA6D7,    0xD38C,    0x4C61,    0x393A,    0x06E0,    0x73BB,    0xEC56,    0x990D,
+        0x93E2,    0xE6B9,    0x7954,    0x0C0F,    0x33D5,    0x468E,    0xD963,    0xAC38,
+        0x1869,    0x6D32,    0xF2DF,    0x8784,    0xB85E,    0xCD05,    0x52E8,    0x27B3,
+        0x2D5C,    0x5807,    0xC7EA,    0xB2B1,    0x8D6B,    0xF830,    0x67DD,    0x1286,
+        0x7203,    0x0758,    0x98B5,    0xEDEE,    0xD234,    0xA76F,    0x3882,    0x4DD9,
+        0x4736,    0x326D,    0xAD80,    0xD8DB,    0xE701,    0x925A,    0x0DB7,    0x78EC,
+        0x104E,    0x6515,    0xFAF8,    0x8FA3,    0xB079,    0xC522,    0x5ACF,    0x2F94,
+        0x257B,    0x5020,    0xCFCD,    0xBA96,    0x854C,    0xF017,    0x6FFA,    0x1AA1,
+        0x7A24,    0x0F7F,    0x9092,    0xE5C9,    0xDA13,    0xAF48,    0x30A5,    0x45FE,
+        0x4F11,    0x3A4A,    0xA5A7,    0xD0FC,    0xEF26,    0x9A7D,    0x0590,    0x70CB,
+        0xC49A,    0xB1C1,    0x2E2C,    0x5B77,    0x64AD,    0x11F6,    0x8E1B,    0xFB40,
+        0xF1AF,    0x84F4,    0x1B19,    0x6E42,    0x5198,    0x24C3,    0xBB2E,    0xCE75,
+        0xAEF0,    0xDBAB,    0x4446,    0x311D,    0x0EC7,    0x7B9C,    0xE471,    0x912A,
+        0x9BC5,    0xEE9E,    0x7173,    0x0428,    0x3BF2,    0x4EA9,    0xD144,    0xA41F,
+    },
+    {
+        0x0000,    0xEC21,    0xAD19,    0x4138,    0x2F69,    0xC348,    0x8270,    0x6E51,
+        0x5ED2,    0xB2F3,    0xF3CB,    0x1FEA,    0x71BB,    0x9D9A,    0xDCA2,    0x3083,
+        0xBDA4,    0x5185,    0x10BD,    0xFC9C,    0x92CD,    0x7EEC,    0x3FD4,    0xD3F5,
+        0xE376,    0x0F57,    0x4E6F,    0xA24E,    0xCC1F,    0x203E,    0x6106,    0x8D27,
+        0x0E13,    0xE232,    0xA30A,    0x4F2B,    0x217A,    0xCD5B,    0x8C63,    0x6042,
+        0x50C1,    0xBCE0,    0xFDD8,    0x11F9,    0x7FA8,    0x9389,    0xD2B1,    0x3E90,
+        0xB3B7,    0x5F96,    0x1EAE,    0xF28F,    0x9CDE,    0x70FF,    0x31C7,    0xDDE6,
+        0xED65,    0x0144,    0x407C,    0xAC5D,    0xC20C,    0x2E2D,    0x6F15,    0x8334,
+        0x1C26,    0xF007,    0xB13F,    0x5D1E,    0x334F,    0xDF6E,    0x9E56,    0x7277,
+        0x42F4,    0xAED5,    0xEFED,    0x03CC,    0x6D9D,    0x81BC,    0xC084,    0x2CA5,
+        0xA182,    0x4DA3,    0x0C9B,    0xE0BA,    0x8EEB,    0x62CA,    0x23F2,    0xCFD3,
+        0xFF50,    0x1371,    0x5249,    0xBE68,    0xD039,    0x3C18,    0x7D20,    0x9101,
+        0x1235,    0xFE14,    0xBF2C,    0x530D,    0x3D5C,    0xD17D,    0x9045,    0x7C64,
+        0x4CE7,    0xA0C6,    0xE1FE,    0x0DDF,    0x638E,    0x8FAF,    0xCE97,    0x22B6,
+        0xAF91,    0x43B0,    0x0288,    0xEEA9,    0x80F8,    0x6CD9,    0x2DE1,    0xC1C0,
+        0xF143,    0x1D62,    0x5C5A,    0xB07B,    0xDE2A,    0x320B,    0x7333,    0x9F12,
+        0x384C,    0xD46D,    0x9555,    0x7974,    0x1725,    0xFB04,    0xBA3C,    0x561D,
+        0x669E,    0x8ABF,    0xCB87,    0x27A6,    0x49F7,    0xA5D6,    0xE4EE,    0x08CF,
+        0x85E8,    0x69C9,    0x28F1,    0xC4D0,    0xAA81,    0x46A0,    0x0798,    0xEBB9,
+        0xDB3A,    0x371B,    0x7623,    0x9A02,    0xF453,    0x1872,    0x594A,    0xB56B,
+        0x365F,    0xDA7E,    0x9B46,    0x7767,    0x1936,    0xF517,    0xB42F,    0x580E,
+        0x688D,    0x84AC,    0xC594,    0x29B5,    0x47E4,    0xABC5,    0xEAFD,    0x06DC,
+        0x8BFB,    0x67DA,    0x26E2,    0xCAC3,    0xA492,    0x48B3,    0x098B,    0xE5AA,
+        0xD529,    0x3908,    0x7830,    0x9411,    0xFA40,    0x1661,    0x5759,    0xBB78,
+        0x246A,    0xC84B,    0x8973,    0x6552,    0x0B03,    0xE722,    0xA61A,    0x4A3B,
+        0x7AB8,    0x9699,    0xD7A1,    0x3B80,    0x55D1,    0xB9F0,    0xF8C8,    0x14E9,
+        0x99CE,    0x75EF,    0x34D7,    0xD8F6,    0xB6A7,    0x5A86,    0x1BBE,    0xF79F,
+        0xC71C,    0x2B3D,    0x6A05,    0x8624,    0xE875,    0x0454,    0x456C,    0xA94D,
+        0x2A79,    0xC658,    0x8760,    0x6B41,    0x0510,    0xE931,    0xA809,    0x4428,
+        0x74AB,    0x988A,    0xD9B2,    0x3593,    0x5BC2,    0xB7E3,    0xF6DB,    0x1AFA,
+        0x97DD,    0x7BFC,    0x3AC4,    0xD6E5,    0xB8B4,    0x5495,    0x15AD,    0xF98C,
+        0xC90F,    0x252E,    0x6416,    0x8837,    0xE666,    0x0A47,    0x4B7F,    0xA75E,
+    },
+    {
+        0x0000,    0x7098,    0xE130,    0x91A8,    0xB73B,    0xC7A3,    0x560B,    0x2693,
+        0x1B2D,    0x6BB5,    0xFA1D,    0x8A85,    0xAC16,    0xDC8E,    0x4D26,    0x3DBE,
+        0x365A,    0x46C2,    0xD76A,    0xA7F2,    0x8161,    0xF1F9,    0x6051,    0x10C9,
+        0x2D77,    0x5DEF,    0xCC47,    0xBCDF,    0x9A4C,    0xEAD4,    0x7B7C,    0x0BE4,
+        0x6CB4,    0x1C2C,    0x8D84,    0xFD1C,    0xDB8F,    0xAB17,    0x3ABF,    0x4A27,
+        0x7799,    0x0701,    0x96A9,    0xE631,    0xC0A2,    0xB03A,    0x2192,    0x510A,
+        0x5AEE,    0x2A76,    0xBBDE,    0xCB46,    0xEDD5,    0x9D4D,    0x0CE5,    0x7C7D,
+        0x41C3,    0x315B,    0xA0F3,    0xD06B,    0xF6F8,    0x8660,    0x17C8,    0x6750,
+        0xD968,    0xA9F0,    0x3858,    0x48C0,    0x6E53,    0x1ECB,    0x8F63,    0xFFFB,
+        0xC245,    0xB2DD,    0x2375,    0x53ED,    0x757E,    0x05E6,    0x944E,    0xE4D6,
+        0xEF32,    0x9FAA,    0x0E02,    0x7E9A,    0x5809,    0x2891,    0xB939,    0xC9A1,
+        0xF41F,    0x8487,    0x152F,    0x65B7,    0x4324,    0x33BC,    0xA214,    0xD28C,
+        0xB5DC,    0xC544,    0x54EC,    0x2474,    0x02E7,    0x727F,    0xE3D7,    0x934F,
+        0xAEF1,    0xDE69,    0x4FC1,    0x3F59,    0x19CA,    0x6952,    0xF8FA,    0x8862,
+        0x8386,    0xF31E,    0x62B6,    0x122E,    0x34BD,    0x4425,    0xD58D,    0xA515,
+        0x98AB,    0xE833,    0x799B,    0x0903,    0x2F90,    0x5F08,    0xCEA0,    0xBE38,
+        0xC78B,    0xB713,    0x26BB,    0x5623,    0x70B0,    0x0028,    0x9180,    0xE118,
+        0xDCA6,    0xAC3E,    0x3D96,    0x4D0E,    0x6B9D,    0x1B05,    0x8AAD,    0xFA35,
+        0xF1D1,    0x8149,    0x10E1,    0x6079,    0x46EA,    0x3672,    0xA7DA,    0xD742,
+        0xEAFC,    0x9A64,    0x0BCC,    0x7B54,    0x5DC7,    0x2D5F,    0xBCF7,    0xCC6F,
+        0xAB3F,    0xDBA7,    0x4A0F,    0x3A97,    0x1C04,    0x6C9C,    0xFD34,    0x8DAC,
+        0xB012,    0xC08A,    0x5122,    0x21BA,    0x0729,    0x77B1,    0xE619,    0x9681,
+        0x9D65,    0xEDFD,    0x7C55,    0x0CCD,    0x2A5E,    0x5AC6,    0xCB6E,    0xBBF6,
+        0x8648,    0xF6D0,    0x6778,    0x17E0,    0x3173,    0x41EB,    0xD043,    0xA0DB,
+        0x1EE3,    0x6E7B,    0xFFD3,    0x8F4B,    0xA9D8,    0xD940,    0x48E8,    0x3870,
+        0x05CE,    0x7556,    0xE4FE,    0x9466,    0xB2F5,    0xC26D,    0x53C5,    0x235D,
+        0x28B9,    0x5821,    0xC989,    0xB911,    0x9F82,    0xEF1A,    0x7EB2,    0x0E2A,
+        0x3394,    0x430C,    0xD2A4,    0xA23C,    0x84AF,    0xF437,    0x659F,    0x1507,
+        0x7257,    0x02CF,    0x9367,    0xE3FF,    0xC56C,    0xB5F4,    0x245C,    0x54C4,
+        0x697A,    0x19E2,    0x884A,    0xF8D2,    0xDE41,    0xAED9,    0x3F71,    0x4FE9,
+        0x440D,    0x3495,    0xA53D,    0xD5A5,    0xF336,    0x83AE,    0x1206,    0x629E,
+        0x5F20,    0x2FB8,    0xBE10,    0xCE88,    0xE81B,    0x9883,    0x092B,    0x79B3,
+    },
+    {
+        0x0000,    0xFA4D,    0x81C1,    0x7B8C,    0x76D9,    0x8C94,    0xF718,    0x0D55,
+        0xEDB2,    0x17FF,    0x6C73,    0x963E,    0x9B6B,    0x6126,    0x1AAA,    0xE0E7,
+        0xAE3F,    0x5472,    0x2FFE,    0xD5B3,    0xD8E6,    0x22AB,    0x5927,    0xA36A,
+        0x438D,    0xB9C0,    0xC24C,    0x3801,    0x3554,    0xCF19,    0xB495,    0x4ED8,
+        0x2925,    0xD368,    0xA8E4,    0x52A9,    0x5FFC,    0xA5B1,    0xDE3D,    0x2470,
+        0xC497,    0x3EDA,    0x4556,    0xBF1B,    0xB24E,    0x4803,    0x338F,    0xC9C2,
+        0x871A,    0x7D57,    0x06DB,    0xFC96,    0xF1C3,    0x0B8E,    0x7002,    0x8A4F,
+        0x6AA8,    0x90E5,    0xEB69,    0x1124,    0x1C71,    0xE63C,    0x9DB0,    0x67FD,
+        0x524A,    0xA807,    0xD38B,    0x29C6,    0x2493,    0xDEDE,    0xA552,    0x5F1F,
+        0xBFF8,    0x45B5,    0x3E39,    0xC474,    0xC921,    0x336C,    0x48E0,    0xB2AD,
+        0xFC75,    0x0638,    0x7DB4,    0x87F9,    0x8AAC,    0x70E1,    0x0B6D,    0xF120,
+        0x11C7,    0xEB8A,    0x9006,    0x6A4B,    0x671E,    0x9D53,    0xE6DF,    0x1C92,
+        0x7B6F,    0x8122,    0xFAAE,    0x00E3,    0x0DB6,    0xF7FB,    0x8C77,    0x763A,
+        0x96DD,    0x6C90,    0x171C,    0xED51,    0xE004,    0x1A49,    0x61C5,    0x9B88,
+        0xD550,    0x2F1D,    0x5491,    0xAEDC,    0xA389,    0x59C4,    0x2248,    0xD805,
+        0x38E2,    0xC2AF,    0xB923,    0x436E,    0x4E3B,    0xB476,    0xCFFA,    0x35B7,
+        0xA494,    0x5ED9,    0x2555,    0xDF18,    0xD24D,    0x2800,    0x538C,    0xA9C1,
+        0x4926,    0xB36B,    0xC8E7,    0x32AA,    0x3FFF,    0xC5B2,    0xBE3E,    0x4473,
+        0x0AAB,    0xF0E6,    0x8B6A,    0x7127,    0x7C72,    0x863F,    0xFDB3,    0x07FE,
+        0xE719,    0x1D54,    0x66D8,    0x9C95,    0x91C0,    0x6B8D,    0x1001,    0xEA4C,
+        0x8DB1,    0x77FC,    0x0C70,    0xF63D,    0xFB68,    0x0125,    0x7AA9,    0x80E4,
+        0x6003,    0x9A4E,    0xE1C2,    0x1B8F,    0x16DA,    0xEC97,    0x971B,    0x6D56,
+        0x238E,    0xD9C3,    0xA24F,    0x5802,    0x5557,    0xAF1A,    0xD496,    0x2EDB,
+        0xCE3C,    0x3471,    0x4FFD,    0xB5B0,    0xB8E5,    0x42A8,    0x3924,    0xC369,
+        0xF6DE,    0x0C93,    0x771F,    0x8D52,    0x8007,    0x7A4A,    0x01C6,    0xFB8B,
+        0x1B6C,    0xE121,    0x9AAD,    0x60E0,    0x6DB5,    0x97F8,    0xEC74,    0x1639,
+        0x58E1,    0xA2AC,    0xD920,    0x236D,    0x2E38,    0xD475,    0xAFF9,    0x55B4,
+        0xB553,    0x4F1E,    0x3492,    0xCEDF,    0xC38A,    0x39C7,    0x424B,    0xB806,
+        0xDFFB,    0x25B6,    0x5E3A,    0xA477,    0xA922,    0x536F,    0x28E3,    0xD2AE,
+        0x3249,    0xC804,    0xB388,    0x49C5,    0x4490,    0xBEDD,    0xC551,    0x3F1C,
+        0x71C4,    0x8B89,    0xF005,    0x0A48,    0x071D,    0xFD50,    0x86DC,    0x7C91,
+        0x9C76,    0x663B,    0x1DB7,    0xE7FA,    0xEAAF,    0x10E2,    0x6B6E,    0x9123,
+    },
+    {
+        0x0000,    0x3C73,    0x78E6,    0x4495,    0xF1CC,    0xCDBF,    0x892A,    0xB559,
+        0x96C3,    0xAAB0,    0xEE25,    0xD256,    0x670F,    0x5B7C,    0x1FE9,    0x239A,
+        0x58DD,    0x64AE,    0x203B,    0x1C48,    0xA911,    0x9562,    0xD1F7,    0xED84,
+        0xCE1E,    0xF26D,    0xB6F8,    0x8A8B,    0x3FD2,    0x03A1,    0x4734,    0x7B47,
+        0xB1BA,    0x8DC9,    0xC95C,    0xF52F,    0x4076,    0x7C05,    0x3890,    0x04E3,
+        0x2779,    0x1B0A,    0x5F9F,    0x63EC,    0xD6B5,    0xEAC6,    0xAE53,    0x9220,
+        0xE967,    0xD514,    0x9181,    0xADF2,    0x18AB,    0x24D8,    0x604D,    0x5C3E,
+        0x7FA4,    0x43D7,    0x0742,    0x3B31,    0x8E68,    0xB21B,    0xF68E,    0xCAFD,
+        0x162F,    0x2A5C,    0x6EC9,    0x52BA,    0xE7E3,    0xDB90,    0x9F05,    0xA376,
+        0x80EC,    0xBC9F,    0xF80A,    0xC479,    0x7120,    0x4D53,    0x09C6,    0x35B5,
+        0x4EF2,    0x7281,    0x3614,    0x0A67,    0xBF3E,    0x834D,    0xC7D8,    0xFBAB,
+        0xD831,    0xE442,    0xA0D7,    0x9CA4,    0x29FD,    0x158E,    0x511B,    0x6D68,
+        0xA795,    0x9BE6,    0xDF73,    0xE300,    0x5659,    0x6A2A,    0x2EBF,    0x12CC,
+        0x3156,    0x0D25,    0x49B0,    0x75C3,    0xC09A,    0xFCE9,    0xB87C,    0x840F,
+        0xFF48,    0xC33B,    0x87AE,    0xBBDD,    0x0E84,    0x32F7,    0x7662,    0x4A11,
+        0x698B,    0x55F8,    0x116D,    0x2D1E,    0x9847,    0xA434,    0xE0A1,    0xDCD2,
+        0x2C5E,    0x102D,    0x54B8,    0x68CB,    0xDD92,    0xE1E1,    0xA574,    0x9907,
+        0xBA9D,    0x86EE,    0xC27B,    0xFE08,    0x4B51,    0x7722,    0x33B7,    0x0FC4,
+        0x7483,    0x48F0,    0x0C65,    0x3016,    0x854F,    0xB93C,    0xFDA9,    0xC1DA,
+        0xE240,    0xDE33,    0x9AA6,    0xA6D5,    0x138C,    0x2FFF,    0x6B6A,    0x5719,
+        0x9DE4,    0xA197,    0xE502,    0xD971,    0x6C28,    0x505B,    0x14CE,    0x28BD,
+        0x0B27,    0x3754,    0x73C1,    0x4FB2,    0xFAEB,    0xC698,    0x820D,    0xBE7E,
+        0xC539,    0xF94A,    0xBDDF,    0x81AC,    0x34F5,    0x0886,    0x4C13,    0x7060,
+        0x53FA,    0x6F89,    0x2B1C,    0x176F,    0xA236,    0x9E45,    0xDAD0,    0xE6A3,
+        0x3A71,    0x0602,    0x4297,    0x7EE4,    0xCBBD,    0xF7CE,    0xB35B,    0x8F28,
+        0xACB2,    0x90C1,    0xD454,    0xE827,    0x5D7E,    0x610D,    0x2598,    0x19EB,
+        0x62AC,    0x5EDF,    0x1A4A,    0x2639,    0x9360,    0xAF13,    0xEB86,    0xD7F5,
+        0xF46F,    0xC81C,    0x8C89,    0xB0FA,    0x05A3,    0x39D0,    0x7D45,    0x4136,
+        0x8BCB,    0xB7B8,    0xF32D,    0xCF5E,    0x7A07,    0x4674,    0x02E1,    0x3E92,
+        0x1D08,    0x217B,    0x65EE,    0x599D,    0xECC4,    0xD0B7,    0x9422,    0xA851,
+        0xD316,    0xEF65,    0xABF0,    0x9783,    0x22DA,    0x1EA9,    0x5A3C,    0x664F,
+        0x45D5,    0x79A6,    0x3D33,    0x0140,    0xB419,    0x886A,    0xCCFF,    0xF08C,
+    },
+    {
+        0x0000,    0x58BC,    0xB178,    0xE9C4,    0x17AB,    0x4F17,    0xA6D3,    0xFE6F,
+        0x2F56,    0x77EA,    0x9E2E,    0xC692,    0x38FD,    0x6041,    0x8985,    0xD139,
+        0x5EAC,    0x0610,    0xEFD4,    0xB768,    0x4907,    0x11BB,    0xF87F,    0xA0C3,
+        0x71FA,    0x2946,    0xC082,    0x983E,    0x6651,    0x3EED,    0xD729,    0x8F95,
+        0xBD58,    0xE5E4,    0x0C20,    0x549C,    0xAAF3,    0xF24F,    0x1B8B,    0x4337,
+        0x920E,    0xCAB2,    0x2376,    0x7BCA,    0x85A5,    0xDD19,    0x34DD,    0x6C61,
+        0xE3F4,    0xBB48,    0x528C,    0x0A30,    0xF45F,    0xACE3,    0x4527,    0x1D9B,
+        0xCCA2,    0x941E,    0x7DDA,    0x2566,    0xDB09,    0x83B5,    0x6A71,    0x32CD,
+        0x0FEB,    0x5757,    0xBE93,    0xE62F,    0x1840,    0x40FC,    0xA938,    0xF184,
+        0x20BD,    0x7801,    0x91C5,    0xC979,    0x3716,    0x6FAA,    0x866E,    0xDED2,
+        0x5147,    0x09FB,    0xE03F,    0xB883,    0x46EC,    0x1E50,    0xF794,    0xAF28,
+        0x7E11,    0x26AD,    0xCF69,    0x97D5,    0x69BA,    0x3106,    0xD8C2,    0x807E,
+        0xB2B3,    0xEA0F,    0x03CB,    0x5B77,    0xA518,    0xFDA4,    0x1460,    0x4CDC,
+        0x9DE5,    0xC559,    0x2C9D,    0x7421,    0x8A4E,    0xD2F2,    0x3B36,    0x638A,
+        0xEC1F,    0xB4A3,    0x5D67,    0x05DB,    0xFBB4,    0xA308,    0x4ACC,    0x1270,
+        0xC349,    0x9BF5,    0x7231,    0x2A8D,    0xD4E2,    0x8C5E,    0x659A,    0x3D26,
+        0x1FD6,    0x476A,    0xAEAE,    0xF612,    0x087D,    0x50C1,    0xB905,    0xE1B9,
+        0x3080,    0x683C,    0x81F8,    0xD944,    0x272B,    0x7F97,    0x9653,    0xCEEF,
+        0x417A,    0x19C6,    0xF002,    0xA8BE,    0x56D1,    0x0E6D,    0xE7A9,    0xBF15,
+        0x6E2C,    0x3690,    0xDF54,    0x87E8,    0x7987,    0x213B,    0xC8FF,    0x9043,
+        0xA28E,    0xFA32,    0x13F6,    0x4B4A,    0xB525,    0xED99,    0x045D,    0x5CE1,
+        0x8DD8,    0xD564,    0x3CA0,    0x641C,    0x9A73,    0xC2CF,    0x2B0B,    0x73B7,
+        0xFC22,    0xA49E,    0x4D5A,    0x15E6,    0xEB89,    0xB335,    0x5AF1,    0x024D,
+        0xD374,    0x8BC8,    0x620C,    0x3AB0,    0xC4DF,    0x9C63,    0x75A7,    0x2D1B,
+        0x103D,    0x4881,    0xA145,    0xF9F9,    0x0796,    0x5F2A,    0xB6EE,    0xEE52,
+        0x3F6B,    0x67D7,    0x8E13,    0xD6AF,    0x28C0,    0x707C,    0x99B8,    0xC104,
+        0x4E91,    0x162D,    0xFFE9,    0xA755,    0x593A,    0x0186,    0xE842,    0xB0FE,
+        0x61C7,    0x397B,    0xD0BF,    0x8803,    0x766C,    0x2ED0,    0xC714,    0x9FA8,
+        0xAD65,    0xF5D9,    0x1C1D,    0x44A1,    0xBACE,    0xE272,    0x0BB6,    0x530A,
+        0x8233,    0xDA8F,    0x334B,    0x6BF7,    0x9598,    0xCD24,    0x24E0,    0x7C5C,
+        0xF3C9,    0xAB75,    0x42B1,    0x1A0D,    0xE462,    0xBCDE,    0x551A,    0x0DA6,
+        0xDC9F,    0x8423,    0x6DE7,    0x355B,    0xCB34,    0x9388,    0x7A4C,    0x22F0,
+    },
+    {
+        0x0000,    0x3FAC,    0x7F58,    0x40F4,    0xFEB0,    0xC11C,    0x81E8,    0xBE44,
+        0x883B,    0xB797,    0xF763,    0xC8CF,    0x768B,    0x4927,    0x09D3,    0x367F,
+        0x652D,    0x5A81,    0x1A75,    0x25D9,    0x9B9D,    0xA431,    0xE4C5,    0xDB69,
+        0xED16,    0xD2BA,    0x924E,    0xADE2,    0x13A6,    0x2C0A,    0x6CFE,    0x5352,
+        0xCA5A,    0xF5F6,    0xB502,    0x8AAE,    0x34EA,    0x0B46,    0x4BB2,    0x741E,
+        0x4261,    0x7DCD,    0x3D39,    0x0295,    0xBCD1,    0x837D,    0xC389,    0xFC25,
+        0xAF77,    0x90DB,    0xD02F,    0xEF83,    0x51C7,    0x6E6B,    0x2E9F,    0x1133,
+        0x274C,    0x18E0,    0x5814,    0x67B8,    0xD9FC,    0xE650,    0xA6A4,    0x9908,
+        0xE1EF,    0xDE43,    0x9EB7,    0xA11B,    0x1F5F,    0x20F3,    0x6007,    0x5FAB,
+        0x69D4,    0x5678,    0x168C,    0x2920,    0x9764,    0xA8C8,    0xE83C,    0xD790,
+        0x84C2,    0xBB6E,    0xFB9A,    0xC436,    0x7A72,    0x45DE,    0x052A,    0x3A86,
+        0x0CF9,    0x3355,    0x73A1,    0x4C0D,    0xF249,    0xCDE5,    0x8D11,    0xB2BD,
+        0x2BB5,    0x1419,    0x54ED,    0x6B41,    0xD505,    0xEAA9,    0xAA5D,    0x95F1,
+        0xA38E,    0x9C22,    0xDCD6,    0xE37A,    0x5D3E,    0x6292,    0x2266,    0x1DCA,
+        0x4E98,    0x7134,    0x31C0,    0x0E6C,    0xB028,    0x8F84,    0xCF70,    0xF0DC,
+        0xC6A3,    0xF90F,    0xB9FB,    0x8657,    0x3813,    0x07BF,    0x474B,    0x78E7,
+        0xB685,    0x8929,    0xC9DD,    0xF671,    0x4835,    0x7799,    0x376D,    0x08C1,
+        0x3EBE,    0x0112,    0x41E6,    0x7E4A,    0xC00E,    0xFFA2,    0xBF56,    0x80FA,
+        0xD3A8,    0xEC04,    0xACF0,    0x935C,    0x2D18,    0x12B4,    0x5240,    0x6DEC,
+        0x5B93,    0x643F,    0x24CB,    0x1B67,    0xA523,    0x9A8F,    0xDA7B,    0xE5D7,
+        0x7CDF,    0x4373,    0x0387,    0x3C2B,    0x826F,    0xBDC3,    0xFD37,    0xC29B,
+        0xF4E4,    0xCB48,    0x8BBC,    0xB410,    0x0A54,    0x35F8,    0x750C,    0x4AA0,
+        0x19F2,    0x265E,    0x66AA,    0x5906,    0xE742,    0xD8EE,    0x981A,    0xA7B6,
+        0x91C9,    0xAE65,    0xEE91,    0xD13D,    0x6F79,    0x50D5,    0x1021,    0x2F8D,
+        0x576A,    0x68C6,    0x2832,    0x179E,    0xA9DA,    0x9676,    0xD682,    0xE92E,
+        0xDF51,    0xE0FD,    0xA009,    0x9FA5,    0x21E1,    0x1E4D,    0x5EB9,    0x6115,
+        0x3247,    0x0DEB,    0x4D1F,    0x72B3,    0xCCF7,    0xF35B,    0xB3AF,    0x8C03,
+        0xBA7C,    0x85D0,    0xC524,    0xFA88,    0x44CC,    0x7B60,    0x3B94,    0x0438,
+        0x9D30,    0xA29C,    0xE268,    0xDDC4,    0x6380,    0x5C2C,    0x1CD8,    0x2374,
+        0x150B,    0x2AA7,    0x6A53,    0x55FF,    0xEBBB,    0xD417,    0x94E3,    0xAB4F,
+        0xF81D,    0xC7B1,    0x8745,    0xB8E9,    0x06AD,    0x3901,    0x79F5,    0x4659,
+        0x7026,    0x4F8A,    0x0F7E,    0x30D2,    0x8E96,    0xB13A,    0xF1CE,    0xCE62,
+    },
+    {
+        0x0000,    0x1851,    0x30A2,    0x28F3,    0x6144,    0x7915,    0x51E6,    0x49B7,
+        0xC288,    0xDAD9,    0xF22A,    0xEA7B,    0xA3CC,    0xBB9D,    0x936E,    0x8B3F,
+        0xF04B,    0xE81A,    0xC0E9,    0xD8B8,    0x910F,    0x895E,    0xA1AD,    0xB9FC,
+        0x32C3,    0x2A92,    0x0261,    0x1A30,    0x5387,    0x4BD6,    0x6325,    0x7B74,
+        0x95CD,    0x8D9C,    0xA56F,    0xBD3E,    0xF489,    0xECD8,    0xC42B,    0xDC7A,
+        0x5745,    0x4F14,    0x67E7,    0x7FB6,    0x3601,    0x2E50,    0x06A3,    0x1EF2,
+        0x6586,    0x7DD7,    0x5524,    0x4D75,    0x04C2,    0x1C93,    0x3460,    0x2C31,
+        0xA70E,    0xBF5F,    0x97AC,    0x8FFD,    0xC64A,    0xDE1B,    0xF6E8,    0xEEB9,
+        0x5EC1,    0x4690,    0x6E63,    0x7632,    0x3F85,    0x27D4,    0x0F27,    0x1776,
+        0x9C49,    0x8418,    0xACEB,    0xB4BA,    0xFD0D,    0xE55C,    0xCDAF,    0xD5FE,
+        0xAE8A,    0xB6DB,    0x9E28,    0x8679,    0xCFCE,    0xD79F,    0xFF6C,    0xE73D,
+        0x6C02,    0x7453,    0x5CA0,    0x44F1,    0x0D46,    0x1517,    0x3DE4,    0x25B5,
+        0xCB0C,    0xD35D,    0xFBAE,    0xE3FF,    0xAA48,    0xB219,    0x9AEA,    0x82BB,
+        0x0984,    0x11D5,    0x3926,    0x2177,    0x68C0,    0x7091,    0x5862,    0x4033,
+        0x3B47,    0x2316,    0x0BE5,    0x13B4,    0x5A03,    0x4252,    0x6AA1,    0x72F0,
+        0xF9CF,    0xE19E,    0xC96D,    0xD13C,    0x988B,    0x80DA,    0xA829,    0xB078,
+        0xBD82,    0xA5D3,    0x8D20,    0x9571,    0xDCC6,    0xC497,    0xEC64,    0xF435,
+        0x7F0A,    0x675B,    0x4FA8,    0x57F9,    0x1E4E,    0x061F,    0x2EEC,    0x36BD,
+        0x4DC9,    0x5598,    0x7D6B,    0x653A,    0x2C8D,    0x34DC,    0x1C2F,    0x047E,
+        0x8F41,    0x9710,    0xBFE3,    0xA7B2,    0xEE05,    0xF654,    0xDEA7,    0xC6F6,
+        0x284F,    0x301E,    0x18ED,    0x00BC,    0x490B,    0x515A,    0x79A9,    0x61F8,
+        0xEAC7,    0xF296,    0xDA65,    0xC234,    0x8B83,    0x93D2,    0xBB21,    0xA370,
+        0xD804,    0xC055,    0xE8A6,    0xF0F7,    0xB940,    0xA111,    0x89E2,    0x91B3,
+        0x1A8C,    0x02DD,    0x2A2E,    0x327F,    0x7BC8,    0x6399,    0x4B6A,    0x533B,
+        0xE343,    0xFB12,    0xD3E1,    0xCBB0,    0x8207,    0x9A56,    0xB2A5,    0xAAF4,
+        0x21CB,    0x399A,    0x1169,    0x0938,    0x408F,    0x58DE,    0x702D,    0x687C,
+        0x1308,    0x0B59,    0x23AA,    0x3BFB,    0x724C,    0x6A1D,    0x42EE,    0x5ABF,
+        0xD180,    0xC9D1,    0xE122,    0xF973,    0xB0C4,    0xA895,    0x8066,    0x9837,
+        0x768E,    0x6EDF,    0x462C,    0x5E7D,    0x17CA,    0x0F9B,    0x2768,    0x3F39,
+        0xB406,    0xAC57,    0x84A4,    0x9CF5,    0xD542,    0xCD13,    0xE5E0,    0xFDB1,
+        0x86C5,    0x9E94,    0xB667,    0xAE36,    0xE781,    0xFFD0,    0xD723,    0xCF72,
+        0x444D,    0x5C1C,    0x74EF,    0x6CBE,    0x2509,    0x3D58,    0x15AB,    0x0DFA,
+    },
+};
+
+/**
+ * \brief Folding constants x^128, x^192, x^512 and x^576 mod P of the carry-less multiply path
+ * \see crcFoldClmul
+ */
+static const uint64_t FoldConstants_CRC16_755B[4] =
+{
+        0xC8260000ULL,
+        0x6A790000ULL,
+        0x7AB40000ULL,
+        0x2E2F0000ULL,
+};
+
+#endif /* CRC16_755B_SLICE_H_ */
+
+/**
+ * \}
+ * \}
+ */
@@ -0,0 +1,312 @@
+/**
+ * \file crc16_AC9A_slice.h
+ * Precompiled slice-by-8 tables and folding constants for CRC16_AC9A, created by tablecreate
+ * \addtogroup Tools
+ * \{
+ * \addtogroup oschecksum
+ * \{
+ */
+
+#ifndef CRC16_AC9A_SLICE_H_
+#define CRC16_AC9A_SLICE_H_
+
+#include <stdint.h>
+
+/**
+ * \brief Precompiled slice-by-8 tables, table n holds the CRC of a byte followed by n zero bytes
+ * \see crcSlice8
+ */
+static const uint16_t SliceTable_CRC16_AC9A[8][256] =
+{
+    {
+        0x0000,    0xAC9A,    0xF5AE,    0x5934,    0x47C6,    0xEB5C,    0xB268,    0x1EF2,
+        0x8F8C,    0x2316,    0x7A22,    0xD6B8,    0xC84A,    0x64D0,    0x3DE4,    0x917E,
+        0xB382,    0x1F18,    0x462C,    0xEAB6,    0xF444,    0x58DE,    0x01EA,    0xAD70,
+        0x3C0E,    0x9094,    0xC9A0,    0x653A,    0x7BC8,    0xD752,    0x8E66,    0x22FC,
+        0xCB9E,    0x6704,    0x3E30,    0x92AA,    0x8C58,    0x20C2,    0x79F6,    0xD56C,
+        0x4412,    0xE888,    0xB1BC,    0x1D26,    0x03D4,    0xAF4E,    0xF67A,    0x5AE0,
+        0x781C,    0xD486,    0x8DB2,    0x2128,    0x3FDA,    0x9340,    0xCA74,    0x66EE,
+        0xF790,    0x5B0A,    0x023E,    0xAEA4,    0xB056,    0x1CCC,    0x45F8,    0xE962,
+        0x3BA6,    0x973C,    0xCE08,    0x6292,    0x7C60,    0xD0FA,    0x89CE,    0x2554,
+        0xB42A,    0x18B0,    0x4184,    0xED1E,    0xF3EC,    0x5F76,    0x0642,    0xAAD8,
+        0x8824,    0x24BE,    0x7D8A,    0xD110,    0xCFE2,    0x6378,    0x3A4C,    0x96D6,
+        0x07A8,    0xAB32,    0xF206,    0x5E9C,    0x406E,    0xECF4,    0xB5C0,    0x195A,
+        0xF038,    0x5CA2,    0x0596,    0xA90C,    0xB7FE,    0x1B64,    0x4250,    0xEECA,
+        0x7FB4,    0xD32E,    0x8A1A,    0x2680,    0x3872,    0x94E8,    0xCDDC,    0x6146,
+        0x43BA,    0xEF20,    0xB614,    0x1A8E,    0x047C,    0xA8E6,    0xF1D2,    0x5D48,
+        0xCC36,    0x60AC,    0x3998,    0x9502,    0x8BF0,    0x276A,    0x7E5E,    0xD2C4,
+        0x774C,    0xDBD6,    0x82E2,    0x2E78,    0x308A,    0x9C10,    0xC524,    0x69BE,
+        0xF8C0,    0x545A,    0x0D6E,    0xA1F4,    0xBF06,    0x139C,    0x4AA8,    0xE632,
+        0xC4CE,    0x6854,    0x3160,    0x9DFA,    0x8308,    0x2F92,    0x76A6,    0xDA3C,
+        0x4B42,    0xE7D8,    0xBEEC,    0x1276,    0x0C84,    0xA01E,    0xF92A,    0x55B0,
+        0xBCD2,    0x1048,    0x497C,    0xE5E6,    0xFB14,    0x578E,    0x0EBA,    0xA220,
+        0x335E,    0x9FC4,    0xC6F0,    0x6A6A,    0x7498,    0xD802,    0x8136,    0x2DAC,
+        0x0F50,    0xA3CA,    0xFAFE,    0x5664,    0x4896,    0xE40C,    0xBD38,    0x11A2,
+        0x80DC,    0x2C46,    0x7572,    0xD9E8,    0xC71A,    0x6B80,    0x32B4,    0x9E2E,
+        0x4CEA,    0xE070,    0xB944,    0x15DE,    0x0B2C,    0xA7B6,    0xFE82,    0x5218,
+        0xC366,    0x6FFC,    0x36C8,    0x9A52,    0x84A0,    0x283A,    0x710E,    0xDD94,
+        0xFF68,    0x53F2,    0x0AC6,    0xA65C,    0xB8AE,    0x1434,    0x4D00,    0xE19A,
+        0x70E4,    0xDC7E,    0x854A,    0x29D0,    0x3722,    0x9BB8,    0xC28C,    0x6E16,
+        0x8774,    0x2BEE,    0x72DA,    0xDE40,    0xC0B2,    0x6C28,    0x351C,    0x9986,
+        0x08F8,    0xA462,    0xFD56,    0x51CC,    0x4F3E,    0xE3A4,    0xBA90,    0x160A,
+        0x34F6,    0x986C,    0xC158,    0x6DC2,    0x7330,    0xDFAA,    0x869E,    0x2A04,
+        0xBB7A,    0x17E0,    0x4ED4,    0xE24E,    0xFCBC,    0x5026,    0x0912,    0xA588,
+    },
+    {
+        0x0000,    0xEE98,    0x71AA,    0x9F32,    0xE354,    0x0DCC,    0x92FE,    0x7C66,
+        0x6A32,    0x84AA,    0x1B98,    0xF500,    0x8966,    0x67FE,    0xF8CC,    0x1654,
+        0xD464,    0x3AFC,    0xA5CE,    0x4B56,    0x3730,    0xD9A8,    0x469A,    0xA802,
+        0xBE56,    0x50CE,    0xCFFC,    0x2164,    0x5D02,    0xB39A,    0x2CA8,    0xC230,
+        0x0452,    0xEACA,    0x75F8,    0x9B60,    0xE706,    0x099E,    0x96AC,    0x7834,
+        0x6E60,    0x80F8,    0x1FCA,    0xF152,    0x8D34,    0x63AC,    0xFC9E,    0x1206,
+        0xD036,    0x3EAE,    0xA19C,    0x4F04,    0x3362,    0xDDFA,    0x42C8,    0xAC50,
+        0xBA04,    0x549C,    0xCBAE,    0x2536,    0x5950,    0xB7C8,    0x28FA,    0xC662,
+        0x08A4,    0xE63C,    0x790E,    0x9796,    0xEBF0,    0x0568,    0x9A5A,    0x74C2,
+        0x6296,    0x8C0E,    0x133C,    0xFDA4,    0x81C2,    0x6F5A,    0xF068,    0x1EF0,
+        0xDCC0,    0x3258,    0xAD6A,    0x43F2,    0x3F94,    0xD10C,    0x4E3E,    0xA0A6,
+        0xB6F2,    0x586A,    0xC758,    0x29C0,    0x55A6,    0xBB3E,    0x240C,    0xCA94,
+        0x0CF6,    0xE26E,    0x7D5C,    0x93C4,    0xEFA2,    0x013A,    0x9E08,    0x7090,
+        0x66C4,    0x885C,    0x176E,    0xF9F6,    0x8590,    0x6B08,    0xF43A,    0x1AA2,
+        0xD892,    0x360A,    0xA938,    0x47A0,    0x3BC6,    0xD55E,    0x4A6C,    0xA4F4,
+        0xB2A0,    0x5C38,    0xC30A,    0x2D92,    0x51F4,    0xBF6C,    0x205E,    0xCEC6,
+        0x1148,    0xFFD0,    0x60E2,    0x8E7A,    0xF21C,    0x1C84,    0x83B6,    0x6D2E,
+        0x7B7A,    0x95E2,    0x0AD0,    0xE448,    0x982E,    0x76B6,    0xE984,    0x071C,
+        0xC52C,    0x2BB4,    0xB486,    0x5A1E,    0x2678,    0xC8E0,    0x57D2,    0xB94A,
+        0xAF1E,    0x4186,    0xDEB4,    0x302C,    0x4C4A,    0xA2D2,    0x3DE0,    0xD378,
+        0x151A,    0xFB82,    0x64B0,    0x8A28,    0xF64E,    0x18D6,    0x87E4,    0x697C,
+        0x7F28,    0x91B0,    0x0E82,    0xE01A,    0x9C7C,    0x72E4,    0xEDD6,    0x034E,
+        0xC17E,    0x2FE6,    0xB0D4,    0x5E4C,    0x222A,    0xCCB2,    0x5380,    0xBD18,
+        0xAB4C,    0x45D4,    0xDAE6,    0x347E,    0x4818,    0xA680,    0x39B2,    0xD72A,
+        0x19EC,    0xF774,    0x6846,    0x86DE,    0xFAB8,    0x1420,    0x8B12,    0x658A,
+        0x73DE,    0x9D46,    0x0274,    0xECEC,    0x908A,    0x7E12,    0xE120,    0x0FB8,
+        0xCD88,    0x2310,    0xBC22,    0x52BA,    0x2EDC,    0xC044,    0x5F76,    0xB1EE,
+        0xA7BA,    0x4922,    0xD610,    0x3888,    0x44EE,    0xAA76,    0x3544,    0xDBDC,
+        0x1DBE,    0xF326,    0x6C14,    0x828C,    0xFEEA,    0x1072,    0x8F40,    0x61D8,
+        0x778C,    0x9914,    0x0626,    0xE8BE,    0x94D8,    0x7A40,    0xE572,    0x0BEA,
+        0xC9DA,    0x2742,    0xB870,    0x56E8,    0x2A8E,    0xC416,    0x5B24,    0xB5BC,
+        0xA3E8,    0x4D70,    0xD242,    0x3CDA,    0x40BC,    0xAE24,    0x3116,    0xDF8E,
+    },
+    {
+        0x0000,    0x2290,    0x4520,    0x67B0,    0x8A40,    0xA8D0,    0xCF60,    0xEDF0,
+        0xB81A,    0x9A8A,    0xFD3A,    0xDFAA,    0x325A,    0x10CA,    0x777A,    0x55EA,
+        0xDCAE,    0xFE3E,    0x998E,    0xBB1E,    0x56EE,    0x747E,    0x13CE,    0x315E,
+        0x64B4,    0x4624,    0x2194,    0x0304,    0xEEF4,    0xCC64,    0xABD4,    0x8944,
+        0x15C6,    0x3756,    0x50E6,    0x7276,    0x9F86,    0xBD16,    0xDAA6,    0xF836,
+        0xADDC,    0x8F4C,    0xE8FC,    0xCA6C,    0x279C,    0x050C,    0x62BC,    0x402C,
+        0xC968,    0xEBF8,    0x8C48,    0xAED8,    0x4328,    0x61B8,    0x0608,    0x2498,
+        0x7172,    0x53E2,    0x3452,    0x16C2,    0xFB32,    0xD9A2,    0xBE12,    0x9C82,
+        0x2B8C,    0x091C,    0x6EAC,    0x4C3C,    0xA1CC,    0x835C,    0xE4EC,    0xC67C,
+        0x9396,    0xB106,    0xD6B6,    0xF426,    0x19D6,    0x3B46,    0x5CF6,    0x7E66,
+        0xF722,    0xD5B2,    0xB202,    0x9092,    0x7D62,    0x5FF2,    0x3842,    0x1AD2,
+        0x4F38,    0x6DA8,    0x0A18,    0x2888,    0xC578,    0xE7E8,    0x8058,    0xA2C8,
+        0x3E4A,    0x1CDA,    0x7B6A,    0x59FA,    0xB40A,    0x969A,    0xF12A,    0xD3BA,
+        0x8650,    0xA4C0,    0xC370,    0xE1E0,    0x0C10,    0x2E80,    0x4930,    0x6BA0,
+        0xE2E4,    0xC074,    0xA7C4,    0x8554,    0x68A4,    0x4A34,    0x2D84,    0x0F14,
+        0x5AFE,    0x786E,    0x1FDE,    0x3D4E,    0xD0BE,    0xF22E,    0x959E,    0xB70E,
+        0x5718,    0x7588,    0x1238,    0x30A8,    0xDD58,    0xFFC8,    0x9878,    0xBAE8,
+        0xEF02,    0xCD92,    0xAA22,    0x88B2,    0x6542,    0x47D2,    0x2062,    0x02F2,
+        0x8BB6,    0xA926,    0xCE96,    0xEC06,    0x01F6,    0x2366,    0x44D6,    0x6646,
+        0x33AC,    0x113C,    0x768C,    0x541C,    0xB9EC,    0x9B7C,    0xFCCC,    0xDE5C,
+        0x42DE,    0x604E,    0x07FE,    0x256E,    0xC89E,    0xEA0E,    0x8DBE,    0xAF2E,
+        0xFAC4,    0xD854,    0xBFE4,    0x9D74,    0x7084,    0x5214,    0x35A4,    0x1734,
+        0x9E70,    0xBCE0,    0xDB50,    0xF9C0,    0x1430,    0x36A0,    0x5110,    0x7380,
+        0x266A,    0x04FA,    0x634A,    0x41DA,    0xAC2A,    0x8EBA,    0xE90A,    0xCB9A,
+        0x7C94,    0x5E04,    0x39B4,    0x1B24,    0xF6D4,    0xD444,    0xB3F4,    0x9164,
+        0xC48E,    0xE61E,    0x81AE,    0xA33E,    0x4ECE,    0x6C5E,    0x0BEE,    0x297E,
+        0xA03A,    0x82AA,    0xE51A,    0xC78A,    0x2A7A,    0x08EA,    0x6F5A,    0x4DCA,
+        0x1820,    0x3AB0,    0x5D00,    0x7F90,    0x9260,    0xB0F0,    0xD740,    0xF5D0,
+        0x6952,    0x4BC2,    0x2C72,    0x0EE2,    0xE312,    0xC182,    0xA632,    0x84A2,
+        0xD148,    0xF3D8,    0x9468,    0xB6F8,    0x5B08,    0x7998,    0x1E28,    0x3CB8,
+        0xB5FC,    0x976C,    0xF0DC,    0xD24C,    0x3FBC,    0x1D2C,    0x7A9C,    0x580C,
+        0x0DE6,    0x2F76,    0x48C6,    0x6A56,    0x87A6,    0xA536,    0xC286,    0xE016,
+    },
+    {
+        0x0000,    0xAE30,    0xF0FA,    0x5ECA,    0x4D6E,    0xE35E,    0xBD94,    0x13A4,
+        0x9ADC,    0x34EC,    0x6A26,    0xC416,    0xD7B2,    0x7982,    0x2748,    0x8978,
+        0x9922,    0x3712,    0x69D8,    0xC7E8,    0xD44C,    0x7A7C,    0x24B6,    0x8A86,
+        0x03FE,    0xADCE,    0xF304,    0x5D34,    0x4E90,    0xE0A0,    0xBE6A,    0x105A,
+        0x9EDE,    0x30EE,    0x6E24,    0xC014,    0xD3B0,    0x7D80,    0x234A,    0x8D7A,
+        0x0402,    0xAA32,    0xF4F8,    0x5AC8,    0x496C,    0xE75C,    0xB996,    0x17A6,
+        0x07FC,    0xA9CC,    0xF706,    0x5936,    0x4A92,    0xE4A2,    0xBA68,    0x1458,
+        0x9D20,    0x3310,    0x6DDA,    0xC3EA,    0xD04E,    0x7E7E,    0x20B4,    0x8E84,
+        0x9126,    0x3F16,    0x61DC,    0xCFEC,    0xDC48,    0x7278,    0x2CB2,    0x8282,
+        0x0BFA,    0xA5CA,    0xFB00,    0x5530,    0x4694,    0xE8A4,    0xB66E,    0x185E,
+        0x0804,    0xA634,    0xF8FE,    0x56CE,    0x456A,    0xEB5A,    0xB590,    0x1BA0,
+        0x92D8,    0x3CE8,    0x6222,    0xCC12,    0xDFB6,    0x7186,    0x2F4C,    0x817C,
+        0x0FF8,    0xA1C8,    0xFF02,    0x5132,    0x4296,    0xECA6,    0xB26C,    0x1C5C,
+        0x9524,    0x3B14,    0x65DE,    0xCBEE,    0xD84A,    0x767A,    0x28B0,    0x8680,
+        0x96DA,    0x38EA,    0x6620,    0xC810,    0xDBB4,    0x7584,    0x2B4E,    0x857E,
+        0x0C06,    0xA236,    0xFCFC,    0x52CC,    0x4168,    0xEF58,    0xB192,    0x1FA2,
+        0x8ED6,    0x20E6,    0x7E2C,    0xD01C,    0xC3B8,    0x6D88,    0x3342,    0x9D72,
+        0x140A,    0xBA3A,    0xE4F0,    0x4AC0,    0x5964,    0xF754,    0xA99E,    0x07AE,
+        0x17F4,    0xB9C4,    0xE70E,    0x493E,    0x5A9A,    0xF4AA,    0xAA60,    0x0450,
+        0x8D28,    0x2318,    0x7DD2,    0xD3E2,    0xC046,    0x6E76,    0x30BC,    0x9E8C,
+        0x1008,    0xBE38,    0xE0F2,    0x4EC2,    0x5D66,    0xF356,    0xAD9C,    0x03AC,
+        0x8AD4,    0x24E4,    0x7A2E,    0xD41E,    0xC7BA,    0x698A,    0x3740,    0x9970,
+        0x892A,    0x271A,    0x79D0,    0xD7E0,    0xC444,    0x6A74,    0x34BE,    0x9A8E,
+        0x13F6,    0xBDC6,    0xE30C,    0x4D3C,    0x5E98,    0xF0A8,    0xAE62,    0x0052,
+        0x1FF0,    0xB1C0,    0xEF0A,    0x413A,    0x529E,    0xFCAE,    0xA264,    0x0C54,
+        0x852C,    0x2B1C,    0x75D6,    0xDBE6,    0xC842,    0x6672,    0x38B8,    0x9688,
+        0x86D2,    0x28E2,    0x7628,    0xD818,    0xCBBC,    0x658C,    0x3B46,    0x9576,
+        0x1C0E,    0xB23E,    0xECF4,    0x42C4,    0x5160,    0xFF50,    0xA19A,    0x0FAA,
+        0x812E,    0x2F1E,    0x71D4,    0xDFE4,    0xCC40,    0x6270,    0x3CBA,    0x928A,
+        0x1BF2,    0xB5C2,    0xEB08,    0x4538,    0x569C,    0xF8AC,    0xA666,    0x0856,
+        0x180C,    0xB63C,    0xE8F6,    0x46C6,    0x5562,    0xFB52,    0xA598,    0x0BA8,
+        0x82D0,    0x2CE0,    0x722A,    0xDC1A,    0xCFBE,    0x618E,    0x3F44,    0x9174,
+    },
+    {
+        0x0000,    0xB136,    0xCEF6,    0x7FC0,    0x3176,    0x8040,    0xFF80,    0x4EB6,
+        0x62EC,    0xD3DA,    0xAC1A,    0x1D2C,    0x539A,    0xE2AC,    0x9D6C,    0x2C5A,
+        0xC5D8,    0x74EE,    0x0B2E,    0xBA18,    0xF4AE,    0x4598,    0x3A58,    0x8B6E,
+        0xA734,    0x1602,    0x69C2,    0xD8F4,    0x9642,    0x2774,    0x58B4,    0xE982,
+        0x272A,    0x961C,    0xE9DC,    0x58EA,    0x165C,    0xA76A,    0xD8AA,    0x699C,
+        0x45C6,    0xF4F0,    0x8B30,    0x3A06,    0x74B0,    0xC586,    0xBA46,    0x0B70,
+        0xE2F2,    0x53C4,    0x2C04,    0x9D32,    0xD384,    0x62B2,    0x1D72,    0xAC44,
+        0x801E,    0x3128,    0x4EE8,    0xFFDE,    0xB168,    0x005E,    0x7F9E,    0xCEA8,
+        0x4E54,    0xFF62,    0x80A2,    0x3194,    0x7F22,    0xCE14,    0xB1D4,    0x00E2,
+        0x2CB8,    0x9D8E,    0xE24E,    0x5378,    0x1DCE,    0xACF8,    0xD338,    0x620E,
+        0x8B8C,    0x3ABA,    0x457A,    0xF44C,    0xBAFA,    0x0BCC,    0x740C,    0xC53A,
+        0xE960,    0x5856,    0x2796,    0x96A0,    0xD816,    0x6920,    0x16E0,    0xA7D6,
+        0x697E,    0xD848,    0xA788,    0x16BE,    0x5808,    0xE93E,    0x96FE,    0x27C8,
+        0x0B92,    0xBAA4,    0xC564,    0x7452,    0x3AE4,    0x8BD2,    0xF412,    0x4524,
+        0xACA6,    0x1D90,    0x6250,    0xD366,    0x9DD0,    0x2CE6,    0x5326,    0xE210,
+        0xCE4A,    0x7F7C,    0x00BC,    0xB18A,    0xFF3C,    0x4E0A,    0x31CA,    0x80FC,
+        0x9CA8,    0x2D9E,    0x525E,    0xE368,    0xADDE,    0x1CE8,    0x6328,    0xD21E,
+        0xFE44,    0x4F72,    0x30B2,    0x8184,    0xCF32,    0x7E04,    0x01C4,    0xB0F2,
+        0x5970,    0xE846,    0x9786,    0x26B0,    0x6806,    0xD930,    0xA6F0,    0x17C6,
+        0x3B9C,    0x8AAA,    0xF56A,    0x445C,    0x0AEA,    0xBBDC,    0xC41C,    0x752A,
+        0xBB82,    0x0AB4,    0x7574,    0xC442,    0x8AF4,    0x3BC2,    0x4402,    0xF534,
+        0xD96E,    0x6858,    0x1798,    0xA6AE,    0xE818,    0x592E,    0x26EE,    0x97D8,
+        0x7E5A,    0xCF6C,    0xB0AC,    0x019A,    0x4F2C,    0xFE1A,    0x81DA,    0x30EC,
+        0x1CB6,    0xAD80,    0xD240,    0x6376,    0x2DC0,    0x9CF6,    0xE336,    0x5200,
+        0xD2FC,    0x63CA,    0x1C0A,    0xAD3C,    0xE38A,    0x52BC,    0x2D7C,    0x9C4A,
+        0xB010,    0x0126,    0x7EE6,    0xCFD0,    0x8166,    0x3050,    0x4F90,    0xFEA6,
+        0x1724,    0xA612,    0xD9D2,    0x68E4,    0x2652,    0x9764,    0xE8A4,    0x5992,
+        0x75C8,    0xC4FE,    0xBB3E,    0x0A08,    0x44BE,    0xF588,    0x8A48,    0x3B7E,
+        0xF5D6,    0x44E0,    0x3B20,    0x8A16,    0xC4A0,    0x7596,    0x0A56,    0xBB60,
+        0x973A,    0x260C,    0x59CC,    0xE8FA,    0xA64C,    0x177A,    0x68BA,    0xD98C,
+        0x300E,    0x8138,    0xFEF8,    0x4FCE,    0x0178,    0xB04E,    0xCF8E,    0x7EB8,
+        0x52E2,    0xE3D4,    0x9C14,    0x2D22,    0x6394,    0xD2A2,    0xAD62,    0x1C54,
+    },
+    {
+        0x0000,    0x95CA,    0x870E,    0x12C4,    0xA286,    0x374C,    0x2588,    0xB042,
+        0xE996,    0x7C5C,    0x6E98,    0xFB52,    0x4B10,    0xDEDA,    0xCC1E,    0x59D4,
+        0x7FB6,    0xEA7C,    0xF8B8,    0x6D72,    0xDD30,    0x48FA,    0x5A3E,    0xCFF4,
+        0x9620,    0x03EA,    0x112E,    0x84E4,    0x34A6,    0xA16C,    0xB3A8,    0x2662,
+        0xFF6C,    0x6AA6,    0x7862,    0xEDA8,    0x5DEA,    0xC820,    0xDAE4,    0x4F2E,
+        0x16FA,    0x8330,    0x91F4,    0x043E,    0xB47C,    0x21B6,    0x3372,    0xA6B8,
+        0x80DA,    0x1510,    0x07D4,    0x921E,    0x225C,    0xB796,    0xA552,    0x3098,
+        0x694C,    0xFC86,    0xEE42,    0x7B88,    0xCBCA,    0x5E00,    0x4CC4,    0xD90E,
+        0x5242,    0xC788,    0xD54C,    0x4086,    0xF0C4,    0x650E,    0x77CA,    0xE200,
+        0xBBD4,    0x2E1E,    0x3CDA,    0xA910,    0x1952,    0x8C98,    0x9E5C,    0x0B96,
+        0x2DF4,    0xB83E,    0xAAFA,    0x3F30,    0x8F72,    0x1AB8,    0x087C,    0x9DB6,
+        0xC462,    0x51A8,    0x436C,    0xD6A6,    0x66E4,    0xF32E,    0xE1EA,    0x7420,
+        0xAD2E,    0x38E4,    0x2A20,    0xBFEA,    0x0FA8,    0x9A62,    0x88A6,    0x1D6C,
+        0x44B8,    0xD172,    0xC3B6,    0x567C,    0xE63E,    0x73F4,    0x6130,    0xF4FA,
+        0xD298,    0x4752,    0x5596,    0xC05C,    0x701E,    0xE5D4,    0xF710,    0x62DA,
+        0x3B0E,    0xAEC4,    0xBC00,    0x29CA,    0x9988,    0x0C42,    0x1E86,    0x8B4C,
+        0xA484,    0x314E,    0x238A,    0xB640,    0x0602,    0x93C8,    0x810C,    0x14C6,
+        0x4D12,    0xD8D8,    0xCA1C,    0x5FD6,    0xEF94,    0x7A5E,    0x689A,    0xFD50,
+        0xDB32,    0x4EF8,    0x5C3C,    0xC9F6,    0x79B4,    0xEC7E,    0xFEBA,    0x6B70,
+        0x32A4,    0xA76E,    0xB5AA,    0x2060,    0x9022,    0x05E8,    0x172C,    0x82E6,
+        0x5BE8,    0xCE22,    0xDCE6,    0x492C,    0xF96E,    0x6CA4,    0x7E60,    0xEBAA,
+        0xB27E,    0x27B4,    0x3570,    0xA0BA,    0x10F8,    0x8532,    0x97F6,    0x023C,
+        0x245E,    0xB194,    0xA350,    0x369A,    0x86D8,    0x1312,    0x01D6,    0x941C,
+        0xCDC8,    0x5802,    0x4AC6,    0xDF0C,    0x6F4E,    0xFA84,    0xE840,    0x7D8A,
+        0xF6C6,    0x630C,    0x71C8,    0xE402,    0x5440,    0xC18A,    0xD34E,    0x4684,
+        0x1F50,    0x8A9A,    0x985E,    0x0D94,    0xBDD6,    0x281C,    0x3AD8,    0xAF12,
+        0x8970,    0x1CBA,    0x0E7E,    0x9BB4,    0x2BF6,    0xBE3C,    0xACF8,    0x3932,
+        0x60E6,    0xF52C,    0xE7E8,    0x7222,    0xC260,    0x57AA,    0x456E,    0xD0A4,
+        0x09AA,    0x9C60,    0x8EA4,    0x1B6E,    0xAB2C,    0x3EE6,    0x2C22,    0xB9E8,
+        0xE03C,    0x75F6,    0x6732,    0xF2F8,    0x42BA,    0xD770,    0xC5B4,    0x507E,
+        0x761C,    0xE3D6,    0xF112,    0x64D8,    0xD49A,    0x4150,    0x5394,    0xC65E,
+        0x9F8A,    0x0A40,    0x1884,    0x8D4E,    0x3D0C,    0xA8C6,    0xBA02,    0x2FC8,
+    },
+    {
+        0x0000,    0xE592,    0x67BE,    0x822C,    0xCF7C,    0x2AEE,    0xA8C2,    0x4D50,
+        0x3262,    0xD7F0,    0x55DC,    0xB04E,    0xFD1E,    0x188C,    0x9AA0,    0x7F32,
+        0x64C4,    0x8156,    0x037A,    0xE6E8,    0xABB8,    0x4E2A,    0xCC06,    0x2994,
+        0x56A6,    0xB334,    0x3118,    0xD48A,    0x99DA,    0x7C48,    0xFE64,    0x1BF6,
+        0xC988,    0x2C1A,    0xAE36,    0x4BA4,    0x06F4,    0xE366,    0x614A,    0x84D8,
+        0xFBEA,    0x1E78,    0x9C54,    0x79C6,    0x3496,    0xD104,    0x5328,    0xB6BA,
+        0xAD4C,    0x48DE,    0xCAF2,    0x2F60,    0x6230,    0x87A2,    0x058E,    0xE01C,
+        0x9F2E,    0x7ABC,    0xF890,    0x1D02,    0x5052,    0xB5C0,    0x37EC,    0xD27E,
+        0x3F8A,    0xDA18,    0x5834,    0xBDA6,    0xF0F6,    0x1564,    0x9748,    0x72DA,
+        0x0DE8,    0xE87A,    0x6A56,    0x8FC4,    0xC294,    0x2706,    0xA52A,    0x40B8,
+        0x5B4E,    0xBEDC,    0x3CF0,    0xD962,    0x9432,    0x71A0,    0xF38C,    0x161E,
+        0x692C,    0x8CBE,    0x0E92,    0xEB00,    0xA650,    0x43C2,    0xC1EE,    0x247C,
+        0xF602,    0x1390,    0x91BC,    0x742E,    0x397E,    0xDCEC,    0x5EC0,    0xBB52,
+        0xC460,    0x21F2,    0xA3DE,    0x464C,    0x0B1C,    0xEE8E,    0x6CA2,    0x8930,
+        0x92C6,    0x7754,    0xF578,    0x10EA,    0x5DBA,    0xB828,    0x3A04,    0xDF96,
+        0xA0A4,    0x4536,    0xC71A,    0x2288,    0x6FD8,    0x8A4A,    0x0866,    0xEDF4,
+        0x7F14,    0x9A86,    0x18AA,    0xFD38,    0xB068,    0x55FA,    0xD7D6,    0x3244,
+        0x4D76,    0xA8E4,    0x2AC8,    0xCF5A,    0x820A,    0x6798,    0xE5B4,    0x0026,
+        0x1BD0,    0xFE42,    0x7C6E,    0x99FC,    0xD4AC,    0x313E,    0xB312,    0x5680,
+        0x29B2,    0xCC20,    0x4E0C,    0xAB9E,    0xE6CE,    0x035C,    0x8170,    0x64E2,
+        0xB69C,    0x530E,    0xD122,    0x34B0,    0x79E0,    0x9C72,    0x1E5E,    0xFBCC,
+        0x84FE,    0x616C,    0xE340,    0x06D2,    0x4B82,    0xAE10,    0x2C3C,    0xC9AE,
+        0xD258,    0x37CA,    0xB5E6,    0x5074,    0x1D24,    0xF8B6,    0x7A9A,    0x9F08,
+        0xE03A,    0x05A8,    0x8784,    0x6216,    0x2F46,    0xCAD4,    0x48F8,    0xAD6A,
+        0x409E,    0xA50C,    0x2720,    0xC2B2,    0x8FE2,    0x6A70,    0xE85C,    0x0DCE,
+        0x72FC,    0x976E,    0x1542,    0xF0D0,    0xBD80,    0x5812,    0xDA3E,    0x3FAC,
+        0x245A,    0xC1C8,    0x43E4,    0xA676,    0xEB26,    0x0EB4,    0x8C98,    0x690A,
+        0x1638,    0xF3AA,    0x7186,    0x9414,    0xD944,    0x3CD6,    0xBEFA,    0x5B68,
+        0x8916,    0x6C84,    0xEEA8,    0x0B3A,    0x466A,    0xA3F8,    0x21D4,    0xC446,
+        0xBB74,    0x5EE6,    0xDCCA,    0x3958,    0x7408,    0x919A,    0x13B6,    0xF624,
+        0xEDD2,    0x0840,    0x8A6C,    0x6FFE,    0x22AE,    0xC73C,    0x4510,    0xA082,
+        0xDFB0,    0x3A22,    0xB80E,    0x5D9C,    0x10CC,    0xF55E,    0x7772,    0x92E0,
+    },
+    {
+        0x0000,    0xFE28,    0x50CA,    0xAEE2,    0xA194,    0x5FBC,    0xF15E,    0x0F76,
+        0xEFB2,    0x119A,    0xBF78,    0x4150,    0x4E26,    0xB00E,    0x1EEC,    0xE0C4,
+        0x73FE,    0x8DD6,    0x2334,    0xDD1C,    0xD26A,    0x2C42,    0x82A0,    0x7C88,
+        0x9C4C,    0x6264,    0xCC86,    0x32AE,    0x3DD8,    0xC3F0,    0x6D12,    0x933A,
+        0xE7FC,    0x19D4,    0xB736,    0x491E,    0x4668,    0xB840,    0x16A2,    0xE88A,
+        0x084E,    0xF666,    0x5884,    0xA6AC,    0xA9DA,    0x57F2,    0xF910,    0x0738,
+        0x9402,    0x6A2A,    0xC4C8,    0x3AE0,    0x3596,    0xCBBE,    0x655C,    0x9B74,
+        0x7BB0,    0x8598,    0x2B7A,    0xD552,    0xDA24,    0x240C,    0x8AEE,    0x74C6,
+        0x6362,    0x9D4A,    0x33A8,    0xCD80,    0xC2F6,    0x3CDE,    0x923C,    0x6C14,
+        0x8CD0,    0x72F8,    0xDC1A,    0x2232,    0x2D44,    0xD36C,    0x7D8E,    0x83A6,
+        0x109C,    0xEEB4,    0x4056,    0xBE7E,    0xB108,    0x4F20,    0xE1C2,    0x1FEA,
+        0xFF2E,    0x0106,    0xAFE4,    0x51CC,    0x5EBA,    0xA092,    0x0E70,    0xF058,
+        0x849E,    0x7AB6,    0xD454,    0x2A7C,    0x250A,    0xDB22,    0x75C0,    0x8BE8,
+        0x6B2C,    0x9504,    0x3BE6,    0xC5CE,    0xCAB8,    0x3490,    0x9A72,    0x645A,
+        0xF760,    0x0948,    0xA7AA,    0x5982,    0x56F4,    0xA8DC,    0x063E,    0xF816,
+        0x18D2,    0xE6FA,    0x4818,    0xB630,    0xB946,    0x476E,    0xE98C,    0x17A4,
+        0xC6C4,    0x38EC,    0x960E,    0x6826,    0x6750,    0x9978,    0x379A,    0xC9B2,
+        0x2976,    0xD75E,    0x79BC,    0x8794,    0x88E2,    0x76CA,    0xD828,    0x2600,
+        0xB53A,    0x4B12,    0xE5F0,    0x1BD8,    0x14AE,    0xEA86,    0x4464,    0xBA4C,
+        0x5A88,    0xA4A0,    0x0A42,    0xF46A,    0xFB1C,    0x0534,    0xABD6,    0x55FE,
+        0x2138,    0xDF10,    0x71F2,    0x8FDA,    0x80AC,    0x7E84,    0xD066,    0x2E4E,
+        0xCE8A,    0x30A2,    0x9E40,    0x6068,    0x6F1E,    0x9136,    0x3FD4,    0xC1FC,
+        0x52C6,    0xACEE,    0x020C,    0xFC24,    0xF352,    0x0D7A,    0xA398,    0x5DB0,
+        0xBD74,    0x435C,    0xEDBE,    0x1396,    0x1CE0,    0xE2C8,    0x4C2A,    0xB202,
+        0xA5A6,    0x5B8E,    0xF56C,    0x0B44,    0x0432,    0xFA1A,    0x54F8,    0xAAD0,
+        0x4A14,    0xB43C,    0x1ADE,    0xE4F6,    0xEB80,    0x15A8,    0xBB4A,    0x4562,
+        0xD658,    0x2870,    0x8692,    0x78BA,    0x77CC,    0x89E4,    0x2706,    0xD92E,
+        0x39EA,    0xC7C2,    0x6920,    0x9708,    0x987E,    0x6656,    0xC8B4,    0x369C,
+        0x425A,    0xBC72,    0x1290,    0xECB8,    0xE3CE,    0x1DE6,    0xB304,    0x4D2C,
+        0xADE8,    0x53C0,    0xFD22,    0x030A,    0x0C7C,    0xF254,    0x5CB6,    0xA29E,
+        0x31A4,    0xCF8C,    0x616E,    0x9F46,    0x9030,    0x6E18,    0xC0FA,    0x3ED2,
+        0xDE16,    0x203E,    0x8EDC,    0x70F4,    0x7F82,    0x81AA,    0x2F48,    0xD160,
+    },
+};
+
+/**
+ * \brief Folding constants x^128, x^192, x^512 and x^576 mod P of the carry-less multiply path
+ * \see crcFoldClmul
+ */
+static const uint64_t FoldConstants_CRC16_AC9A[4] =
+{
+        0xA9600000ULL,
+        0xC6A00000ULL,
+        0x4B980000ULL,
+        0x0B800000ULL,
+};
+
+#endif /* CRC16_AC9A_SLICE_H_ */
+
+/**
+ * \}
+ * \}
+ */
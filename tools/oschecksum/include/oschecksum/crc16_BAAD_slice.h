@@ -0,0 +1,312 @@
+/**
+ * \file crc16_BAAD_slice.h
+ * Precompiled slice-by-8 tables and folding constants for CRC16_BAAD, created by tablecreate
+ * \addtogroup Tools
+ * \{
+ * \addtogroup oschecksum
+ * \{
+ */
+
+#ifndef CRC16_BAAD_SLICE_H_
+#define CRC16_BAAD_SLICE_H_
+
+#include <stdint.h>
+
+/**
+ * \brief Precompiled slice-by-8 tables, table n holds the CRC of a byte followed by n zero bytes
+ * \see crcSlice8
+ */
+static const uint16_t SliceTable_CRC16_BAAD[8][256] =
+{
+    {
+        0x0000,    0xBAAD,    0xCFF7,    0x755A,    0x2543,    0x9FEE,    0xEAB4,    0x5019,
+        0x4A86,    0xF02B,    0x8571,    0x3FDC,    0x6FC5,    0xD568,    0xA032,    0x1A9F,
+        0x950C,    0x2FA1,    0x5AFB,    0xE056,    0xB04F,    0x0AE2,    0x7FB8,    0xC515,
+        0xDF8A,    0x6527,    0x107D,    0xAAD0,    0xFAC9,    0x4064,    0x353E,    0x8F93,
+        0x90B5,    0x2A18,    0x5F42,    0xE5EF,    0xB5F6,    0x0F5B,    0x7A01,    0xC0AC,
+        0xDA33,    0x609E,    0x15C4,    0xAF69,    0xFF70,    0x45DD,    0x3087,    0x8A2A,
+        0x05B9,    0xBF14,    0xCA4E,    0x70E3,    0x20FA,    0x9A57,    0xEF0D,    0x55A0,
+        0x4F3F,    0xF592,    0x80C8,    0x3A65,    0x6A7C,    0xD0D1,    0xA58B,    0x1F26,
+        0x9BC7,    0x216A,    0x5430,    0xEE9D,    0xBE84,    0x0429,    0x7173,    0xCBDE,
+        0xD141,    0x6BEC,    0x1EB6,    0xA41B,    0xF402,    0x4EAF,    0x3BF5,    0x8158,
+        0x0ECB,    0xB466,    0xC13C,    0x7B91,    0x2B88,    0x9125,    0xE47F,    0x5ED2,
+        0x444D,    0xFEE0,    0x8BBA,    0x3117,    0x610E,    0xDBA3,    0xAEF9,    0x1454,
+        0x0B72,    0xB1DF,    0xC485,    0x7E28,    0x2E31,    0x949C,    0xE1C6,    0x5B6B,
+        0x41F4,    0xFB59,    0x8E03,    0x34AE,    0x64B7,    0xDE1A,    0xAB40,    0x11ED,
+        0x9E7E,    0x24D3,    0x5189,    0xEB24,    0xBB3D,    0x0190,    0x74CA,    0xCE67,
+        0xD4F8,    0x6E55,    0x1B0F,    0xA1A2,    0xF1BB,    0x4B16,    0x3E4C,    0x84E1,
+        0x8D23,    0x378E,    0x42D4,    0xF879,    0xA860,    0x12CD,    0x6797,    0xDD3A,
+        0xC7A5,    0x7D08,    0x0852,    0xB2FF,    0xE2E6,    0x584B,    0x2D11,    0x97BC,
+        0x182F,    0xA282,    0xD7D8,    0x6D75,    0x3D6C,    0x87C1,    0xF29B,    0x4836,
+        0x52A9,    0xE804,    0x9D5E,    0x27F3,    0x77EA,    0xCD47,    0xB81D,    0x02B0,
+        0x1D96,    0xA73B,    0xD261,    0x68CC,    0x38D5,    0x8278,    0xF722,    0x4D8F,
+        0x5710,    0xEDBD,    0x98E7,    0x224A,    0x7253,    0xC8FE,    0xBDA4,    0x0709,
+        0x889A,    0x3237,    0x476D,    0xFDC0,    0xADD9,    0x1774,    0x622E,    0xD883,
+        0xC21C,    0x78B1,    0x0DEB,    0xB746,    0xE75F,    0x5DF2,    0x28A8,    0x9205,
+        0x16E4,    0xAC49,    0xD913,    0x63BE,    0x33A7,    0x890A,    0xFC50,    0x46FD,
+        0x5C62,    0xE6CF,    0x9395,    0x2938,    0x7921,    0xC38C,    0xB6D6,    0x0C7B,
+        0x83E8,    0x3945,    0x4C1F,    0xF6B2,    0xA6AB,    0x1C06,    0x695C,    0xD3F1,
+        0xC96E,    0x73C3,    0x0699,    0xBC34,    0xEC2D,    0x5680,    0x23DA,    0x9977,
+        0x8651,    0x3CFC,    0x49A6,    0xF30B,    0xA312,    0x19BF,    0x6CE5,    0xD648,
+        0xCCD7,    0x767A,    0x0320,    0xB98D,    0xE994,    0x5339,    0x2663,    0x9CCE,
+        0x135D,    0xA9F0,    0xDCAA,    0x6607,    0x361E,    0x8CB3,    0xF9E9,    0x4344,
+        0x59DB,    0xE376,    0x962C,    0x2C81,    0x7C98,    0xC635,    0xB36F,    0x09C2,
+    },
+    {
+        0x0000,    0xA0EB,    0xFB7B,    0x5B90,    0x4C5B,    0xECB0,    0xB720,    0x17CB,
+        0x98B6,    0x385D,    0x63CD,    0xC326,    0xD4ED,    0x7406,    0x2F96,    0x8F7D,
+        0x8BC1,    0x2B2A,    0x70BA,    0xD051,    0xC79A,    0x6771,    0x3CE1,    0x9C0A,
+        0x1377,    0xB39C,    0xE80C,    0x48E7,    0x5F2C,    0xFFC7,    0xA457,    0x04BC,
+        0xAD2F,    0x0DC4,    0x5654,    0xF6BF,    0xE174,    0x419F,    0x1A0F,    0xBAE4,
+        0x3599,    0x9572,    0xCEE2,    0x6E09,    0x79C2,    0xD929,    0x82B9,    0x2252,
+        0x26EE,    0x8605,    0xDD95,    0x7D7E,    0x6AB5,    0xCA5E,    0x91CE,    0x3125,
+        0xBE58,    0x1EB3,    0x4523,    0xE5C8,    0xF203,    0x52E8,    0x0978,    0xA993,
+        0xE0F3,    0x4018,    0x1B88,    0xBB63,    0xACA8,    0x0C43,    0x57D3,    0xF738,
+        0x7845,    0xD8AE,    0x833E,    0x23D5,    0x341E,    0x94F5,    0xCF65,    0x6F8E,
+        0x6B32,    0xCBD9,    0x9049,    0x30A2,    0x2769,    0x8782,    0xDC12,    0x7CF9,
+        0xF384,    0x536F,    0x08FF,    0xA814,    0xBFDF,    0x1F34,    0x44A4,    0xE44F,
+        0x4DDC,    0xED37,    0xB6A7,    0x164C,    0x0187,    0xA16C,    0xFAFC,    0x5A17,
+        0xD56A,    0x7581,    0x2E11,    0x8EFA,    0x9931,    0x39DA,    0x624A,    0xC2A1,
+        0xC61D,    0x66F6,    0x3D66,    0x9D8D,    0x8A46,    0x2AAD,    0x713D,    0xD1D6,
+        0x5EAB,    0xFE40,    0xA5D0,    0x053B,    0x12F0,    0xB21B,    0xE98B,    0x4960,
+        0x7B4B,    0xDBA0,    0x8030,    0x20DB,    0x3710,    0x97FB,    0xCC6B,    0x6C80,
+        0xE3FD,    0x4316,    0x1886,    0xB86D,    0xAFA6,    0x0F4D,    0x54DD,    0xF436,
+        0xF08A,    0x5061,    0x0BF1,    0xAB1A,    0xBCD1,    0x1C3A,    0x47AA,    0xE741,
+        0x683C,    0xC8D7,    0x9347,    0x33AC,    0x2467,    0x848C,    0xDF1C,    0x7FF7,
+        0xD664,    0x768F,    0x2D1F,    0x8DF4,    0x9A3F,    0x3AD4,    0x6144,    0xC1AF,
+        0x4ED2,    0xEE39,    0xB5A9,    0x1542,    0x0289,    0xA262,    0xF9F2,    0x5919,
+        0x5DA5,    0xFD4E,    0xA6DE,    0x0635,    0x11FE,    0xB115,    0xEA85,    0x4A6E,
+        0xC513,    0x65F8,    0x3E68,    0x9E83,    0x8948,    0x29A3,    0x7233,    0xD2D8,
+        0x9BB8,    0x3B53,    0x60C3,    0xC028,    0xD7E3,    0x7708,    0x2C98,    0x8C73,
+        0x030E,    0xA3E5,    0xF875,    0x589E,    0x4F55,    0xEFBE,    0xB42E,    0x14C5,
+        0x1079,    0xB092,    0xEB02,    0x4BE9,    0x5C22,    0xFCC9,    0xA759,    0x07B2,
+        0x88CF,    0x2824,    0x73B4,    0xD35F,    0xC494,    0x647F,    0x3FEF,    0x9F04,
+        0x3697,    0x967C,    0xCDEC,    0x6D07,    0x7ACC,    0xDA27,    0x81B7,    0x215C,
+        0xAE21,    0x0ECA,    0x555A,    0xF5B1,    0xE27A,    0x4291,    0x1901,    0xB9EA,
+        0xBD56,    0x1DBD,    0x462D,    0xE6C6,    0xF10D,    0x51E6,    0x0A76,    0xAA9D,
+        0x25E0,    0x850B,    0xDE9B,    0x7E70,    0x69BB,    0xC950,    0x92C0,    0x322B,
+    },
+    {
+        0x0000,    0xF696,    0x5781,    0xA117,    0xAF02,    0x5994,    0xF883,    0x0E15,
+        0xE4A9,    0x123F,    0xB328,    0x45BE,    0x4BAB,    0xBD3D,    0x1C2A,    0xEABC,
+        0x73FF,    0x8569,    0x247E,    0xD2E8,    0xDCFD,    0x2A6B,    0x8B7C,    0x7DEA,
+        0x9756,    0x61C0,    0xC0D7,    0x3641,    0x3854,    0xCEC2,    0x6FD5,    0x9943,
+        0xE7FE,    0x1168,    0xB07F,    0x46E9,    0x48FC,    0xBE6A,    0x1F7D,    0xE9EB,
+        0x0357,    0xF5C1,    0x54D6,    0xA240,    0xAC55,    0x5AC3,    0xFBD4,    0x0D42,
+        0x9401,    0x6297,    0xC380,    0x3516,    0x3B03,    0xCD95,    0x6C82,    0x9A14,
+        0x70A8,    0x863E,    0x2729,    0xD1BF,    0xDFAA,    0x293C,    0x882B,    0x7EBD,
+        0x7551,    0x83C7,    0x22D0,    0xD446,    0xDA53,    0x2CC5,    0x8DD2,    0x7B44,
+        0x91F8,    0x676E,    0xC679,    0x30EF,    0x3EFA,    0xC86C,    0x697B,    0x9FED,
+        0x06AE,    0xF038,    0x512F,    0xA7B9,    0xA9AC,    0x5F3A,    0xFE2D,    0x08BB,
+        0xE207,    0x1491,    0xB586,    0x4310,    0x4D05,    0xBB93,    0x1A84,    0xEC12,
+        0x92AF,    0x6439,    0xC52E,    0x33B8,    0x3DAD,    0xCB3B,    0x6A2C,    0x9CBA,
+        0x7606,    0x8090,    0x2187,    0xD711,    0xD904,    0x2F92,    0x8E85,    0x7813,
+        0xE150,    0x17C6,    0xB6D1,    0x4047,    0x4E52,    0xB8C4,    0x19D3,    0xEF45,
+        0x05F9,    0xF36F,    0x5278,    0xA4EE,    0xAAFB,    0x5C6D,    0xFD7A,    0x0BEC,
+        0xEAA2,    0x1C34,    0xBD23,    0x4BB5,    0x45A0,    0xB336,    0x1221,    0xE4B7,
+        0x0E0B,    0xF89D,    0x598A,    0xAF1C,    0xA109,    0x579F,    0xF688,    0x001E,
+        0x995D,    0x6FCB,    0xCEDC,    0x384A,    0x365F,    0xC0C9,    0x61DE,    0x9748,
+        0x7DF4,    0x8B62,    0x2A75,    0xDCE3,    0xD2F6,    0x2460,    0x8577,    0x73E1,
+        0x0D5C,    0xFBCA,    0x5ADD,    0xAC4B,    0xA25E,    0x54C8,    0xF5DF,    0x0349,
+        0xE9F5,    0x1F63,    0xBE74,    0x48E2,    0x46F7,    0xB061,    0x1176,    0xE7E0,
+        0x7EA3,    0x8835,    0x2922,    0xDFB4,    0xD1A1,    0x2737,    0x8620,    0x70B6,
+        0x9A0A,    0x6C9C,    0xCD8B,    0x3B1D,    0x3508,    0xC39E,    0x6289,    0x941F,
+        0x9FF3,    0x6965,    0xC872,    0x3EE4,    0x30F1,    0xC667,    0x6770,    0x91E6,
+        0x7B5A,    0x8DCC,    0x2CDB,    0xDA4D,    0xD458,    0x22CE,    0x83D9,    0x754F,
+        0xEC0C,    0x1A9A,    0xBB8D,    0x4D1B,    0x430E,    0xB598,    0x148F,    0xE219,
+        0x08A5,    0xFE33,    0x5F24,    0xA9B2,    0xA7A7,    0x5131,    0xF026,    0x06B0,
+        0x780D,    0x8E9B,    0x2F8C,    0xD91A,    0xD70F,    0x2199,    0x808E,    0x7618,
+        0x9CA4,    0x6A32,    0xCB25,    0x3DB3,    0x33A6,    0xC530,    0x6427,    0x92B1,
+        0x0BF2,    0xFD64,    0x5C73,    0xAAE5,    0xA4F0,    0x5266,    0xF371,    0x05E7,
+        0xEF5B,    0x19CD,    0xB8DA,    0x4E4C,    0x4059,    0xB6CF,    0x17D8,    0xE14E,
+    },
+    {
+        0x0000,    0x6FE9,    0xDFD2,    0xB03B,    0x0509,    0x6AE0,    0xDADB,    0xB532,
+        0x0A12,    0x65FB,    0xD5C0,    0xBA29,    0x0F1B,    0x60F2,    0xD0C9,    0xBF20,
+        0x1424,    0x7BCD,    0xCBF6,    0xA41F,    0x112D,    0x7EC4,    0xCEFF,    0xA116,
+        0x1E36,    0x71DF,    0xC1E4,    0xAE0D,    0x1B3F,    0x74D6,    0xC4ED,    0xAB04,
+        0x2848,    0x47A1,    0xF79A,    0x9873,    0x2D41,    0x42A8,    0xF293,    0x9D7A,
+        0x225A,    0x4DB3,    0xFD88,    0x9261,    0x2753,    0x48BA,    0xF881,    0x9768,
+        0x3C6C,    0x5385,    0xE3BE,    0x8C57,    0x3965,    0x568C,    0xE6B7,    0x895E,
+        0x367E,    0x5997,    0xE9AC,    0x8645,    0x3377,    0x5C9E,    0xECA5,    0x834C,
+        0x5090,    0x3F79,    0x8F42,    0xE0AB,    0x5599,    0x3A70,    0x8A4B,    0xE5A2,
+        0x5A82,    0x356B,    0x8550,    0xEAB9,    0x5F8B,    0x3062,    0x8059,    0xEFB0,
+        0x44B4,    0x2B5D,    0x9B66,    0xF48F,    0x41BD,    0x2E54,    0x9E6F,    0xF186,
+        0x4EA6,    0x214F,    0x9174,    0xFE9D,    0x4BAF,    0x2446,    0x947D,    0xFB94,
+        0x78D8,    0x1731,    0xA70A,    0xC8E3,    0x7DD1,    0x1238,    0xA203,    0xCDEA,
+        0x72CA,    0x1D23,    0xAD18,    0xC2F1,    0x77C3,    0x182A,    0xA811,    0xC7F8,
+        0x6CFC,    0x0315,    0xB32E,    0xDCC7,    0x69F5,    0x061C,    0xB627,    0xD9CE,
+        0x66EE,    0x0907,    0xB93C,    0xD6D5,    0x63E7,    0x0C0E,    0xBC35,    0xD3DC,
+        0xA120,    0xCEC9,    0x7EF2,    0x111B,    0xA429,    0xCBC0,    0x7BFB,    0x1412,
+        0xAB32,    0xC4DB,    0x74E0,    0x1B09,    0xAE3B,    0xC1D2,    0x71E9,    0x1E00,
+        0xB504,    0xDAED,    0x6AD6,    0x053F,    0xB00D,    0xDFE4,    0x6FDF,    0x0036,
+        0xBF16,    0xD0FF,    0x60C4,    0x0F2D,    0xBA1F,    0xD5F6,    0x65CD,    0x0A24,
+        0x8968,    0xE681,    0x56BA,    0x3953,    0x8C61,    0xE388,    0x53B3,    0x3C5A,
+        0x837A,    0xEC93,    0x5CA8,    0x3341,    0x8673,    0xE99A,    0x59A1,    0x3648,
+        0x9D4C,    0xF2A5,    0x429E,    0x2D77,    0x9845,    0xF7AC,    0x4797,    0x287E,
+        0x975E,    0xF8B7,    0x488C,    0x2765,    0x9257,    0xFDBE,    0x4D85,    0x226C,
+        0xF1B0,    0x9E59,    0x2E62,    0x418B,    0xF4B9,    0x9B50,    0x2B6B,    0x4482,
+        0xFBA2,    0x944B,    0x2470,    0x4B99,    0xFEAB,    0x9142,    0x2179,    0x4E90,
+        0xE594,    0x8A7D,    0x3A46,    0x55AF,    0xE09D,    0x8F74,    0x3F4F,    0x50A6,
+        0xEF86,    0x806F,    0x3054,    0x5FBD,    0xEA8F,    0x8566,    0x355D,    0x5AB4,
+        0xD9F8,    0xB611,    0x062A,    0x69C3,    0xDCF1,    0xB318,    0x0323,    0x6CCA,
+        0xD3EA,    0xBC03,    0x0C38,    0x63D1,    0xD6E3,    0xB90A,    0x0931,    0x66D8,
+        0xCDDC,    0xA235,    0x120E,    0x7DE7,    0xC8D5,    0xA73C,    0x1707,    0x78EE,
+        0xC7CE,    0xA827,    0x181C,    0x77F5,    0xC2C7,    0xAD2E,    0x1D15,    0x72FC,
+    },
+    {
+        0x0000,    0xF8ED,    0x4B77,    0xB39A,    0x96EE,    0x6E03,    0xDD99,    0x2574,
+        0x9771,    0x6F9C,    0xDC06,    0x24EB,    0x019F,    0xF972,    0x4AE8,    0xB205,
+        0x944F,    0x6CA2,    0xDF38,    0x27D5,    0x02A1,    0xFA4C,    0x49D6,    0xB13B,
+        0x033E,    0xFBD3,    0x4849,    0xB0A4,    0x95D0,    0x6D3D,    0xDEA7,    0x264A,
+        0x9233,    0x6ADE,    0xD944,    0x21A9,    0x04DD,    0xFC30,    0x4FAA,    0xB747,
+        0x0542,    0xFDAF,    0x4E35,    0xB6D8,    0x93AC,    0x6B41,    0xD8DB,    0x2036,
+        0x067C,    0xFE91,    0x4D0B,    0xB5E6,    0x9092,    0x687F,    0xDBE5,    0x2308,
+        0x910D,    0x69E0,    0xDA7A,    0x2297,    0x07E3,    0xFF0E,    0x4C94,    0xB479,
+        0x9ECB,    0x6626,    0xD5BC,    0x2D51,    0x0825,    0xF0C8,    0x4352,    0xBBBF,
+        0x09BA,    0xF157,    0x42CD,    0xBA20,    0x9F54,    0x67B9,    0xD423,    0x2CCE,
+        0x0A84,    0xF269,    0x41F3,    0xB91E,    0x9C6A,    0x6487,    0xD71D,    0x2FF0,
+        0x9DF5,    0x6518,    0xD682,    0x2E6F,    0x0B1B,    0xF3F6,    0x406C,    0xB881,
+        0x0CF8,    0xF415,    0x478F,    0xBF62,    0x9A16,    0x62FB,    0xD161,    0x298C,
+        0x9B89,    0x6364,    0xD0FE,    0x2813,    0x0D67,    0xF58A,    0x4610,    0xBEFD,
+        0x98B7,    0x605A,    0xD3C0,    0x2B2D,    0x0E59,    0xF6B4,    0x452E,    0xBDC3,
+        0x0FC6,    0xF72B,    0x44B1,    0xBC5C,    0x9928,    0x61C5,    0xD25F,    0x2AB2,
+        0x873B,    0x7FD6,    0xCC4C,    0x34A1,    0x11D5,    0xE938,    0x5AA2,    0xA24F,
+        0x104A,    0xE8A7,    0x5B3D,    0xA3D0,    0x86A4,    0x7E49,    0xCDD3,    0x353E,
+        0x1374,    0xEB99,    0x5803,    0xA0EE,    0x859A,    0x7D77,    0xCEED,    0x3600,
+        0x8405,    0x7CE8,    0xCF72,    0x379F,    0x12EB,    0xEA06,    0x599C,    0xA171,
+        0x1508,    0xEDE5,    0x5E7F,    0xA692,    0x83E6,    0x7B0B,    0xC891,    0x307C,
+        0x8279,    0x7A94,    0xC90E,    0x31E3,    0x1497,    0xEC7A,    0x5FE0,    0xA70D,
+        0x8147,    0x79AA,    0xCA30,    0x32DD,    0x17A9,    0xEF44,    0x5CDE,    0xA433,
+        0x1636,    0xEEDB,    0x5D41,    0xA5AC,    0x80D8,    0x7835,    0xCBAF,    0x3342,
+        0x19F0,    0xE11D,    0x5287,    0xAA6A,    0x8F1E,    0x77F3,    0xC469,    0x3C84,
+        0x8E81,    0x766C,    0xC5F6,    0x3D1B,    0x186F,    0xE082,    0x5318,    0xABF5,
+        0x8DBF,    0x7552,    0xC6C8,    0x3E25,    0x1B51,    0xE3BC,    0x5026,    0xA8CB,
+        0x1ACE,    0xE223,    0x51B9,    0xA954,    0x8C20,    0x74CD,    0xC757,    0x3FBA,
+        0x8BC3,    0x732E,    0xC0B4,    0x3859,    0x1D2D,    0xE5C0,    0x565A,    0xAEB7,
+        0x1CB2,    0xE45F,    0x57C5,    0xAF28,    0x8A5C,    0x72B1,    0xC12B,    0x39C6,
+        0x1F8C,    0xE761,    0x54FB,    0xAC16,    0x8962,    0x718F,    0xC215,    0x3AF8,
+        0x88FD,    0x7010,    0xC38A,    0x3B67,    0x1E13,    0xE6FE,    0x5564,    0xAD89,
+    },
+    {
+        0x0000,    0xB4DB,    0xD31B,    0x67C0,    0x1C9B,    0xA840,    0xCF80,    0x7B5B,
+        0x3936,    0x8DED,    0xEA2D,    0x5EF6,    0x25AD,    0x9176,    0xF6B6,    0x426D,
+        0x726C,    0xC6B7,    0xA177,    0x15AC,    0x6EF7,    0xDA2C,    0xBDEC,    0x0937,
+        0x4B5A,    0xFF81,    0x9841,    0x2C9A,    0x57C1,    0xE31A,    0x84DA,    0x3001,
+        0xE4D8,    0x5003,    0x37C3,    0x8318,    0xF843,    0x4C98,    0x2B58,    0x9F83,
+        0xDDEE,    0x6935,    0x0EF5,    0xBA2E,    0xC175,    0x75AE,    0x126E,    0xA6B5,
+        0x96B4,    0x226F,    0x45AF,    0xF174,    0x8A2F,    0x3EF4,    0x5934,    0xEDEF,
+        0xAF82,    0x1B59,    0x7C99,    0xC842,    0xB319,    0x07C2,    0x6002,    0xD4D9,
+        0x731D,    0xC7C6,    0xA006,    0x14DD,    0x6F86,    0xDB5D,    0xBC9D,    0x0846,
+        0x4A2B,    0xFEF0,    0x9930,    0x2DEB,    0x56B0,    0xE26B,    0x85AB,    0x3170,
+        0x0171,    0xB5AA,    0xD26A,    0x66B1,    0x1DEA,    0xA931,    0xCEF1,    0x7A2A,
+        0x3847,    0x8C9C,    0xEB5C,    0x5F87,    0x24DC,    0x9007,    0xF7C7,    0x431C,
+        0x97C5,    0x231E,    0x44DE,    0xF005,    0x8B5E,    0x3F85,    0x5845,    0xEC9E,
+        0xAEF3,    0x1A28,    0x7DE8,    0xC933,    0xB268,    0x06B3,    0x6173,    0xD5A8,
+        0xE5A9,    0x5172,    0x36B2,    0x8269,    0xF932,    0x4DE9,    0x2A29,    0x9EF2,
+        0xDC9F,    0x6844,    0x0F84,    0xBB5F,    0xC004,    0x74DF,    0x131F,    0xA7C4,
+        0xE63A,    0x52E1,    0x3521,    0x81FA,    0xFAA1,    0x4E7A,    0x29BA,    0x9D61,
+        0xDF0C,    0x6BD7,    0x0C17,    0xB8CC,    0xC397,    0x774C,    0x108C,    0xA457,
+        0x9456,    0x208D,    0x474D,    0xF396,    0x88CD,    0x3C16,    0x5BD6,    0xEF0D,
+        0xAD60,    0x19BB,    0x7E7B,    0xCAA0,    0xB1FB,    0x0520,    0x62E0,    0xD63B,
+        0x02E2,    0xB639,    0xD1F9,    0x6522,    0x1E79,    0xAAA2,    0xCD62,    0x79B9,
+        0x3BD4,    0x8F0F,    0xE8CF,    0x5C14,    0x274F,    0x9394,    0xF454,    0x408F,
+        0x708E,    0xC455,    0xA395,    0x174E,    0x6C15,    0xD8CE,    0xBF0E,    0x0BD5,
+        0x49B8,    0xFD63,    0x9AA3,    0x2E78,    0x5523,    0xE1F8,    0x8638,    0x32E3,
+        0x9527,    0x21FC,    0x463C,    0xF2E7,    0x89BC,    0x3D67,    0x5AA7,    0xEE7C,
+        0xAC11,    0x18CA,    0x7F0A,    0xCBD1,    0xB08A,    0x0451,    0x6391,    0xD74A,
+        0xE74B,    0x5390,    0x3450,    0x808B,    0xFBD0,    0x4F0B,    0x28CB,    0x9C10,
+        0xDE7D,    0x6AA6,    0x0D66,    0xB9BD,    0xC2E6,    0x763D,    0x11FD,    0xA526,
+        0x71FF,    0xC524,    0xA2E4,    0x163F,    0x6D64,    0xD9BF,    0xBE7F,    0x0AA4,
+        0x48C9,    0xFC12,    0x9BD2,    0x2F09,    0x5452,    0xE089,    0x8749,    0x3392,
+        0x0393,    0xB748,    0xD088,    0x6453,    0x1F08,    0xABD3,    0xCC13,    0x78C8,
+        0x3AA5,    0x8E7E,    0xE9BE,    0x5D65,    0x263E,    0x92E5,    0xF525,    0x41FE,
+    },
+    {
+        0x0000,    0x76D9,    0xEDB2,    0x9B6B,    0x61C9,    0x1710,    0x8C7B,    0xFAA2,
+        0xC392,    0xB54B,    0x2E20,    0x58F9,    0xA25B,    0xD482,    0x4FE9,    0x3930,
+        0x3D89,    0x4B50,    0xD03B,    0xA6E2,    0x5C40,    0x2A99,    0xB1F2,    0xC72B,
+        0xFE1B,    0x88C2,    0x13A9,    0x6570,    0x9FD2,    0xE90B,    0x7260,    0x04B9,
+        0x7B12,    0x0DCB,    0x96A0,    0xE079,    0x1ADB,    0x6C02,    0xF769,    0x81B0,
+        0xB880,    0xCE59,    0x5532,    0x23EB,    0xD949,    0xAF90,    0x34FB,    0x4222,
+        0x469B,    0x3042,    0xAB29,    0xDDF0,    0x2752,    0x518B,    0xCAE0,    0xBC39,
+        0x8509,    0xF3D0,    0x68BB,    0x1E62,    0xE4C0,    0x9219,    0x0972,    0x7FAB,
+        0xF624,    0x80FD,    0x1B96,    0x6D4F,    0x97ED,    0xE134,    0x7A5F,    0x0C86,
+        0x35B6,    0x436F,    0xD804,    0xAEDD,    0x547F,    0x22A6,    0xB9CD,    0xCF14,
+        0xCBAD,    0xBD74,    0x261F,    0x50C6,    0xAA64,    0xDCBD,    0x47D6,    0x310F,
+        0x083F,    0x7EE6,    0xE58D,    0x9354,    0x69F6,    0x1F2F,    0x8444,    0xF29D,
+        0x8D36,    0xFBEF,    0x6084,    0x165D,    0xECFF,    0x9A26,    0x014D,    0x7794,
+        0x4EA4,    0x387D,    0xA316,    0xD5CF,    0x2F6D,    0x59B4,    0xC2DF,    0xB406,
+        0xB0BF,    0xC666,    0x5D0D,    0x2BD4,    0xD176,    0xA7AF,    0x3CC4,    0x4A1D,
+        0x732D,    0x05F4,    0x9E9F,    0xE846,    0x12E4,    0x643D,    0xFF56,    0x898F,
+        0x56E5,    0x203C,    0xBB57,    0xCD8E,    0x372C,    0x41F5,    0xDA9E,    0xAC47,
+        0x9577,    0xE3AE,    0x78C5,    0x0E1C,    0xF4BE,    0x8267,    0x190C,    0x6FD5,
+        0x6B6C,    0x1DB5,    0x86DE,    0xF007,    0x0AA5,    0x7C7C,    0xE717,    0x91CE,
+        0xA8FE,    0xDE27,    0x454C,    0x3395,    0xC937,    0xBFEE,    0x2485,    0x525C,
+        0x2DF7,    0x5B2E,    0xC045,    0xB69C,    0x4C3E,    0x3AE7,    0xA18C,    0xD755,
+        0xEE65,    0x98BC,    0x03D7,    0x750E,    0x8FAC,    0xF975,    0x621E,    0x14C7,
+        0x107E,    0x66A7,    0xFDCC,    0x8B15,    0x71B7,    0x076E,    0x9C05,    0xEADC,
+        0xD3EC,    0xA535,    0x3E5E,    0x4887,    0xB225,    0xC4FC,    0x5F97,    0x294E,
+        0xA0C1,    0xD618,    0x4D73,    0x3BAA,    0xC108,    0xB7D1,    0x2CBA,    0x5A63,
+        0x6353,    0x158A,    0x8EE1,    0xF838,    0x029A,    0x7443,    0xEF28,    0x99F1,
+        0x9D48,    0xEB91,    0x70FA,    0x0623,    0xFC81,    0x8A58,    0x1133,    0x67EA,
+        0x5EDA,    0x2803,    0xB368,    0xC5B1,    0x3F13,    0x49CA,    0xD2A1,    0xA478,
+        0xDBD3,    0xAD0A,    0x3661,    0x40B8,    0xBA1A,    0xCCC3,    0x57A8,    0x2171,
+        0x1841,    0x6E98,    0xF5F3,    0x832A,    0x7988,    0x0F51,    0x943A,    0xE2E3,
+        0xE65A,    0x9083,    0x0BE8,    0x7D31,    0x8793,    0xF14A,    0x6A21,    0x1CF8,
+        0x25C8,    0x5311,    0xC87A,    0xBEA3,    0x4401,    0x32D8,    0xA9B3,    0xDF6A,
+    },
+    {
+        0x0000,    0xADCA,    0xE139,    0x4CF3,    0x78DF,    0xD515,    0x99E6,    0x342C,
+        0xF1BE,    0x5C74,    0x1087,    0xBD4D,    0x8961,    0x24AB,    0x6858,    0xC592,
+        0x59D1,    0xF41B,    0xB8E8,    0x1522,    0x210E,    0x8CC4,    0xC037,    0x6DFD,
+        0xA86F,    0x05A5,    0x4956,    0xE49C,    0xD0B0,    0x7D7A,    0x3189,    0x9C43,
+        0xB3A2,    0x1E68,    0x529B,    0xFF51,    0xCB7D,    0x66B7,    0x2A44,    0x878E,
+        0x421C,    0xEFD6,    0xA325,    0x0EEF,    0x3AC3,    0x9709,    0xDBFA,    0x7630,
+        0xEA73,    0x47B9,    0x0B4A,    0xA680,    0x92AC,    0x3F66,    0x7395,    0xDE5F,
+        0x1BCD,    0xB607,    0xFAF4,    0x573E,    0x6312,    0xCED8,    0x822B,    0x2FE1,
+        0xDDE9,    0x7023,    0x3CD0,    0x911A,    0xA536,    0x08FC,    0x440F,    0xE9C5,
+        0x2C57,    0x819D,    0xCD6E,    0x60A4,    0x5488,    0xF942,    0xB5B1,    0x187B,
+        0x8438,    0x29F2,    0x6501,    0xC8CB,    0xFCE7,    0x512D,    0x1DDE,    0xB014,
+        0x7586,    0xD84C,    0x94BF,    0x3975,    0x0D59,    0xA093,    0xEC60,    0x41AA,
+        0x6E4B,    0xC381,    0x8F72,    0x22B8,    0x1694,    0xBB5E,    0xF7AD,    0x5A67,
+        0x9FF5,    0x323F,    0x7ECC,    0xD306,    0xE72A,    0x4AE0,    0x0613,    0xABD9,
+        0x379A,    0x9A50,    0xD6A3,    0x7B69,    0x4F45,    0xE28F,    0xAE7C,    0x03B6,
+        0xC624,    0x6BEE,    0x271D,    0x8AD7,    0xBEFB,    0x1331,    0x5FC2,    0xF208,
+        0x017F,    0xACB5,    0xE046,    0x4D8C,    0x79A0,    0xD46A,    0x9899,    0x3553,
+        0xF0C1,    0x5D0B,    0x11F8,    0xBC32,    0x881E,    0x25D4,    0x6927,    0xC4ED,
+        0x58AE,    0xF564,    0xB997,    0x145D,    0x2071,    0x8DBB,    0xC148,    0x6C82,
+        0xA910,    0x04DA,    0x4829,    0xE5E3,    0xD1CF,    0x7C05,    0x30F6,    0x9D3C,
+        0xB2DD,    0x1F17,    0x53E4,    0xFE2E,    0xCA02,    0x67C8,    0x2B3B,    0x86F1,
+        0x4363,    0xEEA9,    0xA25A,    0x0F90,    0x3BBC,    0x9676,    0xDA85,    0x774F,
+        0xEB0C,    0x46C6,    0x0A35,    0xA7FF,    0x93D3,    0x3E19,    0x72EA,    0xDF20,
+        0x1AB2,    0xB778,    0xFB8B,    0x5641,    0x626D,    0xCFA7,    0x8354,    0x2E9E,
+        0xDC96,    0x715C,    0x3DAF,    0x9065,    0xA449,    0x0983,    0x4570,    0xE8BA,
+        0x2D28,    0x80E2,    0xCC11,    0x61DB,    0x55F7,    0xF83D,    0xB4CE,    0x1904,
+        0x8547,    0x288D,    0x647E,    0xC9B4,    0xFD98,    0x5052,    0x1CA1,    0xB16B,
+        0x74F9,    0xD933,    0x95C0,    0x380A,    0x0C26,    0xA1EC,    0xED1F,    0x40D5,
+        0x6F34,    0xC2FE,    0x8E0D,    0x23C7,    0x17EB,    0xBA21,    0xF6D2,    0x5B18,
+        0x9E8A,    0x3340,    0x7FB3,    0xD279,    0xE655,    0x4B9F,    0x076C,    0xAAA6,
+        0x36E5,    0x9B2F,    0xD7DC,    0x7A16,    0x4E3A,    0xE3F0,    0xAF03,    0x02C9,
+        0xC75B,    0x6A91,    0x2662,    0x8BA8,    0xBF84,    0x124E,    0x5EBD,    0xF377,
+    },
+};
+
+/**
+ * \brief Folding constants x^128, x^192, x^512 and x^576 mod P of the carry-less multiply path
+ * \see crcFoldClmul
+ */
+static const uint64_t FoldConstants_CRC16_BAAD[4] =
+{
+        0xC80A0000ULL,
+        0x03080000ULL,
+        0x729D0000ULL,
+        0x694D0000ULL,
+};
+
+#endif /* CRC16_BAAD_SLICE_H_ */
+
+/**
+ * \}
+ * \}
+ */
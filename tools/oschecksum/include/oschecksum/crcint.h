@@ -42,6 +42,19 @@ OSCHECKSUM_EXPORT uint8_t uc_openSAFETY_CRC8(uint8_t uc_sub_length, uint8_t uc_p
  */
 OSCHECKSUM_EXPORT uint16_t ui_openSAFETY_CRC16(uint16_t ui_sub_length, uint16_t ui_poly, uint8_t *uc_subframe);
 
+/**
+ * \brief Calculates a CRC16 checksum for the given buffer and polynomial, bit by bit
+ *
+ * \param len the length of the given buffer
+ * \param pBuffer a pointer to a buffer of the given length
+ * \param initCRC Initial value for the CRC calculation. In case of openSAFETY, this is always 0
+ * \param Polynom the generator polynomial
+ *
+ * \return the CRC16 checksum for the buffer
+ */
+OSCHECKSUM_EXPORT uint16_t crc16ChecksumCalculatorPoly(uint32_t len, const uint8_t * pBuffer,
+                uint16_t initCRC, uint16_t Polynom);
+
 OSCHECKSUM_EXPORT uint16_t crc16ChecksumPoly(uint32_t len, const uint8_t * pBuffer,
                 uint16_t initCRC, uint16_t Polynom);
 
@@ -33,12 +33,184 @@ enum eCRC_TYPE
         CRC8,           /**< CRC8 table type */
         CRC16,          /**< CRC16 table type */
         CRC16_AC9A,     /**< CRC16_AC9A table type */
+        CRC16_755B,     /**< CRC16_755B table type */
+        CRC16_5935,     /**< CRC16_5935 table type */
         CRC32,          /**< CRC32 table type */
         CRC32_PNG,      /**< CRC32_PNG table type */
 };
 
+/** \brief Number of tables for the slice-by-8 algorithm */
+#define SLICE_TABLES 8
+
+/** \brief Distances in bits, the carry-less multiply path folds its 128 bit blocks by */
+static const uint32_t FoldDistances[] = { 128, 192, 512, 576 };
+
+/**
+ * \brief Returns the polynom of a 16 bit CRC type
+ * \param type the CRC type
+ * \return the polynom
+ */
+static uint16_t crc16Polynom ( enum eCRC_TYPE type )
+{
+        switch ( type )
+        {
+        case CRC16_AC9A: return CRC16_POLY_AC9A;
+        case CRC16_755B: return CRC16_POLY_755B;
+        case CRC16_5935: return CRC16_POLY_5935;
+        default: return CRC16_POLY_BAAD;
+        }
+}
+
+/**
+ * \brief Calculates the reflected CRC32 (PNG) of a single byte, without the inversions
+ * \param data the byte
+ * \return the table entry of the byte
+ */
+static uint32_t crc32PNGByte ( uint8_t data )
+{
+        uint32_t crc = data;
+        int k;
+
+        for ( k = 0; k < 8; k++ )
+                crc = ( crc & 1 ) ? ( ( crc >> 1 ) ^ CRC32PNG_POLY ) : ( crc >> 1 );
+        return crc;
+}
+
+/**
+ * \brief Calculates x^distance mod ( x^32 + poly ), the polynom is not reflected
+ * \param distance the exponent
+ * \param poly the polynom without the x^32 term
+ * \return the remainder
+ */
+static uint32_t xPowMod ( uint32_t distance, uint32_t poly )
+{
+        uint32_t rem = 1;
+
+        while ( distance-- > 0 )
+                rem = ( rem & 0x80000000UL ) ? ( ( rem << 1 ) ^ poly ) : ( rem << 1 );
+        return rem;
+}
+
+/**
+ * \brief Reverses the bits of a 32 bit value
+ * \param value the value
+ * \return the reversed value
+ */
+static uint32_t reflect32 ( uint32_t value )
+{
+        uint32_t result = 0;
+        int k;
+
+        for ( k = 0; k < 32; k++ )
+        {
+                result = ( result << 1 ) | ( value & 1 );
+                value >>= 1;
+        }
+        return result;
+}
+
+/**
+ * \brief Prints a header holding the slice-by-8 tables and the folding constants
+ * of the carry-less multiply path for the given CRC type.
+ *
+ * Table 0 is the byte table, table n holds the CRC of a byte followed by n zero bytes.
+ * The CRC16 types are folded as CRC32 with the polynom multiplied by x^16, the CRC
+ * ending up in the upper 16 bits. The folding constants of CRC32_PNG are reflected
+ * and multiplied by x^-1, to compensate the shift of a reflected carry-less multiply.
+ *
+ * \param type the CRC type
+ * \param name the name of the type in the header
+ * \return 1 if the type has no slice tables, 0 otherwise
+ */
+static int printSliceHeader ( enum eCRC_TYPE type, const char * name )
+{
+        uint32_t table[SLICE_TABLES][256];
+        uint32_t poly;
+        uint8_t data[1];
+        int width, reflected;
+        int i, k;
+        size_t d;
+
+        switch ( type )
+        {
+        case CRC16: case CRC16_AC9A: case CRC16_755B: case CRC16_5935:
+                width = 16; reflected = 0; poly = (uint32_t) crc16Polynom ( type ) << 16; break;
+        case CRC32:
+                width = 32; reflected = 0; poly = CRC32_POLY; break;
+        case CRC32_PNG:
+                width = 32; reflected = 1; poly = reflect32 ( CRC32PNG_POLY ); break;
+        default:
+                printf ( "No slice tables for %s\n", name );
+                return 1;
+        }
+
+        for ( i = 0; i < 256; i++ )
+        {
+                data[0] = i;
+                if ( type == CRC32 )
+                        table[0][i] = crc32ChecksumCalculator ( 1, data, 0 );
+                else if ( type == CRC32_PNG )
+                        table[0][i] = crc32PNGByte ( data[0] );
+                else
+                        table[0][i] = crc16ChecksumCalculatorPoly ( 1, data, 0, crc16Polynom ( type ) );
+        }
+        for ( k = 1; k < SLICE_TABLES; k++ )
+        {
+                for ( i = 0; i < 256; i++ )
+                {
+                        uint32_t prev = table[k - 1][i];
+                        if ( reflected )
+                                table[k][i] = ( prev >> 8 ) ^ table[0][prev & 0xFF];
+                        else if ( width == 16 )
+                                table[k][i] = ( ( prev << 8 ) & 0xFFFF ) ^ table[0][prev >> 8];
+                        else
+                                table[k][i] = ( prev << 8 ) ^ table[0][prev >> 24];
+                }
+        }
+
+        printf ( "/**\n * \\file crc%s_slice.h\n", name + 3 );
+        printf ( " * Precompiled slice-by-8 tables and folding constants for %s, created by tablecreate\n", name );
+        printf ( " * \\addtogroup Tools\n * \\{\n * \\addtogroup oschecksum\n * \\{\n */\n\n" );
+        printf ( "#ifndef %s_SLICE_H_\n#define %s_SLICE_H_\n\n#include <stdint.h>\n\n", name, name );
+
+        printf ( "/**\n * \\brief Precompiled slice-by-8 tables, table n holds the CRC of a byte followed by n zero bytes\n" );
+        printf ( " * \\see crcSlice8\n */\n" );
+        printf ( "static const uint%d_t SliceTable_%s[%d][256] =\n{\n", width, name, SLICE_TABLES );
+        for ( k = 0; k < SLICE_TABLES; k++ )
+        {
+                printf ( "    {\n" );
+                for ( i = 0; i < 256; i++ )
+                {
+                        if ( width == 16 )
+                                printf ( "%s0x%04X,%s", ( i % 8 ) ? "    " : "        ", (unsigned) table[k][i], ( i % 8 == 7 ) ? "\n" : "" );
+                        else
+                                printf ( "%s0x%08lX,%s", ( i % 8 ) ? "    " : "        ", (unsigned long) table[k][i], ( i % 8 == 7 ) ? "\n" : "" );
+                }
+                printf ( "    },\n" );
+        }
+        printf ( "};\n\n" );
+
+        printf ( "/**\n * \\brief Folding constants x^128, x^192, x^512 and x^576 mod P of the carry-less multiply path\n" );
+        printf ( " * \\see crcFoldClmul\n */\n" );
+        printf ( "static const uint64_t FoldConstants_%s[%d] =\n{\n", name, (int)( sizeof(FoldDistances) / sizeof(FoldDistances[0]) ) );
+        for ( d = 0; d < sizeof(FoldDistances) / sizeof(FoldDistances[0]); d++ )
+        {
+                if ( reflected )
+                        printf ( "        0x%08lX00000000ULL,\n", (unsigned long) reflect32 ( xPowMod ( FoldDistances[d] - 1, poly ) ) );
+                else
+                        printf ( "        0x%08lXULL,\n", (unsigned long) xPowMod ( FoldDistances[d], poly ) );
+        }
+        printf ( "};\n\n#endif /* %s_SLICE_H_ */\n\n/**\n * \\}\n * \\}\n */\n", name );
+
+        return 0;
+}
+
 /**
  * \brief TableCreate will create a CRC table for the given table type. For possible CRC types see \ref eCRC_TYPE
+ *
+ * With SLICE8 as second argument, the header with the slice-by-8 tables and the folding constants of
+ * the type is printed instead.
+ *
  * \param argc number of arguments given
  * \param argv arguments given
  * \return 1 if the wrong number of arguments have been given, 0 otherwise
@@ -51,9 +223,9 @@ int main (int argc, char ** argv)
 
         myCRCTYPE = CRC8;
 
-        if ( argc != 2 )
+        if ( ( argc != 2 ) && ! ( ( argc == 3 ) && ( strcmp ( argv[2], "SLICE8" ) == 0 ) ) )
         {
-                printf ( "Wrong number of arguments!\n\tUsage: %s {CRC8|CRC16|CRC16_AC9A|CRC32|CRC32_PNG}\n\n", argv[0]);
+                printf ( "Wrong number of arguments!\n\tUsage: %s {CRC8|CRC16|CRC16_AC9A|CRC16_755B|CRC16_5935|CRC32|CRC32_PNG} [SLICE8]\n\n", argv[0]);
                 return 1;
         }
 
@@ -63,11 +235,18 @@ int main (int argc, char ** argv)
                 myCRCTYPE = CRC16;
         else if ( strcmp ( argv[1], "CRC16_AC9A" ) == 0 )
                 myCRCTYPE = CRC16_AC9A;
+        else if ( strcmp ( argv[1], "CRC16_755B" ) == 0 )
+                myCRCTYPE = CRC16_755B;
+        else if ( strcmp ( argv[1], "CRC16_5935" ) == 0 )
+                myCRCTYPE = CRC16_5935;
         else if ( strcmp ( argv[1], "CRC32" ) == 0 )
                 myCRCTYPE = CRC32;
         else if ( strcmp ( argv[1], "CRC32_PNG" ) == 0 )
                 myCRCTYPE = CRC32_PNG;
 
+        if ( argc == 3 )
+                return printSliceHeader ( myCRCTYPE, ( myCRCTYPE == CRC16 ) ? "CRC16_BAAD" : argv[1] );
+
         for ( i = 0; i < 256; i ++ )
         {
                 data[0] = i;
@@ -79,6 +258,9 @@ int main (int argc, char ** argv)
                         printf ( "        0x%04X, /** %02X */\n", crc16ChecksumCalculator(1, data, 0), i); break;
                 case CRC16_AC9A:
                         printf ( "          0x%04X, /** %02X */\n", crc16ChecksumCalculator_AC9A(1, data, 0), i); break;
+                case CRC16_755B:
+                case CRC16_5935:
+                        printf ( "        0x%04X, /** %02X */\n", crc16ChecksumCalculatorPoly(1, data, 0, crc16Polynom ( myCRCTYPE )), i); break;
                 case CRC32:
                         printf ( "        0x%08X, /** %02X */\n", crc32ChecksumCalculator(1, data, 0), i); break;
                 case CRC32_PNG:
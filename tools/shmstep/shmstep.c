@@ -0,0 +1,245 @@
+/**
+ * \file shmstep.c
+ * \addtogroup Tools
+ * \{
+ * \addtogroup shmstep ShmStep
+ * This small utility steps the simulated clock of the nodes attached to the shared memory segment of
+ * the SHNF (transport "shm", clock "simulated"). All nodes run in lockstep on the same protocol time,
+ * one after the other in the order of their SADRs, see SHNF_SharedMemory/SHMStep.h. A run of SCM and
+ * SNs is therefore reproducible, independent of the speed and the load of the host:
+ *
+ *     OPENSAFETY_SHNF_TRANSPORT=shm OPENSAFETY_SHNF_CLOCK=simulated ./scm &
+ *     OPENSAFETY_SHNF_TRANSPORT=shm OPENSAFETY_SHNF_CLOCK=simulated ./sn1 &
+ *     OPENSAFETY_SHNF_TRANSPORT=shm OPENSAFETY_SHNF_CLOCK=simulated ./sn2 &
+ *     ./shmstep -n 3 -c 60000
+ *
+ * \{
+ * \details
+ * \{
+ * This source code is free software; you can redistribute it and/or modify it
+ * under the terms of the BSD license (according to License.txt).
+ * \}
+ * \version 1.0
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#include <limits.h>
+#include <time.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <linux/futex.h>
+
+#include "EPLStarget.h"
+#include "CrossCompile_Linux.h"
+#include "SHM_Configuration.h"
+#include "SHMStep.h"
+
+/** \brief Default simulated time per step in micro seconds, the idle tick of the nodes */
+#define DEFAULT_STEP_US 1000
+
+/** \brief Time in micro seconds a node may take for one step, before a warning is printed */
+#define STEP_WARN_US 5000000
+
+/** \brief Interval in micro seconds of the retries, while the segment or the nodes are missing */
+#define RETRY_US 100000
+
+/** \brief The options of a run */
+typedef struct
+{
+        const char * segment;   /**< name of the shared memory segment */
+        uint32_t numNodes;      /**< nodes to wait for before the first step */
+        uint32_t stepUs;        /**< simulated time per step */
+        uint64_t numSteps;      /**< steps to run, 0 for no limit */
+        uint64_t printSteps;    /**< steps between the progress lines, 0 for none */
+} tOptions;
+
+/**
+ * \brief Prints the usage
+ * \param name the name of the program
+ */
+static void usage ( const char * name )
+{
+        fprintf ( stderr, "Usage: %s [-n nodes] [-s step_us] [-c steps] [-p steps] [-m segment]\n"
+                  "  -n  nodes to wait for, before the first step is granted (1)\n"
+                  "  -s  simulated time per step in us (%u)\n"
+                  "  -c  number of steps, 0 runs until interrupted (0)\n"
+                  "  -p  steps between two progress lines, 0 for none (1000)\n"
+                  "  -m  name of the shared memory segment (%s)\n",
+                  name, DEFAULT_STEP_US, k_SHM_SEGMENT_NAME );
+}
+
+/**
+ * \brief Maps the step barrier at the start of the segment. The segment is created by the first node,
+ * so the driver waits for it.
+ * \param segment the name of the segment
+ * \return the step barrier, NULL on failure
+ */
+static t_SHM_STEP * mapSteps ( const char * segment )
+{
+        struct stat segStat;
+        void * mapped;
+        int fd;
+
+        for ( ;; )
+        {
+                fd = shm_open ( segment, O_RDWR, 0 );
+                if ( fd >= 0 && fstat ( fd, &segStat ) == 0 && segStat.st_size >= (off_t)sizeof(t_SHM_STEP) )
+                        break;
+                if ( fd >= 0 )
+                        close ( fd );
+                else if ( errno != ENOENT )
+                {
+                        fprintf ( stderr, "shm_open of %s failed: %s\n", segment, strerror ( errno ) );
+                        return NULL;
+                }
+                usleep ( RETRY_US );
+        }
+
+        mapped = mmap ( NULL, sizeof(t_SHM_STEP), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0 );
+        close ( fd );
+        if ( mapped == MAP_FAILED )
+        {
+                fprintf ( stderr, "mmap of %s failed: %s\n", segment, strerror ( errno ) );
+                return NULL;
+        }
+
+        return (t_SHM_STEP *)mapped;
+}
+
+/**
+ * \brief Collects the nodes waiting for their steps, in the order of their SADRs
+ * \param steps the step barrier
+ * \param nodes the indices of the entries of the nodes
+ * \return the number of nodes
+ */
+static uint32_t collectNodes ( t_SHM_STEP * steps, uint32_t nodes[] )
+{
+        uint32_t numNodes = 0;
+        uint32_t sadr;
+        uint32_t i;
+        uint32_t j;
+
+        for ( i = 0; i < k_SHM_STEP_MAX_NODES; i++ )
+        {
+                if ( !ATOMIC_LOAD_ACQUIRE ( steps->as_nodes[i].dw_ready ) )
+                        continue;
+                sadr = ATOMIC_LOAD_ACQUIRE ( steps->as_nodes[i].dw_sadr );
+                if ( sadr == 0 )
+                        continue;
+
+                /* insertion sort, there are only a few nodes */
+                for ( j = numNodes; j > 0 && steps->as_nodes[nodes[j - 1]].dw_sadr > sadr; j-- )
+                        nodes[j] = nodes[j - 1];
+                nodes[j] = i;
+                numNodes++;
+        }
+
+        return numNodes;
+}
+
+/**
+ * \brief Grants the next step to a node and waits, until the node finished its application loop or left
+ * the barrier
+ * \param node the entry of the node
+ * \param timeUs the simulated time of the step
+ */
+static void stepNode ( t_SHM_STEP_NODE * node, uint64_t timeUs )
+{
+        struct timespec timeout = { 0, RETRY_US * 1000 };
+        uint32_t granted;
+        uint32_t sadr;
+        uint32_t waitedUs = 0;
+
+        sadr = ATOMIC_LOAD_ACQUIRE ( node->dw_sadr );
+        granted = ATOMIC_LOAD_ACQUIRE ( node->dw_done ) + 1;
+
+        node->ddw_timeUs = timeUs;
+        ATOMIC_STORE_RELEASE ( node->dw_granted, granted );
+        syscall ( SYS_futex, &node->dw_granted, FUTEX_WAKE, INT_MAX, NULL, NULL, 0 );
+
+        while ( ATOMIC_LOAD_ACQUIRE ( node->dw_done ) != granted )
+        {
+                if ( !ATOMIC_LOAD_ACQUIRE ( node->dw_ready ) || ATOMIC_LOAD_ACQUIRE ( node->dw_sadr ) != sadr )
+                {
+                        printf ( "SADR %u left at %llu us\n", sadr, (unsigned long long)timeUs );
+                        return;
+                }
+
+                syscall ( SYS_futex, &node->dw_done, FUTEX_WAIT, granted - 1, &timeout, NULL, 0 );
+                waitedUs += RETRY_US;
+                if ( waitedUs == STEP_WARN_US )
+                        printf ( "SADR %u has not finished the step of %llu us yet\n", sadr,
+                                 (unsigned long long)timeUs );
+        }
+}
+
+/**
+ * \brief Main function
+ */
+int main ( int argc, char ** argv )
+{
+        tOptions options = { k_SHM_SEGMENT_NAME, 1, DEFAULT_STEP_US, 0, 1000 };
+        uint32_t nodes[k_SHM_STEP_MAX_NODES];
+        uint32_t numNodes;
+        uint32_t i;
+        uint64_t step;
+        uint64_t timeUs = 0;
+        t_SHM_STEP * steps;
+        int opt;
+
+        while ( ( opt = getopt ( argc, argv, "n:s:c:p:m:h" ) ) != -1 )
+        {
+                switch ( opt )
+                {
+                case 'n': options.numNodes = (uint32_t)strtoul ( optarg, NULL, 0 ); break;
+                case 's': options.stepUs = (uint32_t)strtoul ( optarg, NULL, 0 ); break;
+                case 'c': options.numSteps = strtoull ( optarg, NULL, 0 ); break;
+                case 'p': options.printSteps = strtoull ( optarg, NULL, 0 ); break;
+                case 'm': options.segment = optarg; break;
+                default: usage ( argv[0] ); return EXIT_FAILURE;
+                }
+        }
+        if ( options.numNodes == 0 || options.numNodes > k_SHM_STEP_MAX_NODES || options.stepUs == 0 )
+        {
+                usage ( argv[0] );
+                return EXIT_FAILURE;
+        }
+
+        if ( ( steps = mapSteps ( options.segment ) ) == NULL )
+                return EXIT_FAILURE;
+
+        printf ( "Waiting for %u nodes on %s\n", options.numNodes, options.segment );
+        while ( collectNodes ( steps, nodes ) < options.numNodes )
+                usleep ( RETRY_US );
+
+        for ( step = 1; options.numSteps == 0 || step <= options.numSteps; step++ )
+        {
+                timeUs += options.stepUs;
+
+                /* nodes joining or leaving take part from the next step on */
+                numNodes = collectNodes ( steps, nodes );
+                for ( i = 0; i < numNodes; i++ )
+                        stepNode ( &steps->as_nodes[nodes[i]], timeUs );
+
+                if ( options.printSteps != 0 && ( step % options.printSteps ) == 0 )
+                        printf ( "Step %llu, %llu us, %u nodes\n", (unsigned long long)step,
+                                 (unsigned long long)timeUs, numNodes );
+        }
+
+        munmap ( steps, sizeof(t_SHM_STEP) );
+
+        return EXIT_SUCCESS;
+}
+
+/**
+ * \}
+ * \}
+ * \}
+ */
@@ -0,0 +1,150 @@
+/**
+ * \file TST_MQTTTopic.c
+ * Checks the topic routing of the MQTT SHNF, see \ref mqttFrameTopic and
+ * \ref mqttSubscriptionTopic. Every frame has to reach the nodes, which subscribe
+ * to it, and only them.
+ *
+ *****************************************************************************
+ * This source code is free software; you can redistribute it and/or modify it
+ * under the terms of the BSD license (according to License.txt).
+ *****************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "MQTTTopic.h"
+#include "MQTT_Configuration.h"
+
+/* SADR of the TxSPDO of the producer, the TADR of the time requests to it */
+#define k_TST_PRODUCER_SADR  1U
+/* SADR of the TxSPDO of the consumer, which sends the time requests */
+#define k_TST_CONSUMER_SADR  4U
+/* SADR of the TxSPDO of a node, which does not consume the SPDOs of the producer */
+#define k_TST_OTHER_SADR     2U
+
+static int i_failures = 0;
+
+#define TST_CHECK( cond ) \
+    do { if ( !( cond ) ) { fprintf ( stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond ); i_failures++; } } while ( 0 )
+
+/**
+ * Returns TRUE, if the topic matches the filter. Only the wildcard used by the
+ * SHNF is supported, a trailing '#'.
+ */
+static BOOLEAN TST_TopicMatches ( const char * c_filter, const char * c_topic )
+{
+    while ( *c_filter != '\0' )
+    {
+        if ( ( c_filter[0] == '#' ) && ( c_filter[1] == '\0' ) )
+            return TRUE;
+        /* "a/#" matches "a" as well */
+        if ( ( *c_topic == '\0' ) && ( strcmp ( c_filter, "/#" ) == 0 ) )
+            return TRUE;
+        if ( *c_filter != *c_topic )
+            return FALSE;
+        c_filter++;
+        c_topic++;
+    }
+    return (BOOLEAN)( *c_topic == '\0' );
+}
+
+/* Returns TRUE, if a node subscribed with c_filter receives the frame published on c_topic,
+   both as single frame and coalesced with others */
+static BOOLEAN TST_Receives ( const char * c_filter, const char * c_topic )
+{
+    char c_coalesced[k_MAX_TOPIC_LEN + sizeof(k_MQTT_COALESCED_SUFFIX)];
+
+    snprintf ( c_coalesced, sizeof(c_coalesced), "%s%s", c_topic, k_MQTT_COALESCED_SUFFIX );
+    return (BOOLEAN)( TST_TopicMatches ( c_filter, c_topic ) && TST_TopicMatches ( c_filter, c_coalesced ) );
+}
+
+/* Returns TRUE, if a node subscribed with c_filter does not receive the frame published on c_topic
+   as single frame or coalesced with others */
+static BOOLEAN TST_Ignores ( const char * c_filter, const char * c_topic )
+{
+    char c_coalesced[k_MAX_TOPIC_LEN + sizeof(k_MQTT_COALESCED_SUFFIX)];
+
+    snprintf ( c_coalesced, sizeof(c_coalesced), "%s%s", c_topic, k_MQTT_COALESCED_SUFFIX );
+    return (BOOLEAN)( !TST_TopicMatches ( c_filter, c_topic ) && !TST_TopicMatches ( c_filter, c_coalesced ) );
+}
+
+/* The producer receives the time request of a consumer, addressed by its TADR */
+static void TST_TimeRequestReachesProducer ( void )
+{
+    char c_topic[k_MAX_TOPIC_LEN];
+    char c_producer[k_MAX_TOPIC_LEN + sizeof(k_MQTT_SUBSCRIBE_SUFFIX)];
+    char c_other[k_MAX_TOPIC_LEN + sizeof(k_MQTT_SUBSCRIBE_SUFFIX)];
+
+    /* the consumer sends the request with the SADR of the producer in the TADR */
+    mqttFrameTopic ( c_topic, SHNF_k_SPDO, TRUE, k_TST_PRODUCER_SADR );
+
+    /* the producer subscribes the SADR of its TxSPDO (0x1C00 + n, sub-index 0x01) */
+    mqttSubscriptionTopic ( c_producer, SHNF_k_SPDO, TRUE, k_TST_PRODUCER_SADR );
+    TST_CHECK ( TST_Receives ( c_producer, c_topic ) );
+
+    /* the request is not sent to the other producers */
+    mqttSubscriptionTopic ( c_other, SHNF_k_SPDO, TRUE, k_TST_OTHER_SADR );
+    TST_CHECK ( TST_Ignores ( c_other, c_topic ) );
+
+    /* nor to the nodes subscribed to the SPDOs of the consumer or the producer */
+    mqttSubscriptionTopic ( c_other, SHNF_k_SPDO, FALSE, k_TST_CONSUMER_SADR );
+    TST_CHECK ( TST_Ignores ( c_other, c_topic ) );
+    mqttSubscriptionTopic ( c_other, SHNF_k_SPDO, FALSE, k_TST_PRODUCER_SADR );
+    TST_CHECK ( TST_Ignores ( c_other, c_topic ) );
+}
+
+/* The consumer receives the data and the time responses of its producer */
+static void TST_SpdoReachesConsumer ( void )
+{
+    char c_topic[k_MAX_TOPIC_LEN];
+    char c_consumer[k_MAX_TOPIC_LEN + sizeof(k_MQTT_SUBSCRIBE_SUFFIX)];
+    char c_producer[k_MAX_TOPIC_LEN + sizeof(k_MQTT_SUBSCRIBE_SUFFIX)];
+
+    /* the consumer subscribes the SADR of its RxSPDO (0x1400 + n, sub-index 0x01) */
+    mqttSubscriptionTopic ( c_consumer, SHNF_k_SPDO, FALSE, k_TST_PRODUCER_SADR );
+
+    /* data only SPDOs and time responses carry the SADR of the producer */
+    mqttFrameTopic ( c_topic, SHNF_k_SPDO, FALSE, k_TST_PRODUCER_SADR );
+    TST_CHECK ( TST_Receives ( c_consumer, c_topic ) );
+
+    /* the producer does not receive its own SPDOs */
+    mqttSubscriptionTopic ( c_producer, SHNF_k_SPDO, TRUE, k_TST_PRODUCER_SADR );
+    TST_CHECK ( TST_Ignores ( c_producer, c_topic ) );
+}
+
+/* SNMT and SSDO frames reach the node they are addressed to */
+static void TST_ServiceFramesReachNode ( void )
+{
+    char c_topic[k_MAX_TOPIC_LEN];
+    char c_filter[k_MAX_TOPIC_LEN + sizeof(k_MQTT_SUBSCRIBE_SUFFIX)];
+
+    mqttFrameTopic ( c_topic, SHNF_k_SNMT, FALSE, k_TST_CONSUMER_SADR );
+    mqttSubscriptionTopic ( c_filter, SHNF_k_SNMT, FALSE, k_TST_CONSUMER_SADR );
+    TST_CHECK ( TST_Receives ( c_filter, c_topic ) );
+
+    /* slim SSDOs share the topics of the SSDOs */
+    mqttFrameTopic ( c_topic, SHNF_k_SSDO_SLIM, FALSE, k_TST_CONSUMER_SADR );
+    mqttSubscriptionTopic ( c_filter, SHNF_k_SSDO, FALSE, k_TST_CONSUMER_SADR );
+    TST_CHECK ( TST_Receives ( c_filter, c_topic ) );
+
+    mqttSubscriptionTopic ( c_filter, SHNF_k_SSDO, FALSE, k_TST_OTHER_SADR );
+    TST_CHECK ( TST_Ignores ( c_filter, c_topic ) );
+}
+
+int main ( void )
+{
+#if ( k_MQTT_TOPIC_ROUTING == EPLS_k_ENABLE )
+    TST_TimeRequestReachesProducer ();
+    TST_SpdoReachesConsumer ();
+    TST_ServiceFramesReachNode ();
+#endif
+
+    if ( i_failures > 0 )
+    {
+        fprintf ( stderr, "%d checks failed\n", i_failures );
+        return EXIT_FAILURE;
+    }
+    printf ( "All checks passed\n" );
+    return EXIT_SUCCESS;
+}